@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_HELPERS_DIGEST_H_
+#define LSP_PLUG_IN_TK_HELPERS_DIGEST_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Digest of the data, used to check that the data has not been changed
+         */
+        typedef struct digest_t
+        {
+            uint8_t     vData[32];      // SHA-256 digest
+        } digest_t;
+
+        /**
+         * Compute SHA-256 digest of the data
+         * @param dst digest to store
+         * @param data data to process
+         * @param size size of data in bytes
+         */
+        void sha256(digest_t *dst, const void *data, size_t size);
+
+        /**
+         * Reset the digest to all zeros
+         * @param dst digest to reset
+         */
+        void clear_digest(digest_t *dst);
+
+        /**
+         * Compare two digests
+         * @param a first digest
+         * @param b second digest
+         * @return true if digests are equal
+         */
+        bool digest_equals(const digest_t *a, const digest_t *b);
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_HELPERS_DIGEST_H_ */
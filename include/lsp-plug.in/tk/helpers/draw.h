@@ -127,6 +127,19 @@ namespace lsp
             const LSPString *text
         );
 
+        /**
+         * Resample the bitmap with 32-bit premultiplied pixel format to the new size.
+         * Bilinear interpolation is used for magnification, the triangle filter of
+         * the corresponding width is used for minification.
+         *
+         * @param dst destination bitmap
+         * @param src source bitmap
+         * @param width the width of the destination bitmap
+         * @param height the height of the destination bitmap
+         * @return status of operation
+         */
+        status_t scale_bitmap(mm::Bitmap *dst, const mm::Bitmap *src, size_t width, size_t height);
+
     } /* namespace tk */
 } /* namespace lsp */
 
@@ -27,18 +27,31 @@
 #endif
 
 #include <lsp-plug.in/mm/Bitmap.h>
+#include <lsp-plug.in/tk/sys/BitmapCache.h>
 
 namespace lsp
 {
     namespace tk
     {
         /**
-         * Bitmap: in-memory contents of bitmap image stored in PRGBA8888 format
+         * Bitmap: in-memory contents of bitmap image stored in PRGBA8888 format.
+         * The contents may be shared with other bitmaps loaded from the same
+         * resource by the bitmap cache, shared contents are copied on modification.
+         * When the cache is assigned to the bitmap, images loaded by path are taken
+         * from the cache.
          */
         class Bitmap: public Property
         {
             protected:
-                mm::Bitmap                      sBitmap;
+                mm::Bitmap                      sBitmap;        // Own contents
+                BitmapCache::image_t           *pImage;         // Shared contents
+                ScaledBitmaps                   sScaled;        // Pre-scaled versions of own contents
+                BitmapCache                    *pCache;         // Cache used for loading images by path
+
+            protected:
+                inline const mm::Bitmap        *current() const { return (pImage != NULL) ? BitmapCache::bitmap(pImage) : &sBitmap; }
+                void                            drop_shared();
+                status_t                        detach();
 
             protected:
                 explicit Bitmap(prop::Listener *listener = NULL);
@@ -50,20 +63,42 @@ namespace lsp
                 Bitmap & operator = (Bitmap &&) = delete;
 
             public:
-                const mm::Bitmap *bitmap() const                        { return &sBitmap;                  }
-
-                inline mm::pixel_format_t format() const noexcept       { return sBitmap.format();          }
-                inline size_t rows() const noexcept                     { return sBitmap.rows();            }
-                inline size_t width() const noexcept                    { return sBitmap.width();           }
-                inline size_t columns() const noexcept                  { return sBitmap.columns();         }
-                inline size_t height() const noexcept                   { return sBitmap.height();          }
-                inline size_t stride() const noexcept                   { return sBitmap.stride();          }
-                inline size_t bytes_per_row() const noexcept            { return sBitmap.bytes_per_row();   }
-                inline uint8_t *row(size_t index) noexcept              { return sBitmap.row(index);        }
-                inline const uint8_t *row(size_t index) const noexcept  { return sBitmap.row(index);        }
-                inline uint8_t *data() noexcept                         { return sBitmap.data();            }
-                inline const uint8_t *data() const noexcept             { return sBitmap.data();            }
-                inline bool is_empty() const noexcept                   { return sBitmap.is_empty();        }
+                const mm::Bitmap *bitmap() const                        { return current();                 }
+
+                inline mm::pixel_format_t format() const noexcept       { return current()->format();       }
+                inline size_t rows() const noexcept                     { return current()->rows();         }
+                inline size_t width() const noexcept                    { return current()->width();        }
+                inline size_t columns() const noexcept                  { return current()->columns();      }
+                inline size_t height() const noexcept                   { return current()->height();       }
+                inline size_t stride() const noexcept                   { return current()->stride();       }
+                inline size_t bytes_per_row() const noexcept            { return current()->bytes_per_row(); }
+                uint8_t *row(size_t index) noexcept;
+                inline const uint8_t *row(size_t index) const noexcept  { return current()->row(index);     }
+                uint8_t *data() noexcept;
+                inline const uint8_t *data() const noexcept             { return current()->data();         }
+                inline bool is_empty() const noexcept                   { return current()->is_empty();     }
+                inline bool shared() const noexcept                     { return pImage != NULL;            }
+
+                /**
+                 * Get the version of the bitmap scaled to the specified size, scaled versions
+                 * are kept until the contents of the bitmap change
+                 * @param width width of the scaled bitmap
+                 * @param height height of the scaled bitmap
+                 * @return pointer to the scaled bitmap or NULL on error or if the size is too large
+                 */
+                const mm::Bitmap *scaled(size_t width, size_t height);
+
+                /**
+                 * Set the cache used for loading images by path
+                 * @param cache cache of decoded bitmaps, NULL to load images privately
+                 */
+                inline void set_cache(BitmapCache *cache)               { pCache = cache;                   }
+
+                /**
+                 * Get the cache used for loading images by path
+                 * @return cache of decoded bitmaps or NULL
+                 */
+                inline BitmapCache *cache()                             { return pCache;                    }
 
             public: // mm::Bitmap interface
                 status_t set(const mm::Bitmap & src);
@@ -83,6 +118,17 @@ namespace lsp
                 status_t load(const io::Path & path, mm::IColorMap *map = NULL);
                 status_t load(io::IInStream *is, mm::IColorMap *map = NULL);
 
+                /**
+                 * Load the bitmap using the cache of decoded bitmaps, the decoded contents
+                 * are shared with other bitmaps loaded from the same path with the same color map
+                 * @param cache cache of decoded bitmaps
+                 * @param path path to the image
+                 * @param map color map, may be NULL
+                 * @return status of operation
+                 */
+                status_t load(BitmapCache *cache, const char *path, mm::IColorMap *map = NULL);
+                status_t load(BitmapCache *cache, const LSPString *path, mm::IColorMap *map = NULL);
+
                 void swap(mm::Bitmap *src);
                 inline void swap(mm::Bitmap &src)                       { swap(&src);                       }
                 void swap(Bitmap *src);
@@ -105,6 +105,7 @@ namespace lsp
                 inline float    min() const                 { return fMin;                      }
                 inline float    max() const                 { return fMax;                      }
                 inline bool     valid() const               { return vData != NULL;             }
+                inline size_t   memory_usage() const        { return (vData != NULL) ? nCapacity * nStride * sizeof(float) : 0; }
                 float           get_default() const;
                 const float    *row(uint32_t id) const;
 
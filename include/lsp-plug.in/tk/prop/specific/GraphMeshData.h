@@ -26,15 +26,38 @@
     #error "use <lsp-plug.in/tk/tk.h>"
 #endif
 
+#include <atomic>
+
 namespace lsp
 {
     namespace tk
     {
+        /**
+         * Mesh data. Besides direct data modification from the main thread, the property
+         * supports the triple-buffered mode: the producer thread writes the data directly
+         * into the back frame and publishes it without locking the display, the widget
+         * takes the most recent published frame when rendering.
+         */
         class GraphMeshData: public MultiProperty
         {
+            public:
+                typedef struct frame_t
+                {
+                    float          *x;                  // X coordinates
+                    float          *y;                  // Y coordinates
+                    float          *s;                  // Strobes, NULL if not enabled
+                    size_t          capacity;           // Maximum number of elements in the frame
+                } frame_t;
+
             protected:
                 static const prop::desc_t   DESC[];
 
+                enum frame_flags_t
+                {
+                    FRAME_INDEX     = 0x3,
+                    FRAME_DIRTY     = 0x4
+                };
+
                 enum property_t
                 {
                     P_SIZE,
@@ -62,6 +85,14 @@ namespace lsp
                 bool            bStrobe;
                 uint8_t        *pPtr;
 
+                bool            bTriple;            // Triple-buffered mode
+                size_t          nCapacity;          // Capacity of frame in triple-buffered mode
+                float          *vFrames[3];         // Frames in triple-buffered mode
+                size_t          vFrameSize[3];      // Size of the data in each frame
+                std::atomic<uint32_t> nMiddle;      // Index of the published frame and dirty flag
+                uint32_t        nFront;             // Frame used for rendering
+                uint32_t        nBack;              // Frame filled by the producer
+
                 atom_t          vAtoms[P_COUNT];    // Atoms
                 Listener        sListener;          // Listener
 
@@ -84,6 +115,7 @@ namespace lsp
                 inline size_t       size() const                { return nSize;                                 }
                 inline size_t       capacity() const            { return nStride*(2 + bStrobe);                 }
                 inline bool         valid() const               { return vData != NULL;                         }
+                inline size_t       memory_usage() const        { return (vData != NULL) ? capacity() * sizeof(float) * ((bTriple) ? 3 : 1) : 0; }
                 inline bool         strobe() const              { return bStrobe;                               }
                 inline const float *x() const                   { return vData;                                 }
                 inline const float *y() const                   { return &vData[nStride];                       }
@@ -105,6 +137,46 @@ namespace lsp
                 bool                set_s(const float *v, size_t size);
                 inline bool         set_s(const float *v)       { return set_s(v, nSize);       }
                 bool                set(const float *x, const float *y, size_t size);
+
+            public:
+                /**
+                 * Switch to triple-buffered mode, should be called from the main thread.
+                 * In this mode the size of data can be changed only by publishing frames.
+                 *
+                 * @param capacity maximum number of elements in a frame
+                 * @return true on success
+                 */
+                bool                set_triple_buffer(size_t capacity);
+
+                /**
+                 * Check that the triple-buffered mode is enabled
+                 * @return true if triple-buffered mode is enabled
+                 */
+                inline bool         triple_buffer() const       { return bTriple;                               }
+
+                /**
+                 * Get the back frame to write data, should be called from the producer thread
+                 * @param frame pointer to store the frame descriptor
+                 * @return true on success, false if triple-buffered mode is not enabled
+                 */
+                bool                back_frame(frame_t *frame);
+
+                /**
+                 * Publish the back frame, should be called from the producer thread. The
+                 * producer is responsible for requesting the redraw of the widget, for
+                 * example with Display::post().
+                 *
+                 * @param size number of elements written to the back frame
+                 * @return true on success
+                 */
+                bool                publish(size_t size);
+
+                /**
+                 * Take the most recent published frame for rendering, should be called
+                 * from the main thread
+                 * @return true if the new frame has been taken
+                 */
+                bool                fetch();
         };
 
         namespace prop
@@ -75,10 +75,16 @@ namespace lsp
                 typedef struct raw_property_t
                 {
                     const LSPString *name;
-                    const LSPString *value;
+                    const StyleSheet::property_t *value;
                     ssize_t order;
                 } raw_property_t;
 
+                typedef struct color_ref_t
+                {
+                    Style              *style;
+                    atom_t              id;
+                } color_ref_t;
+
                 typedef struct property_value_t
                 {
                     property_type_t     type;
@@ -97,8 +103,11 @@ namespace lsp
                 size_t                              nFlags;
                 Style                              *pRoot;
                 lltl::pphash<LSPString, Style>      vBuiltin;
+                lltl::pphash<LSPString, IStyleFactory> vFactories;      // Builtin styles not instantiated yet
                 lltl::pphash<LSPString, Style>      vStyles;
                 lltl::pphash<LSPString, lsp::Color> vColors;
+                lltl::pphash<LSPString, StyleSheet::font_t> vFonts;     // Fonts of the last applied style sheet
+                StringPool                          sStrings;   // Interned string values of style properties
 
                 prop::Float                         sScaling;
                 prop::Float                         sFontScaling;
@@ -114,21 +123,35 @@ namespace lsp
                 static bool         make_raw_properties(StyleSheet::style_t *xs, lltl::darray<raw_property_t> *props);
 
             protected:
-                status_t            create_builtin_style(IStyleFactory *init);
+                status_t            register_builtin_style(IStyleFactory *init);
+                Style              *create_builtin_style(const LSPString *name);
+                Style              *find_style(const LSPString *name);
                 status_t            create_style(const LSPString *name);
                 status_t            create_missing_styles(const StyleSheet *sheet);
-                status_t            unlink_styles();
-                status_t            link_styles(const StyleSheet *sheet);
-                status_t            configure_styles(const StyleSheet *sheet);
-                static bool         check_parents_configured(Style *s);
+                StyleSheet::style_t *sheet_style(Style *s, const StyleSheet *sheet);
+                status_t            style_parents(lltl::parray<Style> *dst, Style *s, const StyleSheet *sheet);
+                status_t            unlink_styles(const StyleSheet *sheet);
+                status_t            link_style(Style *s, const StyleSheet *sheet, lltl::parray<Style> *order);
+                status_t            link_styles(const StyleSheet *sheet, lltl::parray<Style> *order);
+                status_t            configure_styles(const StyleSheet *sheet, const lltl::parray<Style> *order, const lltl::parray<LSPString> *colors);
+                status_t            find_color_refs(lltl::darray<color_ref_t> *refs, Style *s, StyleSheet::style_t *xs, const lltl::parray<LSPString> *colors);
+                status_t            refresh_colors(const lltl::darray<color_ref_t> *refs);
+                static bool         refers_color(const LSPString *value, const LSPString *color);
+                static bool         is_color_char(lsp_wchar_t ch);
 
                 status_t            apply_settings(Style *s, StyleSheet::style_t *xs);
-                status_t            apply_relations(Style *s, const lltl::parray<LSPString> *parents);
-                status_t            apply_relations(Style *s, const char *parents);
+                status_t            resolve_parents(lltl::parray<Style> *dst, const LSPString *parent);
+                status_t            resolve_parents(lltl::parray<Style> *dst, const lltl::parray<LSPString> *parents);
+                status_t            resolve_parents(lltl::parray<Style> *dst, const char *parents);
                 void                destroy_colors();
-                status_t            init_colors_from_sheet(const StyleSheet *sheet);
+                void                destroy_fonts();
+                static bool         colors_equal(const lsp::Color *a, const lsp::Color *b);
+                status_t            update_colors_from_sheet(const StyleSheet *sheet, lltl::parray<LSPString> *changed);
+                bool                fonts_changed(const StyleSheet *sheet) const;
+                status_t            copy_fonts_from_sheet(const StyleSheet *sheet);
                 status_t            load_fonts_from_sheet(const StyleSheet *sheet, resource::ILoader *loader);
                 static status_t     parse_property_value(property_value_t *v, const LSPString *text, property_type_t pt);
+                static status_t     resolve_property_value(property_value_t *v, const StyleSheet::property_t *prop, property_type_t pt);
 
                 void                bind(Style *root);
 
@@ -221,6 +244,12 @@ namespace lsp
                  */
                 lsp::Color         *color(const LSPString *id);
 
+                /**
+                 * Get pool of interned string values of style properties
+                 * @return pool of interned strings
+                 */
+                inline StringPool  *strings()   { return &sStrings; }
+
                 /**
                  * Get root style
                  * @return root style or NULL on error
@@ -229,6 +258,7 @@ namespace lsp
 
                 /**
                  * Get style by class identifier.
+                 * Builtin styles are instantiated on the first request and bound to their default parents.
                  * If style does not exists, it will be automatically created and bound to the root style
                  * @return style or NULL on error
                  */
@@ -236,6 +266,7 @@ namespace lsp
 
                 /**
                  * Get style by class identifier.
+                 * Builtin styles are instantiated on the first request and bound to their default parents.
                  * If style does not exists, it will be automatically created and bound to the root style
                  * @return style or NULL on error
                  */
@@ -262,6 +293,24 @@ namespace lsp
                  */
                 const char         *atom_name(atom_t id) const;
 
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix of the
+                 * property descriptor, the list is resolved only once
+                 * @param base base atom
+                 * @param desc property descriptor
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t       *composite_atoms(atom_t base, const prop::desc_t *desc) const;
+
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix,
+                 * the list is resolved only once
+                 * @param base base atom
+                 * @param postfix NULL-terminated statically allocated list of postfixes
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t       *composite_atoms(atom_t base, const char * const *postfix) const;
+
                 /**
                  * Get currently used language
                  * @param dst pointer to store the result
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_
+#define LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Pool of interned immutable reference-counted strings. Equal strings
+         * obtained from the same pool share the same handle, so they can be
+         * compared by pointer. Reference counting is available only for handles
+         * issued by the pool, plain character strings can not be acquired.
+         */
+        class StringPool
+        {
+            public:
+                /**
+                 * Handle of the interned string, the characters immediately follow the handle
+                 */
+                typedef struct string_t
+                {
+                    string_t           *pNext;      // Next string in the bin
+                    StringPool         *pPool;      // Owning pool, NULL if the pool has been destroyed
+                    size_t              nHash;      // Hash of the string
+                    size_t              nRefs;      // Number of references
+                    size_t              nLength;    // Length of the string in bytes
+                } string_t;
+
+            protected:
+                enum pool_t
+                {
+                    POOL_INITIAL_BINS   = 0x40
+                };
+
+            protected:
+                string_t          **vBins;          // Hash bins
+                size_t              nBins;          // Number of bins
+                size_t              nSize;          // Number of strings in the pool
+
+            protected:
+                static inline char         *data(string_t *s)          { return reinterpret_cast<char *>(&s[1]);                          }
+                static size_t               hash(const char *s, size_t len);
+
+                bool                        grow();
+                void                        remove(string_t *s);
+
+            public:
+                explicit StringPool();
+                StringPool(const StringPool &) = delete;
+                StringPool(StringPool &&) = delete;
+                ~StringPool();
+
+                StringPool & operator = (const StringPool &) = delete;
+                StringPool & operator = (StringPool &&) = delete;
+
+                /**
+                 * Detach all strings from the pool, strings which are still referenced
+                 * will be freed after the last reference is released
+                 */
+                void                        destroy();
+
+            public:
+                /**
+                 * Get interned copy of the string and acquire reference to it
+                 * @param s string to intern
+                 * @return handle of the interned string or NULL on allocation error
+                 */
+                string_t                   *intern(const char *s);
+
+                /**
+                 * Get number of strings in the pool
+                 * @return number of strings
+                 */
+                inline size_t               size() const    { return nSize; }
+
+            public:
+                /**
+                 * Get the empty interned string, it is not reference-counted
+                 * @return handle of the empty string
+                 */
+                static string_t            *empty();
+
+                /**
+                 * Make the reference-counted copy of the string that does not belong to any pool,
+                 * it is freed after the last reference is released
+                 * @param s string to copy
+                 * @return handle of the string or NULL on allocation error
+                 */
+                static string_t            *copy(const char *s);
+
+                /**
+                 * Acquire reference to the interned string
+                 * @param s handle of the interned string
+                 * @return the same handle
+                 */
+                static string_t            *acquire(string_t *s);
+
+                /**
+                 * Release reference to the interned string
+                 * @param s handle of the interned string
+                 */
+                static void                 release(string_t *s);
+
+                /**
+                 * Get characters of the interned string
+                 * @param s handle of the interned string
+                 * @return UTF-8 encoded string
+                 */
+                static inline const char   *c_str(const string_t *s)   { return reinterpret_cast<const char *>(&s[1]);  }
+
+                /**
+                 * Estimate amount of memory used by the interned string, the memory is
+                 * accounted proportionally to the number of references
+                 * @param s handle of the interned string
+                 * @return amount of memory in bytes
+                 */
+                static size_t               memory(const string_t *s);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_ */
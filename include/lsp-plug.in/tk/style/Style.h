@@ -29,6 +29,7 @@
 #include <lsp-plug.in/runtime/LSPString.h>
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/phashset.h>
 
 namespace lsp
 {
@@ -53,6 +54,7 @@ namespace lsp
                     F_OVERRIDDEN        = 1 << 0,   // Property has been locally overridden by client
                     F_NTF_LISTENERS     = 1 << 1,   // Property requires notification of listeners
                     F_NTF_CHILDREN      = 1 << 2,   // Property requires notification of children
+                    F_QUEUED            = 1 << 3,   // Property is in the list of pending notifications
                 };
 
                 enum style_flags_t
@@ -62,6 +64,14 @@ namespace lsp
                     S_CONFIGURED        = 1 << 2,   // The changes to style have been configured
                 };
 
+                typedef union value_t
+                {
+                    ssize_t             iValue;
+                    float               fValue;
+                    bool                bValue;
+                    StringPool::string_t *sValue;
+                } value_t;
+
                 typedef struct property_t
                 {
                     atom_t              id;         // Unique identifier of property
@@ -70,28 +80,23 @@ namespace lsp
                     size_t              changes;    // Number of changes
                     size_t              flags;      // Flags
                     Style              *owner;      // Style that is owning a property
-
-                    union
-                    {
-                        ssize_t             iValue;
-                        float               fValue;
-                        bool                bValue;
-                        char               *sValue;
-                    } v;                            // Actual property value
-
-                    union
-                    {
-                        ssize_t             iValue;
-                        float               fValue;
-                        bool                bValue;
-                        char               *sValue;
-                    } dv;                           // Property local default value
+                    value_t             v;          // Actual property value
+                    value_t             dv;         // Property local default value
                 } property_t;
 
+                /**
+                 * Listener binding. If the style has no local copy of the property, the listener
+                 * is shared: it observes the property of parent style and keeps only the last
+                 * observed value to detect changes. The local copy is created only when the
+                 * property gets set for the style.
+                 */
                 typedef struct listener_t
                 {
                     atom_t              nId;        // Property identifier
                     bool                bNotify;    // Delayed notify flag
+                    bool                bShared;    // Listener observes property of parent style
+                    property_type_t     nType;      // Type of the last observed value of shared listener
+                    value_t             sValue;     // Last observed value of shared listener
                     IStyleListener     *pListener;  // Listener
                 } listener_t;
 
@@ -113,6 +118,8 @@ namespace lsp
                 lltl::darray<property_t>        vProperties;
                 lltl::darray<listener_t>        vListeners;
                 lltl::parray<IStyleListener>    vLocks;
+                lltl::darray<atom_t>            vPending;       // Properties with pending notifications
+                lltl::darray<atom_t>            vNotify;        // Properties being notified
                 mutable Schema                 *pSchema;
                 size_t                          nFlags;
                 char                           *sName;
@@ -134,6 +141,7 @@ namespace lsp
                 void                undef_property(property_t *property);
                 void                do_destroy();
                 void                delayed_notify();
+                void                mark_pending(property_t *prop, size_t flags);
                 property_t         *get_property_recursive(atom_t id);
                 property_t         *get_parent_property(atom_t id);
                 property_t         *get_property(atom_t id);
@@ -156,6 +164,15 @@ namespace lsp
                 size_t              notify_listeners_delayed(property_t *prop);
                 void                deref_property(property_t *prop);
                 status_t            inheritance_tree(lltl::parray<Style> *dst);
+                bool                has_parents(const lltl::parray<Style> *list) const;
+                void                detach_parents();
+                status_t            attach_parents(const lltl::parray<Style> *list);
+                void                refresh_property(atom_t id, lltl::phashset<Style> *visited);
+                void                adopt_listeners(property_t *p);
+                void                share_properties();
+                void                notify_shared(atom_t id, bool force);
+                static void         release_shared(listener_t *lst);
+                static bool         update_shared(listener_t *lst, const property_t *src);
 
                 bool                set_configured(bool set);
                 inline const char  *name() const            { return sName;                 }
@@ -372,6 +389,20 @@ namespace lsp
                  */
                 inline size_t           listeners() const   { return vListeners.size(); }
 
+                /**
+                 * Estimate amount of memory used by the style. String values shared
+                 * with other styles are accounted proportionally to the number of references
+                 * @return amount of memory in bytes
+                 */
+                size_t                  memory_usage() const;
+
+                /**
+                 * Estimate amount of memory used by properties of the style and their values,
+                 * this amount is the part of the amount returned by memory_usage()
+                 * @return amount of memory in bytes
+                 */
+                size_t                  properties_memory_usage() const;
+
             public:
                 /**
                  * Start transactional update of properties.
@@ -566,6 +597,24 @@ namespace lsp
                  * @return atom identifier
                  */
                 const char             *atom_name(atom_t id) const;
+
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix of the
+                 * property descriptor, the list is resolved only once
+                 * @param base base atom
+                 * @param desc property descriptor
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t           *composite_atoms(atom_t base, const prop::desc_t *desc) const;
+
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix,
+                 * the list is resolved only once
+                 * @param base base atom
+                 * @param postfix NULL-terminated statically allocated list of postfixes
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t           *composite_atoms(atom_t base, const char * const *postfix) const;
         };
 
         #define LSP_TK_STYLE_DEF_BEGIN(Name, Parent) \
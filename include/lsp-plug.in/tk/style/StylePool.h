@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_STYLE_STYLEPOOL_H_
+#define LSP_PLUG_IN_TK_STYLE_STYLEPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Pool of worker threads for concurrent resolution of property values of style
+         * sheets. The style sheet parses the XML document sequentially and passes parsed
+         * properties to the pool in batches, so the typed conversion of values overlaps
+         * with parsing of the rest of the document. Resolution of each value does not
+         * depend on other values, so the result is the same as for sequential parsing.
+         *
+         * Worker threads are started on the first batch and persist until the pool is
+         * destroyed or the number of threads changes. Between batches they wait on the
+         * condition variable.
+         */
+        class StylePool
+        {
+            protected:
+                typedef struct batch_t
+                {
+                    StyleSheet                             *sheet;      // Style sheet that owns properties
+                    lltl::parray<StyleSheet::property_t>    props;      // Properties to resolve
+                } batch_t;
+
+            protected:
+                lltl::parray<batch_t>   vQueue;         // Batches pending for resolution
+                lltl::parray<ipc::Thread> vWorkers;     // Worker threads
+                std::mutex              sLock;          // Lock for the queue state
+                std::condition_variable sWork;          // Workers wait for the new batch
+                std::condition_variable sDone;          // Style sheets wait for their batches to complete
+                size_t                  nThreads;       // Number of worker threads
+                size_t                  nResolved;      // Overall number of properties resolved by the pool
+                bool                    bShutdown;      // Workers should terminate
+
+            protected:
+                batch_t                *next_batch(StyleSheet *sheet);
+                void                    resolve(batch_t *batch);
+                void                    start_workers();
+                void                    stop_workers();
+                void                    run_worker();
+
+            protected:
+                static status_t         worker_proc(void *arg);
+
+            public:
+                explicit StylePool();
+                StylePool(const StylePool &) = delete;
+                StylePool(StylePool &&) = delete;
+                ~StylePool();
+
+                StylePool & operator = (const StylePool &) = delete;
+                StylePool & operator = (StylePool &&) = delete;
+
+                /**
+                 * Destroy the pool
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Pass the batch of properties of the style sheet to worker threads.
+                 * Values are resolved by the calling thread if there are no worker threads.
+                 * @param sheet style sheet that owns properties
+                 * @param props properties to resolve, the list is cleared on success
+                 * @return status of operation
+                 */
+                status_t                submit(StyleSheet *sheet, lltl::parray<StyleSheet::property_t> *props);
+
+                /**
+                 * Wait until all submitted batches of the style sheet are resolved. The calling
+                 * thread resolves batches of the style sheet which were not taken by workers yet.
+                 * @param sheet style sheet to wait for
+                 */
+                void                    wait(StyleSheet *sheet);
+
+                /**
+                 * Get number of worker threads
+                 * @return number of worker threads
+                 */
+                inline size_t           threads() const     { return nThreads;          }
+
+                /**
+                 * Set number of worker threads, running workers are stopped if the
+                 * number of threads changes
+                 * @param threads number of worker threads, zero disables concurrent resolution
+                 */
+                void                    set_threads(size_t threads);
+
+                /**
+                 * Get number of started worker threads
+                 * @return number of started worker threads
+                 */
+                inline size_t           workers() const     { return vWorkers.size();   }
+
+                /**
+                 * Get overall number of properties resolved by the pool
+                 * @return overall number of resolved properties
+                 */
+                inline size_t           resolved() const    { return nResolved;         }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_STYLE_STYLEPOOL_H_ */
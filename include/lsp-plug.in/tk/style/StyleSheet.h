@@ -33,12 +33,16 @@
 #include <lsp-plug.in/io/Path.h>
 #include <lsp-plug.in/io/IInStream.h>
 #include <lsp-plug.in/io/IInSequence.h>
+#include <lsp-plug.in/io/IOutStream.h>
 #include <lsp-plug.in/fmt/xml/PullParser.h>
+#include <lsp-plug.in/tk/helpers/digest.h>
 
 namespace lsp
 {
     namespace tk
     {
+        class StylePool;
+
         /**
          * Style sheet class
          *
@@ -47,12 +51,30 @@ namespace lsp
         {
             private:
                 friend class Schema;
+                friend class StylePool;
 
             protected:
+                enum binary_t
+                {
+                    BINARY_VERSION      = 2                             // Version of binary format
+                };
+
+                enum resolve_t
+                {
+                    RESOLVE_BATCH       = 0x400                         // Number of property values passed to the pool at once
+                };
+
                 typedef struct property_t
                 {
                     size_t                                  order;      // Property order
                     LSPString                               value;      // Property value
+                    property_type_t                         type;       // Pre-resolved type of value, PT_UNKNOWN if not resolved
+                    union
+                    {
+                        bool                                bvalue;     // Pre-resolved boolean value
+                        ssize_t                             ivalue;     // Pre-resolved integer value
+                        float                               fvalue;     // Pre-resolved floating-point value
+                    };
                 } property_t;
 
                 typedef struct style_t
@@ -87,6 +109,9 @@ namespace lsp
                 lltl::pphash<LSPString, lsp::Color> vColors;    // Color map
                 lltl::pphash<LSPString, LSPString>  vConstants; // Global constants
                 LSPString                           sError;     // Error text
+                StylePool                          *pPool;      // Pool for concurrent resolution of values
+                lltl::parray<property_t>            vPending;   // Properties pending for submission to the pool
+                size_t                              nBatches;   // Number of batches being resolved by the pool
 
             public:
                 explicit StyleSheet();
@@ -98,6 +123,7 @@ namespace lsp
                 StyleSheet & operator = (StyleSheet &&) = delete;
 
             protected:
+                void                do_destroy();
                 status_t            parse_document(xml::PullParser *p);
                 status_t            parse_schema(xml::PullParser *p);
                 status_t            parse_colors(xml::PullParser *p);
@@ -120,6 +146,13 @@ namespace lsp
                 status_t            validate();
                 status_t            validate_style(style_t *s);
                 static void         drop_paths(lltl::parray<path_t> *paths);
+                static status_t     resolve_value(property_t *prop);
+                status_t            queue_resolve(property_t *prop);
+                void                complete_resolve();
+
+                static status_t     write_style(io::IOutStream *os, const style_t *s);
+                status_t            read_style(style_t *s, const uint8_t **head, const uint8_t *tail);
+                status_t            read_binary(const void *data, size_t size, const digest_t *stamp);
 
             public:
                 status_t            parse_file(const char *path, const char *charset = NULL);
@@ -131,6 +164,50 @@ namespace lsp
                 status_t            parse_data(const LSPString *str);
                 status_t            parse_data(io::IInSequence *seq, size_t flags = WRAP_NONE);
 
+                /**
+                 * Load previously compiled binary representation of the style sheet.
+                 * The style sheet should be empty, it remains empty on error
+                 *
+                 * @param data binary data
+                 * @param size size of binary data
+                 * @param stamp the digest of the source data, the binary representation
+                 *   is treated as outdated if it has been compiled with another digest,
+                 *   NULL matches only binary data compiled without the digest
+                 * @return status of operation, STATUS_UNSUPPORTED_FORMAT if binary data
+                 *   has other version or is outdated
+                 */
+                status_t            load_binary(const void *data, size_t size, const digest_t *stamp = NULL);
+                status_t            load_binary(const io::Path *path, const digest_t *stamp = NULL);
+                status_t            load_binary(const char *path, const digest_t *stamp = NULL);
+
+                /**
+                 * Compile the style sheet into binary representation with pre-resolved
+                 * colors, style relations and property values. The file is written
+                 * to the temporary file first and then renamed, so readers never
+                 * observe partially written data
+                 *
+                 * @param os output stream
+                 * @param stamp the digest of the source data, may be NULL
+                 * @return status of operation
+                 */
+                status_t            save_binary(io::IOutStream *os, const digest_t *stamp = NULL) const;
+                status_t            save_binary(const io::Path *path, const digest_t *stamp = NULL) const;
+                status_t            save_binary(const char *path, const digest_t *stamp = NULL) const;
+
+            public:
+                /**
+                 * Get pool used for concurrent resolution of property values
+                 * @return pool or NULL if values are resolved by the parsing thread
+                 */
+                inline StylePool   *pool()                                          { return pPool;         }
+
+                /**
+                 * Set pool for concurrent resolution of property values while parsing the
+                 * document, the pool should outlive parsing
+                 * @param pool pool or NULL to resolve values by the parsing thread
+                 */
+                inline void         set_pool(StylePool *pool)                       { pPool = pool;         }
+
             public:
                 inline const LSPString *title() const                               { return &sTitle;       }
                 status_t            enum_colors(lltl::parray<LSPString> *names) const;
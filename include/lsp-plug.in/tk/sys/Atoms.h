@@ -44,12 +44,32 @@ namespace lsp
                     char    name[];
                 } atom_id_t;
 
+                typedef struct composite_t
+                {
+                    composite_t    *pNext;      // Next item in the bin
+                    const void     *pKey;       // Table of postfixes
+                    atom_t          nBase;      // Base atom
+                    atom_t          vAtoms[];   // Resolved atoms
+                } composite_t;
+
+                enum composite_flags_t
+                {
+                    COMPOSITE_INITIAL_BINS  = 0x100
+                };
+
                 lltl::parray<atom_id_t> vAtoms;
                 lltl::parray<atom_id_t> vAtomList;
+                composite_t           **vComposite;     // Hash bins of composite atoms
+                size_t                  nCompositeBins; // Number of hash bins
+                size_t                  nComposite;     // Number of composite atom lists
 
             protected:
                 ssize_t                 index_of(const char *name);
                 atom_id_t              *make_atom(const char *name);
+                static inline size_t    composite_hash(atom_t base, const void *key);
+                composite_t            *find_composite(atom_t base, const void *key);
+                composite_t            *make_composite(atom_t base, const void *key, const char * const *postfix, size_t count);
+                bool                    grow_composite();
 
             public:
                 explicit Atoms();
@@ -82,6 +102,30 @@ namespace lsp
                  * @return atom identifier
                  */
                 const char         *atom_name(atom_t id) const;
+
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix of the
+                 * property descriptor. The list is resolved once per base atom and descriptor
+                 * and remains valid until the atom collection is destroyed
+                 * @param base base atom
+                 * @param desc property descriptor terminated by the element with NULL postfix
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t       *composite_atoms(atom_t base, const prop::desc_t *desc);
+
+                /**
+                 * Get list of atoms formed by the name of base atom and each postfix
+                 * @param base base atom
+                 * @param postfix NULL-terminated list of postfixes, should be statically allocated
+                 * @return list of atoms or NULL on error
+                 */
+                const atom_t       *composite_atoms(atom_t base, const char * const *postfix);
+
+                /**
+                 * Get number of cached lists of composite atoms
+                 * @return number of cached lists
+                 */
+                inline size_t       composites() const              { return nComposite;                            }
         };
     
     } /* namespace tk */
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_SYS_BITMAPCACHE_H_
+#define LSP_PLUG_IN_TK_SYS_BITMAPCACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/mm/Bitmap.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * List of pre-scaled versions of the bitmap, recently used versions are kept
+         */
+        class ScaledBitmaps
+        {
+            public:
+                static constexpr size_t MAX_ITEMS       = 4;
+                static constexpr size_t MAX_PIXELS      = 0x1000000;
+
+            protected:
+                lltl::parray<mm::Bitmap>    vItems;     // Pre-scaled bitmaps, most recently used first
+
+            public:
+                explicit ScaledBitmaps();
+                ScaledBitmaps(const ScaledBitmaps &) = delete;
+                ScaledBitmaps(ScaledBitmaps &&) = delete;
+                ~ScaledBitmaps();
+
+                ScaledBitmaps & operator = (const ScaledBitmaps &) = delete;
+                ScaledBitmaps & operator = (ScaledBitmaps &&) = delete;
+
+            public:
+                /**
+                 * Get the version of the bitmap scaled to the specified size
+                 * @param src source bitmap
+                 * @param width width of the scaled bitmap
+                 * @param height height of the scaled bitmap
+                 * @return pointer to the scaled bitmap or NULL on error or if the size is too large
+                 */
+                const mm::Bitmap       *get(const mm::Bitmap *src, size_t width, size_t height);
+
+                /**
+                 * Drop all pre-scaled versions
+                 */
+                void                    clear();
+
+                /**
+                 * Get number of pre-scaled versions
+                 * @return number of pre-scaled versions
+                 */
+                inline size_t           size() const        { return vItems.size();     }
+        };
+
+        /**
+         * Display-level cache of decoded bitmaps. Bitmaps are identified by the path of the
+         * resource and the color map used for decoding, widgets that load the same image
+         * share the single decoded bitmap and its pre-scaled versions. The decoded bitmap
+         * is freed when the last reference to it is released.
+         * The cache and the reference counters of images are not thread-safe: images should
+         * be acquired, released and drawn only by the thread that runs the main loop.
+         */
+        class BitmapCache
+        {
+            public:
+                typedef struct image_t image_t;
+
+            protected:
+                lltl::parray<image_t>   vItems;     // Decoded images
+
+            protected:
+                image_t                *lookup(const LSPString *path, mm::IColorMap *map);
+                void                    unlink(image_t *image);
+
+            public:
+                explicit BitmapCache();
+                BitmapCache(const BitmapCache &) = delete;
+                BitmapCache(BitmapCache &&) = delete;
+                ~BitmapCache();
+
+                BitmapCache & operator = (const BitmapCache &) = delete;
+                BitmapCache & operator = (BitmapCache &&) = delete;
+
+                /**
+                 * Detach all images from the cache. Images that are still referenced
+                 * are freed when the last reference is released.
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Obtain the decoded image, decode it if it is not present in the cache
+                 * @param image pointer to store the image handle
+                 * @param path path to the image
+                 * @param map color map used for decoding, may be NULL
+                 * @return status of operation
+                 */
+                status_t                acquire(image_t **image, const LSPString *path, mm::IColorMap *map = NULL);
+
+                /**
+                 * Obtain the decoded image, decode it if it is not present in the cache
+                 * @param image pointer to store the image handle
+                 * @param path path to the image
+                 * @param map color map used for decoding, may be NULL
+                 * @return status of operation
+                 */
+                status_t                acquire(image_t **image, const char *path, mm::IColorMap *map = NULL);
+
+                /**
+                 * Get number of decoded images
+                 * @return number of decoded images
+                 */
+                inline size_t           size() const        { return vItems.size();     }
+
+            public:
+                /**
+                 * Add reference to the image
+                 * @param image image handle
+                 * @return image handle
+                 */
+                static image_t         *retain(image_t *image);
+
+                /**
+                 * Release the reference to the image
+                 * @param image pointer to the image handle, will be reset to NULL
+                 */
+                static void             release(image_t **image);
+
+                /**
+                 * Get the decoded bitmap
+                 * @param image image handle
+                 * @return decoded bitmap
+                 */
+                static const mm::Bitmap *bitmap(const image_t *image);
+
+                /**
+                 * Get the version of the decoded bitmap scaled to the specified size
+                 * @param image image handle
+                 * @param width width of the scaled bitmap
+                 * @param height height of the scaled bitmap
+                 * @return pointer to the scaled bitmap or NULL on error or if the size is too large
+                 */
+                static const mm::Bitmap *scaled(image_t *image, size_t width, size_t height);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_BITMAPCACHE_H_ */
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_SYS_BLOCKPOOL_H_
+#define LSP_PLUG_IN_TK_SYS_BLOCKPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Pool of fixed-size memory blocks. Blocks are carved from large chunks
+         * and recycled through the free list, so allocation and release of many
+         * small objects of the same size turns into a handful of bulk allocations.
+         * The memory of chunks is returned to the system only when the pool is
+         * destroyed.
+         *
+         * The pool created by create() is reference-counted: each user acquires
+         * a reference and the pool deletes itself with all chunks when the last
+         * reference is released, so blocks stay valid while any user holds them.
+         * Reference counting is not thread-safe, the pool should be accessed from
+         * the single thread.
+         */
+        class BlockPool
+        {
+            public:
+                static constexpr size_t DEFAULT_CHUNK_SIZE  = 0x4000;       // 16 KB
+
+            protected:
+                typedef struct block_t
+                {
+                    block_t            *pNext;          // Next free block
+                } block_t;
+
+                typedef struct chunk_t
+                {
+                    chunk_t            *pNext;          // Next chunk
+                    size_t              nSize;          // Size of chunk in bytes
+                } chunk_t;
+
+            protected:
+                chunk_t                *pChunks;        // List of allocated chunks
+                block_t                *pFree;          // List of free blocks
+                size_t                  nBlockSize;     // Size of the block
+                size_t                  nChunkSize;     // Size of the chunk
+                size_t                  nChunks;        // Number of allocated chunks
+                size_t                  nAllocated;     // Number of blocks in use
+                size_t                  nReferences;    // Number of references
+                bool                    bDynamic;       // The pool has been created by create()
+
+            protected:
+                bool                    grow();
+
+            public:
+                explicit BlockPool(size_t block_size = 0, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+                BlockPool(const BlockPool &) = delete;
+                BlockPool(BlockPool &&) = delete;
+                ~BlockPool();
+
+                BlockPool & operator = (const BlockPool &) = delete;
+                BlockPool & operator = (BlockPool &&) = delete;
+
+                /**
+                 * Release all chunks of the pool. All blocks allocated from the pool
+                 * become invalid.
+                 */
+                void                    destroy();
+
+                /**
+                 * Create reference-counted pool with one reference held by the caller
+                 * @param block_size size of the block
+                 * @param chunk_size size of the chunk
+                 * @return pointer to the pool or NULL if no memory
+                 */
+                static BlockPool       *create(size_t block_size, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+                /**
+                 * Acquire reference to the pool
+                 * @return pointer to the pool
+                 */
+                BlockPool              *acquire();
+
+                /**
+                 * Release reference to the pool. The pool created by create() is deleted
+                 * when the last reference is released.
+                 */
+                void                    release();
+
+            public:
+                /**
+                 * Set the size of the block, allowed only when the pool has no chunks allocated
+                 * @param size size of the block
+                 * @return status of operation
+                 */
+                status_t                set_block_size(size_t size);
+
+                /**
+                 * Get the size of the block
+                 * @return size of the block
+                 */
+                inline size_t           block_size() const  { return nBlockSize;                }
+
+                /**
+                 * Allocate block
+                 * @return pointer to the block or NULL if no memory or block size is not set
+                 */
+                void                   *alloc();
+
+                /**
+                 * Return block to the pool
+                 * @param ptr pointer to the block previously allocated by alloc()
+                 */
+                void                    free(void *ptr);
+
+                /**
+                 * Get number of blocks in use
+                 * @return number of blocks in use
+                 */
+                inline size_t           allocated() const   { return nAllocated;                }
+
+                /**
+                 * Get number of chunks allocated by the pool
+                 * @return number of chunks allocated by the pool
+                 */
+                inline size_t           chunks() const      { return nChunks;                   }
+
+                /**
+                 * Get amount of memory allocated by the pool
+                 * @return amount of memory in bytes
+                 */
+                inline size_t           memory() const      { return nChunks * nChunkSize;      }
+
+                /**
+                 * Get number of references to the pool
+                 * @return number of references to the pool
+                 */
+                inline size_t           references() const  { return nReferences;               }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_BLOCKPOOL_H_ */
@@ -31,8 +31,10 @@
 #include <lsp-plug.in/ws/IDataSource.h>
 #include <lsp-plug.in/ws/IDataSink.h>
 #include <lsp-plug.in/i18n/IDictionary.h>
+#include <lsp-plug.in/lltl/darray.h>
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/io/OutMemoryStream.h>
 
 namespace lsp
 {
@@ -40,6 +42,7 @@ namespace lsp
     {
         class Widget;
         class SlotSet;
+        struct shared_stylesheet_t;
 
         /** Main display
          *
@@ -56,24 +59,58 @@ namespace lsp
                     char           *id;
                 } item_t;
 
+                typedef struct relayout_t
+                {
+                    Widget             *pWidget;
+                    ws::size_limit_t    sLimit;
+                } relayout_t;
+
+                typedef struct stylesheet_source_t
+                {
+                    Display                *display;
+                    io::OutMemoryStream     data;
+                    digest_t                stamp;
+                } stylesheet_source_t;
+
             protected:
                 lltl::parray<item_t>    sWidgets;
                 lltl::parray<Widget>    vGarbage;
+                lltl::darray<relayout_t> vRelayout;
                 ipc::Mutex              sLock;
 
                 SlotSet                 sSlots;
                 Schema                  sSchema;
+                GlassCache              sGlassCache;
+                PaletteCache            sPaletteCache;
+                BitmapCache             sBitmapCache;
+                RenderPool              sRenderPool;
+                StylePool               sStylePool;
+                Mailbox                 sMailbox;
 
                 i18n::IDictionary      *pDictionary;
                 ws::IDisplay           *pDisplay;
+                HeadlessDisplay        *pHeadless;
 
                 resource::ILoader      *pResourceLoader;
                 resource::Environment  *pEnv;
+                shared_stylesheet_t    *pSharedSheet;
+                bool                    bSharedSchema;
+                BlockPool              *pSlotPool;
+                bool                    bHeadless;
+                layout_stats_t          sLayoutStats;
+                size_t                  nLayoutStart;
 
             protected:
                 void                do_destroy();
+                void                free_display(ws::IDisplay *dpy);
                 void                garbage_collect();
                 status_t            init_schema();
+                status_t            read_stylesheet(io::OutMemoryStream *data, digest_t *stamp, const char *path);
+                status_t            load_stylesheet(StyleSheet *sheet, const char *path);
+                status_t            load_stylesheet(StyleSheet *sheet, const io::OutMemoryStream *data, const digest_t *stamp);
+
+            protected:
+                static status_t     load_shared_stylesheet(StyleSheet *sheet, void *arg);
 
             protected:
                 static status_t     main_task_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
@@ -223,6 +260,19 @@ namespace lsp
                  */
                 inline bool unlock()                        { return sLock.unlock();    }
 
+                /**
+                 * Post update to be executed by the main loop at the beginning of the next
+                 * iteration. Can be called from any thread, does not lock the main event loop.
+                 *
+                 * @param handler update handler
+                 * @param data data to copy and pass to the handler, may be NULL
+                 * @param size size of data to copy, should not exceed Mailbox::MAX_DATA_SIZE
+                 * @param release handler to release the data if the update is dropped on destroy, may be NULL
+                 * @return status of operation, STATUS_OVERFLOW if too many updates are pending
+                 */
+                inline status_t post(update_handler_t handler, const void *data = NULL, size_t size = 0, release_handler_t release = NULL)
+                                                            { return sMailbox.post(handler, data, size, release); }
+
             //---------------------------------------------------------------------------------
             // Properties
             public:
@@ -232,6 +282,42 @@ namespace lsp
                  */
                 inline Schema  *schema()                    { return &sSchema; }
 
+                /**
+                 * Get shared cache of glass surfaces
+                 * @return shared cache of glass surfaces
+                 */
+                inline GlassCache *glass_cache()            { return &sGlassCache; }
+
+                /**
+                 * Get shared cache of colors with applied brightness
+                 * @return shared cache of colors with applied brightness
+                 */
+                inline PaletteCache *palette_cache()        { return &sPaletteCache; }
+
+                /**
+                 * Get shared cache of decoded bitmaps
+                 * @return shared cache of decoded bitmaps
+                 */
+                inline BitmapCache *bitmap_cache()          { return &sBitmapCache; }
+
+                /**
+                 * Get pool of workers for concurrent drawing of widget surfaces
+                 * @return pool of workers or NULL if concurrent drawing is disabled
+                 */
+                inline RenderPool *render_pool()            { return (sRenderPool.threads() > 0) ? &sRenderPool : NULL; }
+
+                /**
+                 * Check that widget surfaces are being drawn concurrently at this moment
+                 * @return true if widget surfaces are being drawn concurrently
+                 */
+                inline bool concurrent_draw() const         { return sRenderPool.active(); }
+
+                /**
+                 * Get pool for allocation of widget slots
+                 * @return pool for allocation of widget slots or NULL if pooled allocation is disabled
+                 */
+                inline BlockPool  *slot_pool()              { return pSlotPool; }
+
                 /** Get slots
                  *
                  * @return slots
@@ -251,6 +337,12 @@ namespace lsp
                  */
                 inline ws::IDisplay *display()              { return pDisplay; }
 
+                /**
+                 * Get the headless display
+                 * @return headless display or NULL if the display uses the windowing system
+                 */
+                inline HeadlessDisplay *headless()          { return pHeadless; }
+
                 /**
                  * Obtain number of screens
                  * @return number of screens
@@ -343,6 +435,66 @@ namespace lsp
                  */
                 status_t queue_destroy(Widget *widget);
 
+                /**
+                 * Queue widget for relayout confined to it's current allocation. The queue is
+                 * processed by the window before each layout pass.
+                 *
+                 * @param widget widget to queue
+                 * @param limit size limits of the widget at the moment of queueing
+                 * @return status of operation
+                 */
+                status_t queue_relayout(Widget *widget, const ws::size_limit_t *limit);
+
+                /**
+                 * Remove widget from the relayout queue
+                 * @param widget widget to remove
+                 */
+                void cancel_relayout(Widget *widget);
+
+                /**
+                 * Process all widgets in the relayout queue that belong to the specified toplevel widget
+                 * @param toplevel toplevel widget
+                 * @return number of widgets which relayout has been confined to their allocation
+                 */
+                size_t process_relayout(Widget *toplevel);
+
+                /**
+                 * Mark the start of the layout pass
+                 */
+                inline void begin_layout()                  { nLayoutStart = sLayoutStats.nRealized; }
+
+                /**
+                 * Mark the end of the layout pass and update statistics
+                 * @param partial the layout pass has been confined to widget subtrees
+                 */
+                void end_layout(bool partial);
+
+                /**
+                 * Count the call of widget's realize
+                 */
+                inline void count_realize()                 { ++sLayoutStats.nRealized; }
+
+                /**
+                 * Get statistics of layout passes
+                 * @return statistics of layout passes
+                 */
+                inline const layout_stats_t *layout_stats() const { return &sLayoutStats; }
+
+                /**
+                 * Reset statistics of layout passes
+                 */
+                void reset_layout_stats();
+
+                /**
+                 * Perform the census of widgets registered in the display: count instances
+                 * and estimate memory used by widgets of each class. Memory of shared glass
+                 * surfaces is not accounted to widgets and is reported by the glass cache.
+                 *
+                 * @param dst list to store one record per widget class
+                 * @return status of operation
+                 */
+                status_t census(lltl::darray<w_census_t> *dst);
+
                 /** Enumerate all monitors in the system for the display,
                  * the resultint pointer is valid until the next enum_monitors() call.
                  *
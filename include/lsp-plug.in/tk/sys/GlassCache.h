@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_SYS_GLASSCACHE_H_
+#define LSP_PLUG_IN_TK_SYS_GLASSCACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Display-level cache of pre-rendered glass surfaces. Widgets with identical
+         * glass parameters share the same off-screen surface. Unused surfaces are kept
+         * for further reuse and evicted in least-recently-used order when the memory
+         * occupied by the cache exceeds the budget. Glasses still held by widgets when
+         * the cache is destroyed are detached from it and freed on the last release.
+         */
+        class GlassCache
+        {
+            public:
+                typedef struct glass_t glass_t;
+
+                static constexpr size_t DEFAULT_BUDGET      = 0x1000000;    // 16 MB
+
+            protected:
+                enum glass_type_t
+                {
+                    GT_GLASS,
+                    GT_BORDER_GLASS
+                };
+
+            protected:
+                lltl::parray<glass_t>   vItems;         // List of cached items
+                glass_t                *pHead;          // Most recently used unreferenced item
+                glass_t                *pTail;          // Least recently used unreferenced item
+                size_t                  nBudget;        // Memory budget
+                size_t                  nUsed;          // Amount of memory used by surfaces
+
+            protected:
+                glass_t                *lookup(const glass_t *key);
+                ws::ISurface           *acquire(glass_t **g, ws::ISurface *s, const glass_t *key);
+                void                    drop(glass_t *item);
+                void                    drop_surface(glass_t *item);
+                void                    evict(size_t budget);
+                void                    link_lru(glass_t *item);
+                void                    unlink_lru(glass_t *item);
+                void                    do_release(glass_t *item);
+                static bool             match(const glass_t *a, const glass_t *b);
+                static void             init_key(glass_t *key,
+                    glass_type_t type,
+                    const lsp::Color &gc, const lsp::Color *bc,
+                    size_t mask, ssize_t thick, ssize_t radius,
+                    size_t width, size_t height, bool flat);
+
+            public:
+                explicit GlassCache();
+                GlassCache(const GlassCache &) = delete;
+                GlassCache(GlassCache &&) = delete;
+                ~GlassCache();
+
+                GlassCache & operator = (const GlassCache &) = delete;
+                GlassCache & operator = (GlassCache &&) = delete;
+
+                /**
+                 * Destroy all cached surfaces. Items that are still referenced
+                 * by widgets are detached from the cache and freed by the last
+                 * release() call.
+                 */
+                void                    destroy();
+
+            public:
+                /** Obtain shared glass
+                 *
+                 * @param g pointer to the handle of the glass held by the widget (may be updated)
+                 * @param s the factory surface
+                 * @param c color of the glass
+                 * @param mask the radius drawing mask
+                 * @param radius the radius of the glass
+                 * @param width the width of the glass
+                 * @param height the height of the glass
+                 * @return pointer to the glass surface on success or null on error
+                 */
+                ws::ISurface           *glass(glass_t **g, ws::ISurface *s,
+                    const lsp::Color &c,
+                    size_t mask, ssize_t radius, size_t width, size_t height);
+
+                /** Obtain shared glass with border
+                 *
+                 * @param g pointer to the handle of the glass held by the widget (may be updated)
+                 * @param s the factory surface
+                 * @param gc the color of the glass
+                 * @param bc the color of the border
+                 * @param mask the radius drawing mask
+                 * @param thick the thickness of the border
+                 * @param radius the radius of the glass
+                 * @param width the width of the glass
+                 * @param height the height of the glass
+                 * @param flat use flat border painting insetad of gradient
+                 * @return pointer to the glass surface on success or null on error
+                 */
+                ws::ISurface           *border_glass(glass_t **g, ws::ISurface *s,
+                    const lsp::Color &gc, const lsp::Color &bc,
+                    size_t mask, ssize_t thick, ssize_t radius,
+                    size_t width, size_t height, bool flat);
+
+                /**
+                 * Release the glass previously obtained by the widget, can be called
+                 * after the cache has been destroyed
+                 * @param g pointer to the handle of the glass held by the widget, will be reset to NULL
+                 */
+                static void             release(glass_t **g);
+
+                /**
+                 * Get the memory budget of the cache
+                 * @return memory budget in bytes
+                 */
+                inline size_t           budget() const      { return nBudget;           }
+
+                /**
+                 * Set the memory budget of the cache, evict unused surfaces if necessary
+                 * @param budget memory budget in bytes
+                 */
+                void                    set_budget(size_t budget);
+
+                /**
+                 * Get amount of memory occupied by cached surfaces
+                 * @return amount of memory in bytes
+                 */
+                inline size_t           used() const        { return nUsed;             }
+
+                /**
+                 * Get number of cached surfaces
+                 * @return number of cached surfaces
+                 */
+                inline size_t           size() const        { return vItems.size();     }
+
+                /**
+                 * Drop all surfaces that are not referenced by widgets
+                 */
+                void                    gc();
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_GLASSCACHE_H_ */
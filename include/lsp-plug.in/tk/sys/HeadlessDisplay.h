@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_SYS_HEADLESSDISPLAY_H_
+#define LSP_PLUG_IN_TK_SYS_HEADLESSDISPLAY_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/IDisplay.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class HeadlessWindow;
+
+        /**
+         * Display which does not require any windowing system. Windows are kept in memory
+         * and render into in-memory surfaces, so the rendering and layout code can be
+         * executed and measured on any system. Events are queued and delivered to the
+         * windows by the main loop of the display in the order of sending.
+         */
+        class HeadlessDisplay: public ws::IDisplay
+        {
+            protected:
+                typedef struct pending_t
+                {
+                    HeadlessWindow             *pWindow;        // Target window
+                    ws::event_t                 sEvent;         // Event
+                } pending_t;
+
+            protected:
+                lltl::parray<HeadlessWindow>    vWindows;       // List of windows
+                lltl::darray<pending_t>         vPending;       // Pending events
+                size_t                          nScreenWidth;   // Width of the screen
+                size_t                          nScreenHeight;  // Height of the screen
+                bool                            bQuit;          // Quit the main loop
+
+            protected:
+                size_t                      dispatch_events();
+
+            public:
+                explicit HeadlessDisplay();
+                HeadlessDisplay(const HeadlessDisplay &) = delete;
+                HeadlessDisplay(HeadlessDisplay &&) = delete;
+                virtual ~HeadlessDisplay() override;
+
+                HeadlessDisplay & operator = (const HeadlessDisplay &) = delete;
+                HeadlessDisplay & operator = (HeadlessDisplay &&) = delete;
+
+                virtual status_t            init(int argc, const char **argv) override;
+                virtual void                destroy() override;
+
+            public:
+                virtual status_t            main() override;
+                virtual status_t            main_iteration() override;
+                virtual void                quit_main() override;
+                virtual status_t            wait_events(wssize_t millis) override;
+
+                virtual ws::IWindow        *create_window() override;
+                virtual ws::IWindow        *create_window(size_t screen) override;
+                virtual ws::IWindow        *create_window(void *handle) override;
+                virtual ws::ISurface       *create_surface(size_t width, size_t height) override;
+
+                virtual size_t              screens() override;
+                virtual size_t              default_screen() override;
+                virtual status_t            screen_size(size_t screen, ssize_t *w, ssize_t *h) override;
+                virtual status_t            work_area_geometry(ws::rectangle_t *r) override;
+
+                virtual status_t            add_font(const char *name, const char *path) override;
+                virtual status_t            add_font(const char *name, const io::Path *path) override;
+                virtual status_t            add_font(const char *name, const LSPString *path) override;
+                virtual status_t            add_font(const char *name, io::IInStream *is) override;
+                virtual status_t            add_font_alias(const char *name, const char *alias) override;
+                virtual status_t            remove_font(const char *name) override;
+                virtual void                remove_all_fonts() override;
+
+                virtual bool                get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp) override;
+                virtual bool                get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text) override;
+                virtual bool                get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last) override;
+
+            public:
+                /**
+                 * Register the window, called by the window on initialization
+                 * @param wnd window to register
+                 * @return status of operation
+                 */
+                status_t                    attach(HeadlessWindow *wnd);
+
+                /**
+                 * Unregister the window and drop all pending events of the window
+                 * @param wnd window to unregister
+                 */
+                void                        detach(HeadlessWindow *wnd);
+
+                /**
+                 * Queue synthetic event, it will be delivered to the window by the next
+                 * iteration of the main loop
+                 * @param wnd target window
+                 * @param ev event to deliver
+                 * @return status of operation
+                 */
+                status_t                    send_event(ws::IWindow *wnd, const ws::event_t *ev);
+
+                /**
+                 * Set the size of the virtual screen
+                 * @param width width of the screen
+                 * @param height height of the screen
+                 */
+                void                        set_screen_size(size_t width, size_t height);
+
+                /**
+                 * Get number of windows
+                 * @return number of windows
+                 */
+                inline size_t               windows() const             { return vWindows.size(); }
+
+                /**
+                 * Get window
+                 * @param index index of the window
+                 * @return window or NULL
+                 */
+                inline HeadlessWindow      *window(size_t index)        { return vWindows.get(index); }
+
+                /**
+                 * Get number of events pending for delivery
+                 * @return number of events pending for delivery
+                 */
+                inline size_t               pending() const             { return vPending.size(); }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_HEADLESSDISPLAY_H_ */
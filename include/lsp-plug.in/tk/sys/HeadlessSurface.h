@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_SYS_HEADLESSSURFACE_H_
+#define LSP_PLUG_IN_TK_SYS_HEADLESSSURFACE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * In-memory drawing surface used by the headless display. Pixels are stored
+         * in the 32-bit premultiplied ARGB format. All primitives are rasterized in
+         * software without antialiasing: a pixel is covered when its center is inside
+         * the shape, shapes are filled using the non-zero winding rule. Linear and radial
+         * gradients are supported. Text is rendered with estimated metrics, each glyph
+         * is drawn as a filled box.
+         */
+        class HeadlessSurface: public ws::ISurface
+        {
+            protected:
+                typedef struct point_t
+                {
+                    float                       x, y;
+                } point_t;
+
+                typedef struct edge_t
+                {
+                    float                       x0, y0;         // Top point of the edge
+                    float                       y1;             // Bottom coordinate of the edge
+                    float                       k;              // Change of X per one pixel of Y
+                    ssize_t                     dir;            // Winding direction
+                } edge_t;
+
+                typedef struct crossing_t
+                {
+                    float                       x;              // Coordinate of the crossing
+                    ssize_t                     dir;            // Winding direction
+                } crossing_t;
+
+            protected:
+                uint32_t                   *vData;          // Pixel data
+                uint8_t                    *pBuffer;        // Allocated buffer
+                size_t                      nCols;          // Width of the surface in pixels
+                size_t                      nRows;          // Height of the surface in pixels
+                ws::rectangle_t             sClip;          // Current clipping rectangle
+                lltl::darray<ws::rectangle_t> vClips;       // Stack of clipping rectangles
+                lltl::darray<point_t>       vPoints;        // Points of the contour being built
+                lltl::darray<edge_t>        vEdges;         // Edges of the path being filled
+                lltl::darray<crossing_t>    vCrossings;     // Crossings of the scan line with edges
+
+            protected:
+                void                        fill(uint32_t color, float left, float top, float width, float height);
+                void                        blit(const void *data, size_t width, size_t height, size_t stride,
+                                                 float x, float y, float sx, float sy, float a);
+
+                // Path construction, contours are closed automatically
+                void                        add_point(float x, float y);
+                void                        add_arc(float cx, float cy, float r, float a1, float a2);
+                void                        close_contour(ssize_t orient);
+                void                        add_polygon(const float *x, const float *y, size_t n, ssize_t orient);
+                void                        add_round_rect(size_t mask, float radius, float left, float top, float width, float height, ssize_t orient);
+                void                        add_circle(float cx, float cy, float r, ssize_t orient);
+                void                        add_segment(float x0, float y0, float x1, float y1, float width);
+                void                        add_polyline(const float *x, const float *y, size_t n, float width);
+                void                        add_parametric(point_t *p, float a, float b, float c, float left, float right, float top, float bottom);
+
+                // Rasterization of the path
+                void                        fill_path(uint32_t color, ws::IGradient *g);
+                void                        fill_span(uint32_t *row, ssize_t y, ssize_t left, ssize_t right, uint32_t color, ws::IGradient *g);
+                void                        draw_glyphs(const ws::Font &f, uint32_t color, float x, float y, const lsp_wchar_t *text, size_t length);
+                void                        draw_glyphs(const ws::Font &f, uint32_t color, float x, float y, const char *text);
+
+            public:
+                explicit HeadlessSurface(size_t width, size_t height);
+                HeadlessSurface(const HeadlessSurface &) = delete;
+                HeadlessSurface(HeadlessSurface &&) = delete;
+                virtual ~HeadlessSurface() override;
+
+                HeadlessSurface & operator = (const HeadlessSurface &) = delete;
+                HeadlessSurface & operator = (HeadlessSurface &&) = delete;
+
+            public:
+                virtual ws::ISurface       *create(size_t width, size_t height) override;
+                virtual void                destroy() override;
+
+                virtual void                clear(const Color &color) override;
+                virtual void                clear_rgb(uint32_t color) override;
+                virtual void                clear_rgba(uint32_t color) override;
+
+                virtual void                fill_rect(const Color &color, size_t mask, float radius, float left, float top, float width, float height) override;
+                virtual void                fill_rect(const Color &color, size_t mask, float radius, const ws::rectangle_t *r) override;
+
+                virtual ws::IGradient      *linear_gradient(float x0, float y0, float x1, float y1) override;
+                virtual ws::IGradient      *radial_gradient(float cx0, float cy0, float cx1, float cy1, float r) override;
+
+                virtual void                fill_rect(ws::IGradient *g, size_t mask, float radius, float left, float top, float width, float height) override;
+                virtual void                fill_rect(ws::IGradient *g, size_t mask, float radius, const ws::rectangle_t *r) override;
+                virtual void                wire_rect(const Color &color, size_t mask, float radius, float left, float top, float width, float height, float line_width) override;
+                virtual void                wire_rect(const Color &color, size_t mask, float radius, const ws::rectangle_t *rect, float line_width) override;
+                virtual void                wire_rect(ws::IGradient *g, size_t mask, float radius, float left, float top, float width, float height, float line_width) override;
+                virtual void                wire_rect(ws::IGradient *g, size_t mask, float radius, const ws::rectangle_t *rect, float line_width) override;
+                virtual void                fill_frame(const Color &color, size_t flags, float radius,
+                                                 float fx, float fy, float fw, float fh,
+                                                 float ix, float iy, float iw, float ih) override;
+                virtual void                fill_frame(const Color &color, size_t flags, float radius, const ws::rectangle_t *out, const ws::rectangle_t *in) override;
+
+                virtual void                fill_sector(const Color &color, float cx, float cy, float radius, float angle1, float angle2) override;
+                virtual void                fill_triangle(ws::IGradient *g, float x0, float y0, float x1, float y1, float x2, float y2) override;
+                virtual void                fill_triangle(const Color &color, float x0, float y0, float x1, float y1, float x2, float y2) override;
+                virtual void                fill_circle(const Color &color, float x, float y, float r) override;
+                virtual void                fill_circle(ws::IGradient *g, float x, float y, float r) override;
+                virtual void                wire_arc(const Color &color, float x, float y, float r, float a1, float a2, float width) override;
+
+                virtual void                fill_poly(const Color &color, const float *x, const float *y, size_t n) override;
+                virtual void                fill_poly(ws::IGradient *g, const float *x, const float *y, size_t n) override;
+                virtual void                wire_poly(const Color &color, float width, const float *x, const float *y, size_t n) override;
+                virtual void                draw_poly(const Color &fill, const Color &wire, float width, const float *x, const float *y, size_t n) override;
+
+                virtual void                square_dot(const Color &color, float x, float y, float width) override;
+                virtual void                square_dot(float x, float y, float width, float r, float g, float b, float a) override;
+                virtual void                line(const Color &color, float x0, float y0, float x1, float y1, float width) override;
+                virtual void                line(ws::IGradient *g, float x0, float y0, float x1, float y1, float width) override;
+                virtual void                parametric_line(const Color &color, float a, float b, float c, float width) override;
+                virtual void                parametric_line(const Color &color, float a, float b, float c,
+                                                 float left, float right, float top, float bottom, float width) override;
+                virtual void                parametric_bar(ws::IGradient *g,
+                                                 float a1, float b1, float c1, float a2, float b2, float c2,
+                                                 float left, float right, float top, float bottom) override;
+
+                virtual void                out_text(const ws::Font &f, const Color &color, float x, float y, const char *text) override;
+                virtual void                out_text(const ws::Font &f, const Color &color, float x, float y, const LSPString *text, ssize_t first, ssize_t last) override;
+                virtual void                out_text_relative(const ws::Font &f, const Color &color, float x, float y, float dx, float dy, const char *text) override;
+                virtual void                out_text_relative(const ws::Font &f, const Color &color, float x, float y, float dx, float dy,
+                                                 const LSPString *text, ssize_t first, ssize_t last) override;
+
+                virtual void                draw(ws::ISurface *s, float x, float y, float sx, float sy, float a) override;
+                virtual void                draw_rotate(ws::ISurface *s, float x, float y, float sx, float sy, float ra, float a) override;
+                virtual void                draw_clipped(ws::ISurface *s, float x, float y, float sx, float sy, float sw, float sh, float a) override;
+                virtual void                draw_raw(const void *data, size_t width, size_t height, size_t stride,
+                                                 float x, float y, float sx, float sy, float a) override;
+
+                virtual void                clip_begin(float x, float y, float w, float h) override;
+                virtual void                clip_end() override;
+
+                virtual bool                get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp) override;
+                virtual bool                get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text) override;
+                virtual bool                get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last) override;
+
+            public:
+                /**
+                 * Get pixel data of the surface
+                 * @return pointer to the first row of pixels in premultiplied ARGB format
+                 */
+                inline const uint32_t      *data() const            { return vData; }
+
+                /**
+                 * Get the size of the row of pixels
+                 * @return size of the row in bytes
+                 */
+                inline size_t               stride() const          { return nCols * sizeof(uint32_t); }
+
+                /**
+                 * Read single pixel
+                 * @param x horizontal coordinate
+                 * @param y vertical coordinate
+                 * @return pixel in premultiplied ARGB format, zero for out-of-range coordinates
+                 */
+                uint32_t                    pixel(ssize_t x, ssize_t y) const;
+
+                /**
+                 * Copy pixels of the surface
+                 * @param dst destination buffer
+                 * @param stride size of the row of the destination buffer in bytes
+                 */
+                void                        read_pixels(void *dst, size_t stride) const;
+
+            public:
+                /**
+                 * Estimate font parameters without any font rasterizer
+                 * @param f font
+                 * @param fp font parameters to store
+                 */
+                static void                 estimate_font(const ws::Font &f, ws::font_parameters_t *fp);
+
+                /**
+                 * Estimate text parameters without any font rasterizer: each glyph is
+                 * considered to have the same advance
+                 * @param f font
+                 * @param tp text parameters to store
+                 * @param length number of glyphs
+                 */
+                static void                 estimate_text(const ws::Font &f, ws::text_parameters_t *tp, size_t length);
+
+                /**
+                 * Get number of glyphs in the UTF-8 encoded text
+                 * @param text UTF-8 encoded text
+                 * @return number of glyphs
+                 */
+                static size_t               glyphs(const char *text);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_HEADLESSSURFACE_H_ */
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_SYS_HEADLESSWINDOW_H_
+#define LSP_PLUG_IN_TK_SYS_HEADLESSWINDOW_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/IWindow.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class HeadlessDisplay;
+        class HeadlessSurface;
+
+        /**
+         * Window of the headless display. The window does not have any native
+         * representation, it just keeps the geometry and the state requested by
+         * the toolkit and renders into the in-memory surface. Geometry and visibility
+         * changes are reported to the event handler by the main loop of the display.
+         */
+        class HeadlessWindow: public ws::IWindow
+        {
+            private:
+                friend class HeadlessDisplay;
+
+            protected:
+                HeadlessDisplay            *pHeadless;          // Headless display
+                HeadlessSurface            *pSurface;           // Surface
+                size_t                      nScreen;            // Screen
+                bool                        bVisible;           // Visibility flag
+                ws::rectangle_t             sGeometry;          // Geometry of the window
+                ws::size_limit_t            sConstraints;       // Size constraints
+                ws::border_style_t          enBorderStyle;      // Border style
+                ws::mouse_pointer_t         enPointer;          // Mouse pointer
+                size_t                      nActions;           // Window actions
+                LSPString                   sCaption;           // Window caption
+
+            protected:
+                void                        notify(size_t type);
+                status_t                    update_geometry(const ws::rectangle_t *r);
+
+            public:
+                explicit HeadlessWindow(HeadlessDisplay *dpy, size_t screen);
+                HeadlessWindow(const HeadlessWindow &) = delete;
+                HeadlessWindow(HeadlessWindow &&) = delete;
+                virtual ~HeadlessWindow() override;
+
+                HeadlessWindow & operator = (const HeadlessWindow &) = delete;
+                HeadlessWindow & operator = (HeadlessWindow &&) = delete;
+
+                virtual status_t            init() override;
+                virtual void                destroy() override;
+
+            public:
+                virtual ws::ISurface       *get_surface() override;
+                virtual void               *handle() override;
+                virtual size_t              screen() override;
+                virtual bool                is_visible() override;
+
+                virtual status_t            move(ssize_t left, ssize_t top) override;
+                virtual status_t            resize(ssize_t width, ssize_t height) override;
+                virtual status_t            set_geometry(const ws::rectangle_t *realize) override;
+                virtual status_t            get_geometry(ws::rectangle_t *realize) override;
+                virtual status_t            get_absolute_geometry(ws::rectangle_t *realize) override;
+                virtual status_t            set_size_constraints(const ws::size_limit_t *c) override;
+                virtual status_t            get_size_constraints(ws::size_limit_t *c) override;
+
+                virtual status_t            show() override;
+                virtual status_t            show(ws::IWindow *over) override;
+                virtual status_t            hide() override;
+
+                virtual status_t            set_caption(const char *caption) override;
+                virtual status_t            set_caption(const LSPString *caption) override;
+                virtual status_t            get_caption(LSPString *text) override;
+                virtual status_t            set_border_style(ws::border_style_t style) override;
+                virtual status_t            get_border_style(ws::border_style_t *style) override;
+                virtual status_t            set_window_actions(size_t actions) override;
+                virtual status_t            get_window_actions(size_t *actions) override;
+                virtual status_t            set_mouse_pointer(ws::mouse_pointer_t pointer) override;
+                virtual ws::mouse_pointer_t get_mouse_pointer() override;
+
+                virtual status_t            take_focus() override;
+                virtual status_t            grab_events(ws::grab_t group) override;
+                virtual status_t            ungrab_events() override;
+
+            public:
+                /**
+                 * Get the in-memory surface of the window
+                 * @return surface of the window or NULL if the window has never been shown
+                 */
+                inline HeadlessSurface     *surface()                       { return pSurface; }
+
+                /**
+                 * Deliver event to the event handler of the window immediately
+                 * @param ev event to deliver
+                 * @return status of operation
+                 */
+                status_t                    dispatch(const ws::event_t *ev);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_HEADLESSWINDOW_H_ */
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_SYS_MAILBOX_H_
+#define LSP_PLUG_IN_TK_SYS_MAILBOX_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <atomic>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Display;
+
+        /**
+         * Update handler executed by the main loop of the display
+         *
+         * @param dpy the display
+         * @param data the copy of data passed to the post() call
+         */
+        typedef void (* update_handler_t)(Display *dpy, void *data);
+
+        /**
+         * Release handler for the data of the update which has not been executed
+         * because the mailbox has been destroyed
+         *
+         * @param data the copy of data passed to the post() call
+         */
+        typedef void (* release_handler_t)(void *data);
+
+        /**
+         * Multiple-producer single-consumer queue of updates posted to the main loop.
+         * Posting an update does not take any locks, does not allocate memory and never
+         * waits for the consumer, updates are executed in the order of posting by the thread
+         * that runs the main loop. Messages are taken from the fixed number of preallocated
+         * slots, the post fails when all slots are pending.
+         */
+        class Mailbox
+        {
+            public:
+                static constexpr size_t DEFAULT_CAPACITY    = 0x100;    // Default number of slots
+                static constexpr size_t MAX_DATA_SIZE       = 0x40;     // Maximum size of data
+
+            protected:
+                typedef struct message_t
+                {
+                    std::atomic<message_t *>    pNext;      // Next message
+                    std::atomic<uint32_t>       nFree;      // Index of the next free message plus one
+                    update_handler_t            pHandler;   // Update handler
+                    release_handler_t           pRelease;   // Release handler
+                    size_t                      nSize;      // Size of data
+                    alignas(16) uint8_t         vData[MAX_DATA_SIZE];  // Copy of data
+                } message_t;
+
+            protected:
+                std::atomic<message_t *>    pHead;          // The last posted message, modified by producers
+                message_t                  *pTail;          // The first message to process, modified by consumer
+                message_t                   sStub;          // Stub message
+                message_t                  *vMessages;      // Preallocated messages
+                size_t                      nCapacity;      // Number of preallocated messages
+                std::atomic<uint64_t>       nFreeHead;      // Modification counter and index of the first free message plus one
+
+            protected:
+                void                        push(message_t *msg);
+                message_t                  *pop();
+                message_t                  *alloc_message();
+                void                        free_message(message_t *msg);
+
+            public:
+                explicit Mailbox(size_t capacity = DEFAULT_CAPACITY);
+                Mailbox(const Mailbox &) = delete;
+                Mailbox(Mailbox &&) = delete;
+                ~Mailbox();
+
+                Mailbox & operator = (const Mailbox &) = delete;
+                Mailbox & operator = (Mailbox &&) = delete;
+
+                /**
+                 * Drop all pending updates without executing them, the release handlers
+                 * are called for the data of dropped updates
+                 */
+                void                        destroy();
+
+            public:
+                /**
+                 * Post update, can be called from any thread
+                 *
+                 * @param handler update handler
+                 * @param data data to copy and pass to the handler, may be NULL
+                 * @param size size of data to copy, should not exceed MAX_DATA_SIZE
+                 * @param release handler to release the data if the update is dropped, may be NULL
+                 * @return status of operation, STATUS_OVERFLOW if all slots are pending,
+                 *   STATUS_TOO_BIG if the size of data exceeds MAX_DATA_SIZE
+                 */
+                status_t                    post(update_handler_t handler, const void *data = NULL, size_t size = 0, release_handler_t release = NULL);
+
+                /**
+                 * Execute all pending updates, should be called by the consumer thread only
+                 *
+                 * @param dpy display to pass to the handlers
+                 * @return number of executed updates
+                 */
+                size_t                      process(Display *dpy);
+
+                /**
+                 * Get number of preallocated slots
+                 * @return number of preallocated slots
+                 */
+                inline size_t               capacity() const    { return nCapacity; }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_MAILBOX_H_ */
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_SYS_PALETTECACHE_H_
+#define LSP_PLUG_IN_TK_SYS_PALETTECACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/runtime/Color.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Display-level cache of colors with applied brightness. Applying the brightness
+         * requires conversion of the color into the LCH color space and back, the cache
+         * keeps the results for the recently used pairs of color and brightness, so
+         * drawing widgets with unchanged palette does not perform color-space math.
+         * The cache is direct-mapped: each pair of color and brightness maps to the single
+         * entry which is replaced on collision. The cache is not thread-safe and should be
+         * used only by the thread that draws widgets of the display.
+         */
+        class PaletteCache
+        {
+            public:
+                static constexpr size_t CACHE_SIZE      = 0x400;
+
+            protected:
+                typedef struct entry_t
+                {
+                    float           vSrc[4];        // Source color components
+                    float           fBright;        // Brightness
+                    float           vDst[4];        // Resulting color components
+                    bool            bValid;         // Entry is valid
+                } entry_t;
+
+            protected:
+                entry_t             vEntries[CACHE_SIZE];
+                size_t              nHits;          // Number of cache hits
+                size_t              nMisses;        // Number of cache misses
+
+            protected:
+                static size_t       entry_index(const float *src, float k);
+
+            public:
+                explicit PaletteCache();
+                PaletteCache(const PaletteCache &) = delete;
+                PaletteCache(PaletteCache &&) = delete;
+                ~PaletteCache();
+
+                PaletteCache & operator = (const PaletteCache &) = delete;
+                PaletteCache & operator = (PaletteCache &&) = delete;
+
+            public:
+                /**
+                 * Apply brightness to the color, the same as lsp::Color::scale_lch_luminance()
+                 * @param color color to modify
+                 * @param k brightness coefficient
+                 */
+                void                scale_lch_luminance(lsp::Color *color, float k);
+
+                /**
+                 * Drop all cached entries
+                 */
+                void                clear();
+
+                /**
+                 * Get number of cache hits
+                 * @return number of cache hits
+                 */
+                inline size_t       hits() const        { return nHits;         }
+
+                /**
+                 * Get number of cache misses
+                 * @return number of cache misses
+                 */
+                inline size_t       misses() const      { return nMisses;       }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_PALETTECACHE_H_ */
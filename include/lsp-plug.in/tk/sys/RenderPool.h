@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef LSP_PLUG_IN_TK_SYS_RENDERPOOL_H_
+#define LSP_PLUG_IN_TK_SYS_RENDERPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Widget;
+
+        /**
+         * Pool of worker threads for concurrent drawing of private surfaces of widgets.
+         * Widgets that allow concurrent drawing are registered in the pool. Before the
+         * window gets rendered, the pool collects registered widgets of the window with
+         * pending redraw and draws them concurrently, so the serial render pass only
+         * composites already drawn surfaces.
+         *
+         * Worker threads are started on the first batch and persist until the pool is
+         * destroyed or the number of threads changes. Between batches they wait on the
+         * condition variable.
+         */
+        class RenderPool
+        {
+            protected:
+                lltl::parray<Widget>    vWidgets;       // Registered widgets
+                lltl::parray<Widget>    vBatch;         // Widgets to draw in the current batch
+                lltl::parray<ipc::Thread> vWorkers;     // Worker threads
+                std::mutex              sLock;          // Lock for the batch state
+                std::condition_variable sWork;          // Workers wait for the new batch
+                std::condition_variable sDone;          // Main thread waits for workers to finish the batch
+                size_t                  nNext;          // Next widget in the batch to draw
+                size_t                  nBatch;         // Serial number of the current batch
+                size_t                  nBusy;          // Number of workers drawing the current batch
+                size_t                  nThreads;       // Number of worker threads
+                size_t                  nDrawn;         // Overall number of concurrently drawn widgets
+                bool                    bActive;        // Batch is being drawn
+                bool                    bOpen;          // Batch accepts new workers
+                bool                    bShutdown;      // Workers should terminate
+
+            protected:
+                Widget                 *next_widget();
+                void                    draw_widgets();
+                void                    start_workers();
+                void                    stop_workers();
+                void                    run_worker();
+
+            protected:
+                static status_t         worker_proc(void *arg);
+
+            public:
+                explicit RenderPool();
+                RenderPool(const RenderPool &) = delete;
+                RenderPool(RenderPool &&) = delete;
+                ~RenderPool();
+
+                RenderPool & operator = (const RenderPool &) = delete;
+                RenderPool & operator = (RenderPool &&) = delete;
+
+                /**
+                 * Destroy the pool
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Register widget which allows concurrent drawing
+                 * @param widget widget to register
+                 * @return status of operation
+                 */
+                status_t                add(Widget *widget);
+
+                /**
+                 * Unregister widget
+                 * @param widget widget to unregister
+                 */
+                void                    remove(Widget *widget);
+
+                /**
+                 * Concurrently draw all registered widgets of the toplevel widget which
+                 * have pending redraw of their surfaces
+                 * @param toplevel toplevel widget
+                 * @return number of drawn widgets
+                 */
+                size_t                  execute(Widget *toplevel);
+
+                /**
+                 * Get number of worker threads
+                 * @return number of worker threads
+                 */
+                inline size_t           threads() const     { return nThreads;          }
+
+                /**
+                 * Set number of worker threads, running workers are stopped if the
+                 * number of threads changes
+                 * @param threads number of worker threads, zero disables concurrent drawing
+                 */
+                void                    set_threads(size_t threads);
+
+                /**
+                 * Get number of started worker threads
+                 * @return number of started worker threads
+                 */
+                inline size_t           workers() const     { return vWorkers.size();   }
+
+                /**
+                 * Check that the batch is being drawn at this moment
+                 * @return true if the batch is being drawn
+                 */
+                inline bool             active() const      { return bActive;           }
+
+                /**
+                 * Get overall number of concurrently drawn widgets
+                 * @return overall number of concurrently drawn widgets
+                 */
+                inline size_t           drawn() const       { return nDrawn;            }
+
+                /**
+                 * Get number of registered widgets
+                 * @return number of registered widgets
+                 */
+                inline size_t           size() const        { return vWidgets.size();   }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_RENDERPOOL_H_ */
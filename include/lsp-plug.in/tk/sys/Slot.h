@@ -42,7 +42,8 @@ namespace lsp
                 {
                     BIND_DFL            = 0,
                     BIND_ENABLED        = 1 << 0,
-                    BIND_INTERCEPT      = 1 << 1
+                    BIND_INTERCEPT      = 1 << 1,
+                    BIND_REMOVED        = 1 << 2
                 };
 
                 typedef struct item_t
@@ -53,14 +54,28 @@ namespace lsp
                     void               *pPtr;       // Additional argument to pass
                 } item_t;
 
+                typedef struct handle_t
+                {
+                    ssize_t             nPos;       // Position of the item, negative if handle is free
+                    ssize_t             nNext;      // Next free handle
+                    size_t              nGen;       // Generation of the handle
+                } handle_t;
+
             protected:
-                lltl::darray<item_t>    vItems;
-                handler_id_t            nID;        // ID generator
+                lltl::darray<item_t>    vItems;     // Handlers in the order of binding
+                lltl::darray<handle_t>  vHandles;   // Handler identifier to position mapping
+                ssize_t                 nFree;      // First free handle
+                size_t                  nRemoved;   // Number of removed items pending for compaction
+                size_t                  nIntercept; // Number of interceptors
                 bool                    bTracking;  // Tracking skip messages
 
             protected:
                 inline item_t          *find_item(handler_id_t id);
                 handler_id_t            bind(event_handler_t handler, bool intercept, void *arg, bool enabled);
+                ssize_t                 alloc_handle();
+                void                    release_handle(handler_id_t id);
+                void                    remove_item(item_t *item);
+                void                    compact();
                 size_t                  disable_all(bool handler, bool interceptor);
                 size_t                  enable_all(bool handler, bool interceptor);
                 status_t                track_result(status_t result) const;
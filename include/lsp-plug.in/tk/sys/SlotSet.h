@@ -33,9 +33,11 @@ namespace lsp
     namespace tk
     {
         class Widget;
+        class BlockPool;
 
         /**
-         * Set of slots identified by unique slot identifier
+         * Set of slots identified by unique slot identifier. Standard slots are
+         * looked up by the fixed-index table, other slots by the linear search.
          */
         class SlotSet
         {
@@ -48,12 +50,39 @@ namespace lsp
 
             protected:
                 lltl::parray<item_t>    vSlots;
+                BlockPool              *pPool;
+                uint16_t                vIndex[SLOT_TOTAL];     // Position of standard slot in the list plus one
+
+            protected:
+                item_t             *find_item(slot_t id);
+                item_t             *create_item(slot_t id);
+                void                destroy_item(item_t *item);
 
             public:
                 explicit SlotSet();
                 ~SlotSet();
 
             public:
+                /**
+                 * Get size of the memory block required to store one slot
+                 * @return size of the memory block
+                 */
+                static size_t       item_size();
+
+                /** Set the pool to allocate slots from, allowed only when the slot set is empty.
+                 * The slot set holds a reference to the pool until it is destroyed.
+                 *
+                 * @param pool pool to allocate slots from, NULL for the default allocator
+                 * @return status of operation
+                 */
+                status_t            set_pool(BlockPool *pool);
+
+                /** Get the pool the slots are allocated from
+                 *
+                 * @return pool the slots are allocated from or NULL for the default allocator
+                 */
+                inline BlockPool   *pool()              { return pPool; }
+
                 /** Get slot by identifier
                  *
                  * @param id slot identifier
@@ -45,6 +45,45 @@ namespace lsp
              */
             resource::Environment  *environment;
 
+            /**
+             * Memory budget of the shared glass surface cache in bytes, zero for default
+             */
+            size_t                  glass_cache_size;
+
+            /**
+             * Share the loaded style sheet with other displays of the process. The sheet
+             * is loaded once and kept immutable: each display still reads the source to
+             * validate it and applies the style sheet to it's own schema
+             */
+            bool                    shared_schema;
+
+            /**
+             * Allocate slots of widgets from the display-wide pool. Widgets hold references
+             * to the pool, so it is released with the last widget that outlives the display.
+             */
+            bool                    pooled_slots;
+
+            /**
+             * Use the in-memory display which does not require any windowing system,
+             * applies to the Display::init(argc, argv) call only
+             */
+            bool                    headless;
+
+            /**
+             * Number of worker threads for concurrent drawing of private surfaces of
+             * widgets that allow it, zero disables concurrent drawing. The windowing
+             * system should support drawing on independent image surfaces from
+             * different threads. Widgets that draw text are always drawn by the
+             * main thread.
+             */
+            size_t                  render_threads;
+
+            /**
+             * Number of worker threads for resolution of property values while
+             * parsing the style sheet, zero resolves values by the parsing thread
+             */
+            size_t                  style_threads;
+
             /**
              * Default constructor
              */
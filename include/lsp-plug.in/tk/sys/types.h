@@ -72,6 +72,8 @@ namespace lsp
             SLOT_POPUP,             //!< SLOT_POPUP Triggered after pop-up element has been shown
             SLOT_REALIZED,          //!< SLOT_REALIZED Widget has been just realized
             SLOT_IDLE,              //!< SLOT_IDLE called by some periodic idle process
+
+            SLOT_TOTAL              //!< SLOT_TOTAL Total number of standard slots
         };
 
         /** Event handler identifier
@@ -88,6 +90,17 @@ namespace lsp
          */
         typedef status_t (* event_handler_t)(Widget *sender, void *ptr, void *data);
 
+        /** Statistics of layout passes
+         *
+         */
+        typedef struct layout_stats_t
+        {
+            size_t      nPasses;        // Overall number of layout passes
+            size_t      nPartial;       // Number of layout passes confined to widget subtrees
+            size_t      nWidgets;       // Number of widgets realized by the last layout pass
+            size_t      nRealized;      // Overall number of widgets realized
+        } layout_stats_t;
+
     } /* namespace tk */
 } /* namespace lsp */
 
@@ -125,6 +125,8 @@
 
 // Styles and schemas
 #include <lsp-plug.in/tk/style/StyleSheet.h>
+#include <lsp-plug.in/tk/style/StylePool.h>
+#include <lsp-plug.in/tk/style/StringPool.h>
 #include <lsp-plug.in/tk/style/Style.h>
 #include <lsp-plug.in/tk/style/IStyleFactory.h>
 #include <lsp-plug.in/tk/style/Schema.h>
@@ -133,9 +135,18 @@
 #include <lsp-plug.in/tk/sys/settings.h>
 #include <lsp-plug.in/tk/sys/Atoms.h>
 #include <lsp-plug.in/tk/sys/Shortcuts.h>
+#include <lsp-plug.in/tk/sys/BlockPool.h>
 #include <lsp-plug.in/tk/sys/Slot.h>
 #include <lsp-plug.in/tk/sys/SlotSet.h>
 #include <lsp-plug.in/tk/sys/Timer.h>
+#include <lsp-plug.in/tk/sys/Mailbox.h>
+#include <lsp-plug.in/tk/sys/GlassCache.h>
+#include <lsp-plug.in/tk/sys/PaletteCache.h>
+#include <lsp-plug.in/tk/sys/BitmapCache.h>
+#include <lsp-plug.in/tk/sys/RenderPool.h>
+#include <lsp-plug.in/tk/sys/HeadlessSurface.h>
+#include <lsp-plug.in/tk/sys/HeadlessWindow.h>
+#include <lsp-plug.in/tk/sys/HeadlessDisplay.h>
 #include <lsp-plug.in/tk/sys/Display.h>
 
 // Utilitary objects
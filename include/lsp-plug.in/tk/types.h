@@ -34,6 +34,8 @@
 #define LSP_TK_ENV_DICT_PATH_DFL        "i18n"
 // The default dictionary location
 #define LSP_TK_ENV_SCHEMA_PATH          "schema"
+// The location of precompiled schema cache file
+#define LSP_TK_ENV_SCHEMA_CACHE         "schema.cache"
 // The default language selected at startup
 #define LSP_TK_ENV_LANG                 "language"
 #define LSP_TK_ENV_LANG_DFL             "en"
@@ -209,6 +211,22 @@ namespace lsp
             const w_class_t    *parent;
         } w_class_t;
 
+        typedef struct w_memory_t
+        {
+            size_t              nStyle;         // Memory used by the style, excluding properties
+            size_t              nProperties;    // Memory used by style properties and their values
+            size_t              nSurfaces;      // Number of cached surfaces
+            size_t              nSurfaceBytes;  // Memory used by pixels of cached surfaces
+            size_t              nData;          // Memory used by data buffers and internal containers
+        } w_memory_t;
+
+        typedef struct w_census_t
+        {
+            const w_class_t    *pClass;         // Widget class
+            size_t              nInstances;     // Number of instances
+            w_memory_t          sMemory;        // Memory used by all instances
+        } w_census_t;
+
         typedef struct padding_t
         {
             size_t              nLeft;          // Padding from left
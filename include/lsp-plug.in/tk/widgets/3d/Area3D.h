@@ -53,6 +53,24 @@ namespace lsp
             public:
                 static const w_class_t    metadata;
 
+            protected:
+                enum a3d_flags_t
+                {
+                    A3D_SCENE_DIRTY     = 1 << 0,   // The scene needs to be rendered again
+                    A3D_DEFERRED        = 1 << 1,   // Rendering of changed scene is deferred to the idle slot
+                    A3D_PENDING         = 1 << 2,   // Rendering of the back frame is scheduled
+                    A3D_RETAINED        = 1 << 3,   // The scene is invalidated only by query_draw3d()
+                };
+
+                typedef struct frame_t
+                {
+                    uint8_t                    *pData;          // Pixel data in BGRA format
+                    size_t                      nWidth;         // Width of the frame
+                    size_t                      nHeight;        // Height of the frame
+                    size_t                      nCapacity;      // Capacity of the buffer in pixels
+                    bool                        bValid;         // Frame contains valid image
+                } frame_t;
+
             protected:
                 prop::SizeConstraints       sConstraints;   // Size constraints
                 prop::Integer               sBorder;        // Border size
@@ -64,8 +82,13 @@ namespace lsp
                 prop::Color                 sGlassColor;    // Color of the glass
 
                 ws::IR3DBackend            *pBackend;       // 3D rendering backend
-                ws::ISurface               *pGlass;         // Cached glass gradient
+                GlassCache::glass_t        *pGlass;         // Shared glass surface
                 ws::rectangle_t             sCanvas;        // Actual dimensions of the drawing area (with padding)
+                frame_t                     vFrames[2];     // Front and back frames
+                size_t                      nFront;         // Index of the front frame
+                size_t                      nA3DFlags;      // Rendering flags
+                handler_id_t                nIdleHandler;   // Handler of the idle slot
+                size_t                      nFrames;        // Number of rendered frames
 
             protected:
                 virtual void                size_request(ws::size_limit_t *r) override;
@@ -75,12 +98,24 @@ namespace lsp
 
             protected:
                 static status_t             slot_draw3d(Widget *sender, void *ptr, void *data);
+                static status_t             slot_idle(Widget *sender, void *ptr, void *data);
 
             protected:
                 void                        do_destroy();
                 void                        drop_glass();
                 void                        drop_backend();
+                void                        drop_frames();
                 ws::IR3DBackend            *get_backend();
+                bool                        render_frame(frame_t *f);
+                bool                        schedule_frame();
+                void                        render_back_frame();
+                static bool                 reserve_frame(frame_t *f, size_t width, size_t height);
+
+                /**
+                 * Create 3D rendering backend, can be overridden to supply custom (for example, software) backend
+                 * @return pointer to the created backend or NULL
+                 */
+                virtual ws::IR3DBackend    *create_backend();
 
             public:
                 explicit Area3D(Display *dpy);
@@ -106,6 +141,50 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,                      glass_color,        &sGlassColor);
 
             public:
+                /**
+                 * Check whether deferred rendering is enabled. In this mode the last complete
+                 * frame is presented immediately and the new frame is rendered and read back
+                 * from the idle slot of the display, outside of the window rendering pass.
+                 * @return true if deferred rendering is enabled
+                 */
+                inline bool                 deferred_rendering() const  { return nA3DFlags & A3D_DEFERRED;      }
+
+                /**
+                 * Enable or disable deferred rendering
+                 * @param enable enable flag
+                 */
+                void                        set_deferred_rendering(bool enable);
+
+                /**
+                 * Check whether retained mode is enabled. By default, any surface redraw request
+                 * issued by query_draw() renders the scene again. In retained mode the scene is
+                 * rendered again only if it has been marked as changed by query_draw3d(), by the
+                 * change of the background color or by the resize, other redraws reuse the last
+                 * rendered frame.
+                 * @return true if retained mode is enabled
+                 */
+                inline bool                 retained() const            { return nA3DFlags & A3D_RETAINED;      }
+
+                /**
+                 * Enable or disable retained mode
+                 * @param enable enable flag
+                 */
+                void                        set_retained(bool enable);
+
+                /**
+                 * Get number of frames actually rendered by the 3D backend
+                 * @return number of rendered frames
+                 */
+                inline size_t               frames_rendered() const     { return nFrames;                       }
+
+                /**
+                 * Mark the 3D scene as changed and query for redraw. In retained mode this
+                 * is the only way for the application to render the scene again.
+                 */
+                void                        query_draw3d();
+
+            public:
+                virtual void                query_draw(size_t flags = REDRAW_DEFAULT) override;
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force) override;
                 virtual void                draw(ws::ISurface *s, bool force) override;
 
@@ -97,6 +97,8 @@ namespace lsp
                     SIZE_INVALID    = 1 << 7,       // Size limit structure is valid
                     RESIZE_PENDING  = 1 << 8,       // The resize request is pending
                     REALIZE_ACTIVE  = 1 << 9,       // Realize is active, no need to trigger for realize
+                    RELAYOUT_PENDING= 1 << 10,      // Widget is queued for relayout confined to it's allocation
+                    CONCURRENT_DRAW = 1 << 11,      // Widget surface can be drawn by the worker thread
 
                     REDRAW_DEFAULT  = REDRAW_SURFACE
                 };
@@ -166,16 +168,49 @@ namespace lsp
 
             protected:
                 static size_t       redraw_flags(size_t draw_flags);
+                static void         surface_memory_usage(w_memory_t *mem, ws::ISurface *s);
 
             //---------------------------------------------------------------------------------
             // Interface for nested classes
             protected:
                 void                    do_destroy();
 
+                /**
+                 * Try to queue the widget for relayout within it's current allocation
+                 * instead of forwarding the resize request to the parent widget
+                 *
+                 * @return true if widget has been queued for relayout
+                 */
+                bool                    query_relayout();
+
+                /**
+                 * Allow the private surface of the widget to be drawn concurrently with other
+                 * widgets by the worker thread. The draw() method of the widget should not
+                 * modify any state shared with other widgets.
+                 */
+                void                    allow_concurrent_draw();
+
+                /**
+                 * Check that the draw() method of the widget currently draws text. Formatting
+                 * of text uses the i18n dictionary and drawing of text uses the font manager,
+                 * both are not thread-safe, so such widget is drawn by the main thread.
+                 *
+                 * @return true if the widget draws text
+                 */
+                virtual bool            draws_text();
+
                 const style::WidgetColors   *select_colors() const;
 
                 float                   select_brightness() const;
 
+                /**
+                 * Apply brightness to the color using the palette cache of the display
+                 * @param color color to modify
+                 * @param k brightness coefficient
+                 */
+                void                    scale_lch_luminance(lsp::Color *color, float k) const;
+                inline void             scale_lch_luminance(lsp::Color &color, float k) const   { scale_lch_luminance(&color, k); }
+
                 void                    unlink_widget(Widget *widget);
 
                 /**
@@ -240,6 +275,12 @@ namespace lsp
                  */
                 inline const w_class_t *get_class() const { return pClass; }
 
+                /**
+                 * Estimate amount of memory used by the widget and add it to the counters
+                 * @param mem memory counters to update
+                 */
+                virtual void        memory_usage(w_memory_t *mem) const;
+
                 /**
                  * Get style class
                  * @return style class
@@ -576,6 +617,29 @@ namespace lsp
                  */
                 virtual void            query_resize();
 
+                /**
+                 * Commit the relayout previously queued by the query_resize() call: re-measure
+                 * the widget and, if it's size limits did not change, realize it within it's
+                 * current allocation. Otherwise forward the resize request to the parent widget.
+                 *
+                 * @param limit size limits of the widget at the moment of queueing
+                 * @return true if relayout has been confined to the widget
+                 */
+                bool                    commit_relayout(const ws::size_limit_t *limit);
+
+                /**
+                 * Check that the private surface of the widget allows concurrent drawing
+                 * and needs to be redrawn
+                 *
+                 * @return true if the private surface needs to be redrawn
+                 */
+                bool                    surface_draw_pending();
+
+                /**
+                 * Redraw the private surface of the widget, can be called by the worker thread
+                 */
+                void                    draw_surface();
+
                 /** Get widget surface
                  *
                  * @param s base surface
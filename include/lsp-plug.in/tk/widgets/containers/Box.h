@@ -172,6 +172,7 @@ namespace lsp
                 virtual Widget             *find_widget(ssize_t x, ssize_t y) override;
 
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force) override;
+                virtual void                memory_usage(w_memory_t *mem) const override;
 
                 virtual status_t            add(Widget *widget) override;
                 virtual status_t            remove(Widget *child) override;
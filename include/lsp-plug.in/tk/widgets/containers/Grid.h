@@ -56,6 +56,16 @@ namespace lsp
                 {
                     F_EXPAND        = 1 << 0,       // Widget in the cell has 'expand' flag
                     F_REDUCE        = 1 << 1,       // Widget in the cell has 'reduce' flag
+                    F_DIRTY         = 1 << 2,       // Minimum size of the header should be re-estimated
+                };
+
+                enum state_t
+                {
+                    S_VISIBLE       = 1 << 0,       // Widget is visible
+                    S_HEXPAND       = 1 << 1,       // Widget has horizontal 'expand' flag
+                    S_VEXPAND       = 1 << 2,       // Widget has vertical 'expand' flag
+                    S_HREDUCE       = 1 << 3,       // Widget has horizontal 'reduce' flag
+                    S_VREDUCE       = 1 << 4,       // Widget has vertical 'reduce' flag
                 };
 
                 typedef struct cell_t
@@ -74,6 +84,7 @@ namespace lsp
                 typedef struct header_t
                 {
                     ssize_t             nSize;      // Size of the header
+                    ssize_t             nMinSize;   // Cached minimum size estimated from single-span cells
                     size_t              nWeight;    // Weight of the header
                     size_t              nSpacing;   // Additional spacing
                     size_t              nFlags;     // Additional flags
@@ -86,6 +97,7 @@ namespace lsp
                     ssize_t             nTop;       // Attached top position, negative for add()
                     size_t              nRows;      // Number of rows taken by widget, should be positive
                     size_t              nCols;      // Number of columns taken by widget, should be positive
+                    size_t              nState;     // Last known state of the widget used for cell allocation
                 } widget_t;
 
                 typedef struct alloc_t
@@ -94,9 +106,12 @@ namespace lsp
                     lltl::parray<cell_t>    vTable;
                     lltl::darray<header_t>  vRows;
                     lltl::darray<header_t>  vCols;
+                    lltl::parray<cell_t>    vSpare;     // Spare cells for further reuse
+                    lltl::parray<header_t>  vDistr;     // Temporary list for size distribution
                     size_t                  nRows;
                     size_t                  nCols;
                     size_t                  nTag;
+                    bool                    bValid;     // The structure of cells is valid
                 } alloc_t;
 
             protected:
@@ -113,6 +128,8 @@ namespace lsp
             protected:
                 void                        do_destroy();
                 static inline bool          hidden_widget(const widget_t *w);
+                static size_t               widget_state(const widget_t *w);
+                status_t                    update_cells(alloc_t *a);
                 status_t                    allocate_cells(alloc_t *a);
                 status_t                    attach_cells(alloc_t *a);
                 static bool                 attach_cell(alloc_t *a, widget_t *w, size_t left, size_t top);
@@ -123,13 +140,15 @@ namespace lsp
                 static void                 remove_row(alloc_t *a, size_t id);
                 static void                 remove_col(alloc_t *a, size_t id);
                 static size_t               estimate_size(lltl::darray<header_t> *hdr, size_t first, size_t count);
-                static void                 distribute_size(lltl::darray<header_t> *vh, size_t first, size_t count, size_t size);
-                status_t                    estimate_sizes(alloc_t *a);
+                static void                 distribute_size(lltl::darray<header_t> *vh, size_t first, size_t count, size_t size, lltl::parray<header_t> *vl);
+                static void                 mark_dirty_headers(alloc_t *a);
+                static status_t             estimate_sizes(alloc_t *a);
                 status_t                    create_row_col_descriptors(alloc_t *a);
                 static void                 assign_coords(alloc_t *a, const ws::rectangle_t *r);
                 static bool                 realize_children(alloc_t *a);
                 status_t                    attach_internal(ssize_t left, ssize_t top, Widget *widget, size_t rows, size_t cols);
-                static cell_t              *alloc_cell(lltl::parray<cell_t> *list);
+                static cell_t              *alloc_cell(alloc_t *a);
+                static void                 release_cells(alloc_t *a);
                 static void                 free_cells(alloc_t *a);
                 static void                 free_cell(cell_t *cell);
 
@@ -203,6 +222,7 @@ namespace lsp
                  * @param force force flag
                  */
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force) override;
+                virtual void                memory_usage(w_memory_t *mem) const override;
 
                 /** Add widget to the grid
                  *
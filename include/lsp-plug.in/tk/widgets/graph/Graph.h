@@ -84,7 +84,7 @@ namespace lsp
                 prop::Color                     sGlassColor;    // Color of the glass
                 prop::Padding                   sIPadding;      // Internal padding
 
-                ws::ISurface                   *pGlass;         // Cached glass gradient
+                GlassCache::glass_t            *pGlass;         // Shared glass surface
                 ws::rectangle_t                 sCanvas;        // Actual dimensions of the drawing area (with padding)
                 ws::rectangle_t                 sICanvas;       // Actual dimensions of the drawing area (without padding)
 
@@ -103,6 +103,7 @@ namespace lsp
                 virtual void                property_changed(Property *prop) override;
                 virtual bool                realize(const ws::rectangle_t *r) override;
                 virtual void                hide_widget() override;
+                virtual bool                draws_text() override;
 
                 void                        sync_lists();
                 void                        drop_glass();
@@ -43,6 +43,7 @@ namespace lsp
                 prop::Float                 sVScale;            // Height, proportional to the graph size
                 prop::Color                 sColor;             // Base color
                 prop::GraphFrameFunction    sFunction;          // Function
+                prop::Boolean               sPalette;           // Use precomputed palette
             LSP_TK_STYLE_DEF_END
         }
 
@@ -54,6 +55,12 @@ namespace lsp
             protected:
                 typedef void (GraphFrameBuffer::*calc_color_t)(float *rgba, const float *value, size_t n);
 
+                enum palette_t
+                {
+                    PALETTE_SIZE        = 0x800,            // Number of palette entries
+                    PALETTE_CHUNK       = 0x100             // Number of entries computed per pass
+                };
+
             protected:
                 prop::GraphFrameData        sData;              // Framebuffer data
                 prop::Float                 sTransparency;      // Framebuffer transparency
@@ -64,6 +71,7 @@ namespace lsp
                 prop::Float                 sVScale;            // Height, proportional to the graph size
                 prop::Color                 sColor;             // Base color
                 prop::GraphFrameFunction    sFunction;          // Function
+                prop::Boolean               sPalette;           // Use precomputed palette
 
                 bool                        bClear;             // Perform full cleanup of image
                 size_t                      nRows;              // Cached number of rows
@@ -75,6 +83,10 @@ namespace lsp
                 uint8_t                    *pfRGBA;             // Unaligned RGBA buffer
                 size_t                      nCapacity;          // RGBA buffer capacity
                 size_t                      nPixels;            // Number of pixels
+                size_t                      nHead;              // Row of the image buffer that holds the most recent data
+                uint32_t                   *vPalette;           // Precomputed palette, NULL if not computed
+                float                       fPalMin;            // Minimum value covered by the palette
+                float                       fPalMax;            // Maximum value covered by the palette
 
             protected:
                 void                        calc_rainbow_color(float *rgba, const float *value, size_t n);
@@ -84,6 +96,9 @@ namespace lsp
                 void                        calc_lightness2(float *rgba, const float *value, size_t n);
 
                 void                        destroy_data();
+                void                        drop_palette();
+                bool                        build_palette();
+                void                        apply_palette(uint8_t *dst, const float *v, size_t n);
 
                 virtual void                property_changed(Property *prop) override;
 
@@ -109,10 +124,12 @@ namespace lsp
                 LSP_TK_PROPERTY(Float,                  vscale,             &sVScale)
                 LSP_TK_PROPERTY(Color,                  color,              &sColor)
                 LSP_TK_PROPERTY(GraphFrameFunction,     function,           &sFunction)
+                LSP_TK_PROPERTY(Boolean,                palette,            &sPalette)
 
             public:
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force) override;
                 virtual void                draw(ws::ISurface *s, bool force) override;
+                virtual void                memory_usage(w_memory_t *mem) const override;
         };
 
     } /* namespace lsp */
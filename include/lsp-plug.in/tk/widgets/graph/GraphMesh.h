@@ -122,6 +122,7 @@ namespace lsp
 
             public:
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force) override;
+                virtual void                memory_usage(w_memory_t *mem) const override;
         };
 
     } /* namespace tk */
@@ -92,9 +92,28 @@ namespace lsp
                     prop::Color    *border_color;
                 } range_t;
 
+                typedef struct peak_t
+                {
+                    float           fMin;               // Minimum value within the block
+                    float           fMax;               // Maximum value within the block
+                } peak_t;
+
+                enum peaks_t
+                {
+                    PEAKS_MAX       = 0x2000            // Maximum number of peak blocks before decimation
+                };
+
             protected:
                 prop::FloatArray        vSamples;
 
+                lltl::darray<peak_t>    vPeaks;             // Running peak summary of samples
+                size_t                  nPeakBlock;         // Number of samples per peak block, power of 2
+                size_t                  nPeakSamples;       // Number of samples processed by the summary
+                bool                    bAppend;            // Samples are being appended
+                uint8_t                *pDrawData;          // Unaligned drawing buffer
+                float                  *vDrawBuf;           // Drawing buffer
+                size_t                  nDrawCap;           // Drawing buffer capacity
+
                 prop::Integer           sHeadCut;           // Head cut
                 prop::Integer           sTailCut;           // Tail cut
                 prop::Integer           sFadeIn;            // Number of samples for fade-in
@@ -138,6 +157,13 @@ namespace lsp
                 void                    draw_range(const ws::rectangle_t *r, ws::ISurface *s, range_t *range, size_t samples, float scaling, float bright);
                 void                    draw_play_position(const ws::rectangle_t *r, ws::ISurface *s, size_t samples, float scaling, float bright);
 
+                void                    do_destroy();
+                void                    reset_peaks();
+                void                    update_peaks();
+                void                    decimate_peaks();
+                void                    peaks(float *vmin, float *vmax, size_t samples, size_t count);
+                float                  *draw_buffer(size_t count);
+
             public:
                 explicit AudioChannel(Display *dpy);
                 AudioChannel(const AudioChannel &) = delete;
@@ -148,6 +174,7 @@ namespace lsp
                 AudioChannel & operator = (AudioChannel &) = delete;
 
                 virtual status_t        init() override;
+                virtual void            destroy() override;
 
             public:
                 LSP_TK_PROPERTY(FloatArray,             samples,                &vSamples);
@@ -184,8 +211,22 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,                  line_color,             &sLineColor);
                 LSP_TK_PROPERTY(SizeConstraints,        constraints,            &sConstraints);
 
+            public:
+                /**
+                 * Append block of samples to the end of the channel. Unlike modifying
+                 * the samples directly, the peak summary of previously added samples
+                 * is preserved, so the cost of appending is proportional to the number
+                 * of appended samples
+                 *
+                 * @param v samples to append
+                 * @param count number of samples to append
+                 * @return status of operation
+                 */
+                status_t                append(const float *v, size_t count);
+
             public:
                 virtual void            draw(ws::ISurface *s, bool force) override;
+                virtual void            memory_usage(w_memory_t *mem) const override;
         };
     } /* namespace tk */
 } /* namespace lsp */
@@ -166,7 +166,7 @@ namespace lsp
                 prop::Color             sGlassColor;            // Color of the glass
                 prop::Padding           sIPadding;              // Internal padding
 
-                ws::ISurface           *pGlass;                 // Surface to draw glass
+                GlassCache::glass_t    *pGlass;                 // Shared glass surface
 
                 curve_function_t        pFunction;              // Curve function
                 void                   *pFuncData;              // Curve function supplementary data
@@ -157,7 +157,7 @@ namespace lsp
                 size_t                  nBMask;                     // Mouse button state
                 size_t                  nXFlags;                    // Button flags
                 ws::rectangle_t         sGraph;                     // Area for sample rendering
-                ws::ISurface           *pGlass;                     // Surface to draw glass
+                GlassCache::glass_t    *pGlass;                     // Shared glass surface
 
             protected:
                 static status_t         slot_on_before_popup(Widget *sender, void *ptr, void *data);
@@ -173,6 +173,7 @@ namespace lsp
                 virtual bool            realize(const ws::rectangle_t *r) override;
                 virtual void            property_changed(Property *prop) override;
                 virtual void            hide_widget() override;
+                virtual bool            draws_text() override;
 
             protected:
                 void                    draw_range(const ws::rectangle_t *r, ws::ISurface *s, AudioChannel *c, range_t *range, size_t samples);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PTEST_TK_COMMON_H_
+#define PRIVATE_PTEST_TK_COMMON_H_
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+/**
+ * Name of the environment variable which contains the path to the report file
+ */
+#define LSP_TK_PTEST_REPORT         "LSP_TK_PTEST_REPORT"
+
+/**
+ * Performance test loop which additionally records the result into the report file
+ */
+#define TK_PTEST_LOOP(key, ...) \
+    { \
+        ::lsp::test::Benchmark __bench(full_name(), key); \
+        PTEST_LOOP(key, __VA_ARGS__; __bench.tick(); ); \
+    }
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Benchmark record. When the LSP_TK_PTEST_REPORT environment variable is set, the
+         * record is appended to the file as a single JSON object per line:
+         *
+         *   {"test": "<group>.<name>", "key": "<key>", "iterations": N, "time": T, "rate": R}
+         *
+         * where time is in seconds and rate is the number of iterations per second.
+         */
+        class Benchmark
+        {
+            protected:
+                const char         *pTest;          // Test name
+                const char         *pKey;           // Benchmark key
+                wssize_t            nStart;         // Start time in milliseconds
+                size_t              nCount;         // Number of iterations
+
+            public:
+                explicit Benchmark(const char *test, const char *key);
+                Benchmark(const Benchmark &) = delete;
+                Benchmark(Benchmark &&) = delete;
+                ~Benchmark();
+
+                Benchmark & operator = (const Benchmark &) = delete;
+                Benchmark & operator = (Benchmark &&) = delete;
+
+            public:
+                inline void         tick()          { ++nCount; }
+        };
+
+        /**
+         * Create and initialize display which does not require the windowing system,
+         * surfaces of the display rasterize all primitives in software
+         * @param settings additional display settings, NULL for defaults
+         * @return initialized display or NULL on error
+         */
+        tk::Display        *create_display(tk::display_settings_t *settings = NULL);
+
+        /**
+         * Destroy display created by create_display()
+         * @param dpy display to destroy
+         */
+        void                destroy_display(tk::Display *dpy);
+
+        /**
+         * Initialize widget and add it to the list
+         * @param w widget to initialize
+         * @param list list of widgets to add the widget, widgets are destroyed in reverse order
+         * @return status of operation
+         */
+        status_t            add_widget(tk::Widget *w, lltl::parray<tk::Widget> *list);
+
+        /**
+         * Destroy all widgets in the list in reverse order
+         * @param list list of widgets
+         */
+        void                destroy_widgets(lltl::parray<tk::Widget> *list);
+
+        /**
+         * Compute size limits and realize widget
+         * @param w widget to realize
+         * @param width width of the widget
+         * @param height height of the widget
+         */
+        void                realize_widget(tk::Widget *w, ssize_t width, ssize_t height);
+    } /* namespace test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PTEST_TK_COMMON_H_ */
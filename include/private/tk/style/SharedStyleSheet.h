@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TK_STYLE_SHAREDSTYLESHEET_H_
+#define PRIVATE_TK_STYLE_SHAREDSTYLESHEET_H_
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Shared style sheet, immutable after it has been loaded
+         */
+        struct shared_stylesheet_t
+        {
+            LSPString               sPath;      // Path to the source data
+            digest_t                sStamp;     // Digest of the source data
+            size_t                  nRefs;      // Number of references
+            StyleSheet              sSheet;     // Loaded style sheet
+        };
+
+        /**
+         * Process-wide registry of style sheets shared between displays.
+         * The style sheet is loaded once per process and is never modified after that, so
+         * displays apply it to their own schemas concurrently and without any global lock.
+         * Style sheets are identified by the source path and the stamp of the source data
+         * and are destroyed when the last display releases them.
+         */
+        class LSP_HIDDEN_MODIFIER SharedStyleSheet
+        {
+            public:
+                typedef status_t (* loader_t)(StyleSheet *sheet, void *arg);
+
+            private:
+                static ipc::Mutex                           sLock;
+                static lltl::parray<shared_stylesheet_t>    vEntries;
+
+            public:
+                /**
+                 * Acquire shared style sheet. If the style sheet is not present, it is
+                 * loaded by the loader and stored in the registry
+                 * @param entry pointer to store the handle of the shared style sheet
+                 * @param path path to the source data
+                 * @param stamp digest of the source data
+                 * @param loader function that loads the style sheet if it is not present
+                 * @param arg argument passed to the loader
+                 * @return status of operation
+                 */
+                static status_t     acquire(
+                    shared_stylesheet_t **entry,
+                    const char *path, const digest_t *stamp,
+                    loader_t loader, void *arg);
+
+                /**
+                 * Get the style sheet of the acquired entry
+                 * @param entry handle of the shared style sheet
+                 * @return style sheet that should not be modified
+                 */
+                static inline const StyleSheet *sheet(const shared_stylesheet_t *entry) { return &entry->sSheet; }
+
+                /**
+                 * Release shared style sheet previously obtained by acquire()
+                 * @param entry handle of the shared style sheet
+                 */
+                static void         release(shared_stylesheet_t *entry);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TK_STYLE_SHAREDSTYLESHEET_H_ */
@@ -133,6 +133,13 @@ ifeq ($(call fcheck,asan,$(BUILD_FEATURES),ON),ON)
   NOARCH_SO_FLAGS    += -fsanitize=address
 endif
 
+ifeq ($(call fcheck,tsan,$(BUILD_FEATURES),ON),ON)
+  NOARCH_CFLAGS      += -fsanitize=thread
+  NOARCH_CXXFLAGS    += -fsanitize=thread
+  NOARCH_EXE_FLAGS   += -fsanitize=thread
+  NOARCH_SO_FLAGS    += -fsanitize=thread
+endif
+
 ifeq ($(call fcheck,profile,$(BUILD_FEATURES),ON),ON)
   NOARCH_CFLAGS      += -pg -DLSP_PROFILE
   NOARCH_CXXFLAGS    += -pg -DLSP_PROFILE
@@ -263,5 +270,6 @@ toolvars:
 	echo "  profile                   Build with gprof profiling options"
 	echo "  strict                    Strict compilation: treat all compilation warning as errors"
 	echo "  test                      Enable tests and build test binary"
+	echo "  tsan                      Build with thread sanitizer enabled"
 	echo "  trace                     Enable output of additional trace logs"
 	echo ""
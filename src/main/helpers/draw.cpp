@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/tk/helpers/draw.h>
+#include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/stdlib/math.h>
 
 namespace lsp
@@ -307,6 +308,139 @@ namespace lsp
             }
         }
 
+        typedef struct resample_t
+        {
+            ssize_t    *vFirst;         // First source pixel for each destination pixel
+            float      *vWeights;       // Weights of source pixels, nTaps for each destination pixel
+            size_t      nTaps;          // Number of taps
+        } resample_t;
+
+        static bool init_resample(resample_t *r, uint8_t **ptr, size_t src, size_t dst)
+        {
+            const float k       = float(src) / float(dst);
+            const float radius  = lsp_max(k, 1.0f);
+            const size_t taps   = size_t(ceilf(radius * 2.0f)) + 1;
+
+            // Allocate memory
+            size_t szof_first   = align_size(sizeof(ssize_t) * dst, DEFAULT_ALIGN);
+            size_t szof_weights = sizeof(float) * dst * taps;
+            uint8_t *buf        = static_cast<uint8_t *>(malloc(szof_first + szof_weights));
+            if (buf == NULL)
+                return false;
+
+            r->vFirst           = reinterpret_cast<ssize_t *>(buf);
+            r->vWeights         = reinterpret_cast<float *>(&buf[szof_first]);
+            r->nTaps            = taps;
+            *ptr                = buf;
+
+            // Compute weights of the triangle filter, taps outside the source are
+            // clamped to the edge pixels
+            for (size_t i=0; i<dst; ++i)
+            {
+                const float center  = (i + 0.5f) * k - 0.5f;
+                const ssize_t first = ssize_t(floorf(center - radius)) + 1;
+                float *w            = &r->vWeights[i * taps];
+                float sum           = 0.0f;
+
+                for (size_t j=0; j<taps; ++j)
+                {
+                    const float d       = fabsf(float(first + ssize_t(j)) - center) / radius;
+                    w[j]                = lsp_max(0.0f, 1.0f - d);
+                    sum                += w[j];
+                }
+
+                const float norm    = (sum > 0.0f) ? 1.0f / sum : 0.0f;
+                for (size_t j=0; j<taps; ++j)
+                    w[j]               *= norm;
+
+                r->vFirst[i]        = first;
+            }
+
+            return true;
+        }
+
+        static inline size_t clamp_index(ssize_t index, size_t size)
+        {
+            return (index < 0) ? 0 : (size_t(index) >= size) ? size - 1 : index;
+        }
+
+        status_t scale_bitmap(mm::Bitmap *dst, const mm::Bitmap *src, size_t width, size_t height)
+        {
+            const size_t sw = src->width(), sh = src->height();
+            if ((width <= 0) || (height <= 0) || (sw <= 0) || (sh <= 0))
+                return STATUS_BAD_ARGUMENTS;
+
+            status_t res = dst->init(src->format(), height, width);
+            if (res != STATUS_OK)
+                return res;
+
+            // Initialize filters
+            resample_t hr, vr;
+            uint8_t *hptr = NULL, *vptr = NULL;
+            lsp_finally {
+                free(hptr);
+                free(vptr);
+            };
+            if (!init_resample(&hr, &hptr, sw, width))
+                return STATUS_NO_MEM;
+            if (!init_resample(&vr, &vptr, sh, height))
+                return STATUS_NO_MEM;
+
+            // Allocate buffer for horizontally resampled rows
+            float *tmp = static_cast<float *>(malloc(sizeof(float) * sh * width * 4));
+            if (tmp == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally { free(tmp); };
+
+            // Horizontal pass
+            for (size_t y=0; y<sh; ++y)
+            {
+                const uint8_t *sp   = src->row(y);
+                float *dp           = &tmp[y * width * 4];
+
+                for (size_t x=0; x<width; ++x, dp += 4)
+                {
+                    const float *w      = &hr.vWeights[x * hr.nTaps];
+                    float c0 = 0.0f, c1 = 0.0f, c2 = 0.0f, c3 = 0.0f;
+                    for (size_t j=0; j<hr.nTaps; ++j)
+                    {
+                        if (w[j] <= 0.0f)
+                            continue;
+                        const uint8_t *p    = &sp[clamp_index(hr.vFirst[x] + ssize_t(j), sw) * 4];
+                        c0                 += p[0] * w[j];
+                        c1                 += p[1] * w[j];
+                        c2                 += p[2] * w[j];
+                        c3                 += p[3] * w[j];
+                    }
+                    dp[0] = c0;
+                    dp[1] = c1;
+                    dp[2] = c2;
+                    dp[3] = c3;
+                }
+            }
+
+            // Vertical pass
+            for (size_t y=0; y<height; ++y)
+            {
+                const float *w      = &vr.vWeights[y * vr.nTaps];
+                uint8_t *dp         = dst->row(y);
+
+                for (size_t x=0; x<width*4; ++x)
+                {
+                    float c = 0.0f;
+                    for (size_t j=0; j<vr.nTaps; ++j)
+                    {
+                        if (w[j] <= 0.0f)
+                            continue;
+                        c  += tmp[clamp_index(vr.vFirst[y] + ssize_t(j), sh) * width * 4 + x] * w[j];
+                    }
+                    dp[x]   = uint8_t(lsp_limit(c + 0.5f, 0.0f, 255.0f));
+                }
+            }
+
+            return STATUS_OK;
+        }
+
     } /* namespace lsp */
 } /* namespace tk */
 
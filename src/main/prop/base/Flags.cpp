@@ -62,46 +62,41 @@ namespace lsp
             if ((style == NULL) || (id == NULL))
                 return STATUS_BAD_ARGUMENTS;
 
+            atom_t atom = style->atom_id(id);
+            return (atom >= 0) ? bind(atom, style) : status_t(-atom);
+        }
+
+        status_t Flags::bind(atom_t id, Style *style)
+        {
+            if ((style == NULL) || (id < 0))
+                return STATUS_BAD_ARGUMENTS;
+
             if (pStyle == style)
                 return STATUS_OK;
 
             // Unbind from previously used style
             unbind();
 
-            LSPString key;
-            if (!key.set_utf8(id))
+            // Obtain the list of atoms resolved for the property name
+            const atom_t *list = style->composite_atoms(id, pFlags);
+            if (list == NULL)
                 return STATUS_NO_MEM;
-            size_t len = key.length();
 
             // Bind all ports
             status_t res = STATUS_OK;
 
             style->begin();
             {
-                atom_t *atoms = vAtoms;
-                for (const char * const *flags = pFlags; *flags != NULL; ++atoms, ++flags)
+                for (size_t i=0; pFlags[i] != NULL; ++i)
                 {
-                    key.set_length(len);
-                    if (!key.append_ascii(*flags))
-                    {
-                        res = STATUS_NO_MEM;
-                        break;
-                    }
-                    atom_t atom = style->atom_id(key.get_utf8());
-                    if (atom < 0)
-                    {
-                        res = STATUS_NO_MEM;
-                        break;
-                    }
-                    res = style->bind(atom, PT_BOOL, &sListener);
+                    res = style->bind(list[i], PT_BOOL, &sListener);
                     if (res != STATUS_OK)
                         break;
-                    *atoms      = atom;
+                    vAtoms[i]   = list[i];
                 }
 
-                if (res == STATUS_OK)
-                    pStyle      = style;
-                else
+                pStyle      = style;
+                if (res != STATUS_OK)
                     unbind();
             }
             style->end();
@@ -115,13 +110,6 @@ namespace lsp
             return res;
         }
 
-        status_t Flags::bind(atom_t id, Style *style)
-        {
-            if (style == NULL)
-                return STATUS_BAD_ARGUMENTS;
-            return bind(style->atom_name(id), style);
-        }
-
         status_t Flags::bind(const LSPString *id, Style *style)
         {
             if (id == NULL)
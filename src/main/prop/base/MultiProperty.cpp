@@ -55,45 +55,41 @@ namespace lsp
             if ((style == NULL) || (id == NULL))
                 return STATUS_BAD_ARGUMENTS;
 
+            atom_t atom = style->atom_id(id);
+            return (atom >= 0) ? bind(atom, style, atoms, desc, listener) : status_t(-atom);
+        }
+
+        status_t MultiProperty::bind(atom_t id, Style *style, atom_t *atoms, const prop::desc_t *desc, IStyleListener *listener)
+        {
+            if ((style == NULL) || (id < 0))
+                return STATUS_BAD_ARGUMENTS;
+
             if (pStyle == style)
                 return STATUS_OK;
 
             // Unbind from previously used style
             unbind(atoms, desc, listener);
 
-            LSPString key;
-            if (!key.set_utf8(id))
+            // Obtain the list of atoms resolved for the property name
+            const atom_t *list = style->composite_atoms(id, desc);
+            if (list == NULL)
                 return STATUS_NO_MEM;
-            size_t len = key.length();
 
             // Bind all ports
             status_t res = STATUS_OK;
 
             style->begin();
             {
-                for ( ; desc->postfix != NULL; ++atoms, ++desc)
+                for (size_t i=0; desc[i].postfix != NULL; ++i)
                 {
-                    key.set_length(len);
-                    if (!key.append_ascii(desc->postfix))
-                    {
-                        res = STATUS_NO_MEM;
-                        break;
-                    }
-                    atom_t atom = style->atom_id(&key);
-                    if (atom < 0)
-                    {
-                        res = STATUS_NO_MEM;
-                        break;
-                    }
-                    res = style->bind(atom, desc->type, listener);
+                    res = style->bind(list[i], desc[i].type, listener);
                     if (res != STATUS_OK)
                         break;
-                    *atoms      = atom;
+                    atoms[i]    = list[i];
                 }
 
-                if (res == STATUS_OK)
-                    pStyle      = style;
-                else
+                pStyle      = style;
+                if (res != STATUS_OK)
                     unbind(atoms, desc, listener);
             }
             style->end();
@@ -107,13 +103,6 @@ namespace lsp
             return res;
         }
 
-        status_t MultiProperty::bind(atom_t id, Style *style, atom_t *atoms, const prop::desc_t *desc, IStyleListener *listener)
-        {
-            if (style == NULL)
-                return STATUS_BAD_ARGUMENTS;
-            return bind(style->atom_name(id), style, atoms, desc, listener);
-        }
-
         status_t MultiProperty::bind(const LSPString *id, Style *style, atom_t *atoms, const prop::desc_t *desc, IStyleListener *listener)
         {
             if (id == NULL)
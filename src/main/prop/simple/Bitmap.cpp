@@ -28,17 +28,63 @@ namespace lsp
         Bitmap::Bitmap(prop::Listener *listener):
             Property(listener)
         {
+            pImage      = NULL;
+            pCache      = NULL;
         }
 
         Bitmap::~Bitmap()
         {
+            BitmapCache::release(&pImage);
+        }
+
+        void Bitmap::drop_shared()
+        {
+            BitmapCache::release(&pImage);
+            sScaled.clear();
+        }
+
+        status_t Bitmap::detach()
+        {
+            if (pImage == NULL)
+                return STATUS_OK;
+
+            status_t res = sBitmap.set(*BitmapCache::bitmap(pImage));
+            if (res == STATUS_OK)
+                drop_shared();
+            return res;
+        }
+
+        uint8_t *Bitmap::row(size_t index) noexcept
+        {
+            if (detach() != STATUS_OK)
+                return NULL;
+            sScaled.clear();
+            return sBitmap.row(index);
+        }
+
+        uint8_t *Bitmap::data() noexcept
+        {
+            if (detach() != STATUS_OK)
+                return NULL;
+            sScaled.clear();
+            return sBitmap.data();
+        }
+
+        const mm::Bitmap *Bitmap::scaled(size_t width, size_t height)
+        {
+            if (pImage != NULL)
+                return BitmapCache::scaled(pImage, width, height);
+            return sScaled.get(&sBitmap, width, height);
         }
 
         status_t Bitmap::set(const mm::Bitmap & src)
         {
             status_t res = sBitmap.convert_from(src, mm::PIXFMT_PBGRA8888);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
@@ -46,23 +92,42 @@ namespace lsp
         {
             status_t res = sBitmap.convert_from(src, mm::PIXFMT_PBGRA8888);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::set(const Bitmap & src)
         {
-            status_t res = sBitmap.convert_from(src.sBitmap, mm::PIXFMT_PBGRA8888);
-            if (res == STATUS_OK)
-                sync();
-            return res;
+            return set(&src);
         }
 
         status_t Bitmap::set(const Bitmap *src)
         {
-            status_t res = (src != NULL) ? sBitmap.set(src->sBitmap) : STATUS_BAD_ARGUMENTS;
+            if (src == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (src == this)
+                return STATUS_OK;
+
+            // Share the contents if possible
+            if (src->pImage != NULL)
+            {
+                BitmapCache::image_t *image = BitmapCache::retain(src->pImage);
+                drop_shared();
+                sBitmap.reset();
+                pImage      = image;
+                sync();
+                return STATUS_OK;
+            }
+
+            status_t res = sBitmap.set(src->sBitmap);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
@@ -70,53 +135,86 @@ namespace lsp
         {
             status_t res = sBitmap.init(format, rows, cols);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         void Bitmap::reset()
         {
+            drop_shared();
             sBitmap.reset();
             sync();
         }
 
         status_t Bitmap::resize(size_t rows, size_t cols)
         {
-            status_t res = sBitmap.resize(rows, cols);
+            status_t res = detach();
+            if (res == STATUS_OK)
+                res = sBitmap.resize(rows, cols);
             if (res == STATUS_OK)
+            {
+                sScaled.clear();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::load(const char *path, mm::IColorMap *map)
         {
+            if (pCache != NULL)
+                return load(pCache, path, map);
+
             status_t res = sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::load(const LSPString *path, mm::IColorMap *map)
         {
+            if (pCache != NULL)
+                return load(pCache, path, map);
+
             status_t res = sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::load(const LSPString & path, mm::IColorMap *map)
         {
+            if (pCache != NULL)
+                return load(pCache, &path, map);
+
             status_t res = sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::load(const io::Path *path, mm::IColorMap *map)
         {
+            if (pCache != NULL)
+                return load(pCache, path->as_string(), map);
+
             status_t res = sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
@@ -124,15 +222,24 @@ namespace lsp
         {
             status_t res = sBitmap.load(data, size, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
         status_t Bitmap::load(const io::Path & path, mm::IColorMap *map)
         {
+            if (pCache != NULL)
+                return load(pCache, path.as_string(), map);
+
             status_t res = sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
@@ -140,23 +247,65 @@ namespace lsp
         {
             status_t res = sBitmap.load(is, mm::PIXFMT_PBGRA8888, map);
             if (res == STATUS_OK)
+            {
+                drop_shared();
                 sync();
+            }
             return res;
         }
 
+        status_t Bitmap::load(BitmapCache *cache, const char *path, mm::IColorMap *map)
+        {
+            if (cache == NULL)
+                return load(path, map);
+
+            BitmapCache::image_t *image = NULL;
+            status_t res = cache->acquire(&image, path, map);
+            if (res != STATUS_OK)
+                return res;
+
+            drop_shared();
+            sBitmap.reset();
+            pImage      = image;
+            sync();
+
+            return STATUS_OK;
+        }
+
+        status_t Bitmap::load(BitmapCache *cache, const LSPString *path, mm::IColorMap *map)
+        {
+            if (cache == NULL)
+                return load(path, map);
+
+            BitmapCache::image_t *image = NULL;
+            status_t res = cache->acquire(&image, path, map);
+            if (res != STATUS_OK)
+                return res;
+
+            drop_shared();
+            sBitmap.reset();
+            pImage      = image;
+            sync();
+
+            return STATUS_OK;
+        }
+
         void Bitmap::swap(mm::Bitmap *src)
         {
+            if (detach() != STATUS_OK)
+                return;
             sBitmap.swap(src);
+            sScaled.clear();
             sync();
         }
 
         void Bitmap::swap(Bitmap *src)
         {
+            lsp::swap(pImage, src->pImage);
             sBitmap.swap(src->sBitmap);
+            sScaled.clear();
+            src->sScaled.clear();
             sync();
         }
     } /* namespace tk */
 } /* namespace lsp */
-
-
-
@@ -51,6 +51,17 @@ namespace lsp
             nStride     = 0;
             bStrobe     = false;
             pPtr        = NULL;
+
+            bTriple     = false;
+            nCapacity   = 0;
+            for (size_t i=0; i<3; ++i)
+            {
+                vFrames[i]      = NULL;
+                vFrameSize[i]   = 0;
+            }
+            nMiddle.store(1, std::memory_order_relaxed);
+            nFront      = 0;
+            nBack       = 2;
         }
 
         GraphMeshData::~GraphMeshData()
@@ -65,6 +76,7 @@ namespace lsp
             bStrobe     = false;
             nStride     = 0;
             pPtr        = NULL;
+            bTriple     = false;
         }
 
         void GraphMeshData::commit(atom_t property)
@@ -112,6 +124,8 @@ namespace lsp
             // Did not even changed?
             if ((nSize == size) && (bStrobe == strobe))
                 return true;
+            if (bTriple)
+                return false;
 
             // Need to re-allocate?
             size_t stride   = lsp::align_size(size*sizeof(float), DATA_ALIGNMENT) / sizeof(float);
@@ -263,6 +277,87 @@ namespace lsp
             return true;
         }
 
+        bool GraphMeshData::set_triple_buffer(size_t capacity)
+        {
+            if (bTriple)
+                return false;
+
+            // Allocate all three frames as a single block
+            size_t stride   = lsp::align_size(lsp_max(capacity, nSize)*sizeof(float), DATA_ALIGNMENT) / sizeof(float);
+            size_t nc       = (bStrobe) ? 3 : 2;
+            uint8_t *ptr    = NULL;
+            float *xp       = lsp::alloc_aligned<float>(ptr, stride * nc * 3, DATA_ALIGNMENT);
+            if (xp == NULL)
+                return false;
+            dsp::fill_zero(xp, stride * nc * 3);
+
+            // Initialize frames, the front frame receives the current data
+            for (size_t i=0; i<3; ++i)
+            {
+                vFrames[i]      = &xp[stride * nc * i];
+                vFrameSize[i]   = 0;
+            }
+            if (vData != NULL)
+            {
+                for (size_t i=0; i<nc; ++i)
+                    dsp::copy(&vFrames[0][stride * i], &vData[nStride * i], nSize);
+                lsp::free_aligned(pPtr);
+            }
+            vFrameSize[0]   = nSize;
+
+            nMiddle.store(1, std::memory_order_relaxed);
+            nFront          = 0;
+            nBack           = 2;
+            nCapacity       = stride;
+            nStride         = stride;
+            vData           = vFrames[0];
+            pPtr            = ptr;
+            bTriple         = true;
+
+            return true;
+        }
+
+        bool GraphMeshData::back_frame(frame_t *frame)
+        {
+            if (!bTriple)
+                return false;
+
+            float *data     = vFrames[nBack];
+            frame->x        = data;
+            frame->y        = &data[nStride];
+            frame->s        = (bStrobe) ? &data[nStride*2] : NULL;
+            frame->capacity = nCapacity;
+
+            return true;
+        }
+
+        bool GraphMeshData::publish(size_t size)
+        {
+            if ((!bTriple) || (size > nCapacity))
+                return false;
+
+            vFrameSize[nBack]   = size;
+            uint32_t prev       = nMiddle.exchange(nBack | FRAME_DIRTY, std::memory_order_acq_rel);
+            nBack               = prev & FRAME_INDEX;
+
+            return true;
+        }
+
+        bool GraphMeshData::fetch()
+        {
+            if (!bTriple)
+                return false;
+            if (!(nMiddle.load(std::memory_order_relaxed) & FRAME_DIRTY))
+                return false;
+
+            uint32_t prev       = nMiddle.exchange(nFront, std::memory_order_acq_rel);
+            nFront              = prev & FRAME_INDEX;
+            vData               = vFrames[nFront];
+            nSize               = vFrameSize[nFront];
+
+            return true;
+        }
+
     } /*namespace tk */
 } /* namespace lsp */
 
@@ -82,6 +82,7 @@ namespace lsp
 
             // Destroy named styles
             vBuiltin.flush();
+            vFactories.flush();
             for (lltl::iterator<Style> it = vStyles.values(); it; ++it)
             {
                 Style *s = *it;
@@ -97,8 +98,12 @@ namespace lsp
                 pRoot = NULL;
             }
 
-            // Destroy colors
+            // Destroy colors and fonts
             destroy_colors();
+            destroy_fonts();
+
+            // Detach interned strings which are still used by styles outside of the schema
+            sStrings.destroy();
         }
 
         void Schema::destroy_colors()
@@ -118,10 +123,52 @@ namespace lsp
             }
         }
 
-        status_t Schema::init_colors_from_sheet(const StyleSheet *sheet)
+        void Schema::destroy_fonts()
+        {
+            if (vFonts.is_empty())
+                return;
+
+            lltl::parray<StyleSheet::font_t> vf;
+            vFonts.values(&vf);
+            vFonts.flush();
+
+            for (size_t i=0, n=vf.size(); i<n; ++i)
+            {
+                StyleSheet::font_t *f = vf.get(i);
+                if (f != NULL)
+                    delete f;
+            }
+        }
+
+        bool Schema::colors_equal(const lsp::Color *a, const lsp::Color *b)
         {
+            return (a->red() == b->red()) &&
+                (a->green() == b->green()) &&
+                (a->blue() == b->blue()) &&
+                (a->alpha() == b->alpha());
+        }
+
+        status_t Schema::update_colors_from_sheet(const StyleSheet *sheet, lltl::parray<LSPString> *changed)
+        {
+            // Remove colors missing in the sheet
             lltl::parray<LSPString> vk;
-            sheet->vColors.keys(&vk);
+            if (!vColors.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *key      = vk.uget(i);
+                if (sheet->vColors.contains(key))
+                    continue;
+
+                lsp::Color *c       = NULL;
+                if ((vColors.remove(key, &c)) && (c != NULL))
+                    delete c;
+            }
+
+            // Update existing colors and add new ones
+            vk.clear();
+            if (!sheet->vColors.keys(&vk))
+                return STATUS_NO_MEM;
             for (size_t i=0, n=vk.size(); i<n; ++i)
             {
                 LSPString *key      = vk.uget(i);
@@ -129,13 +176,80 @@ namespace lsp
                 if ((key == NULL) || (color == NULL))
                     return STATUS_BAD_STATE;
 
-                lsp::Color *xc      = new lsp::Color(color);
-                if (xc == NULL)
+                lsp::Color *xc      = vColors.get(key);
+                if (xc != NULL)
+                {
+                    if (colors_equal(xc, color))
+                        continue;
+                    xc->copy(color);
+                }
+                else
+                {
+                    xc                  = new lsp::Color(color);
+                    if (xc == NULL)
+                        return STATUS_NO_MEM;
+
+                    if (!vColors.create(key, xc))
+                    {
+                        delete xc;
+                        return STATUS_NO_MEM;
+                    }
+                }
+
+                if (!changed->add(key))
                     return STATUS_NO_MEM;
+            }
+
+            return STATUS_OK;
+        }
+
+        bool Schema::fonts_changed(const StyleSheet *sheet) const
+        {
+            if (vFonts.size() != sheet->vFonts.size())
+                return true;
+
+            lltl::parray<LSPString> vk;
+            if (!sheet->vFonts.keys(&vk))
+                return true;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *key              = vk.uget(i);
+                const StyleSheet::font_t *a = vFonts.get(key);
+                const StyleSheet::font_t *b = sheet->vFonts.get(key);
+                if ((a == NULL) || (b == NULL))
+                    return true;
+                if ((a->alias != b->alias) || (!a->name.equals(&b->name)) || (!a->path.equals(&b->path)))
+                    return true;
+            }
+
+            return false;
+        }
+
+        status_t Schema::copy_fonts_from_sheet(const StyleSheet *sheet)
+        {
+            destroy_fonts();
 
-                if (!vColors.create(key, xc))
+            lltl::parray<LSPString> vk;
+            if (!sheet->vFonts.keys(&vk))
+                return STATUS_NO_MEM;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *key              = vk.uget(i);
+                const StyleSheet::font_t *f = sheet->vFonts.get(key);
+                if ((key == NULL) || (f == NULL))
+                    return STATUS_BAD_STATE;
+
+                StyleSheet::font_t *xf      = new StyleSheet::font_t;
+                if (xf == NULL)
+                    return STATUS_NO_MEM;
+                xf->alias                   = f->alias;
+                if ((!xf->name.set(&f->name)) ||
+                    (!xf->path.set(&f->path)) ||
+                    (!vFonts.create(key, xf)))
                 {
-                    delete xc;
+                    delete xf;
                     return STATUS_NO_MEM;
                 }
             }
@@ -250,10 +364,10 @@ namespace lsp
             // Initialize root style with properties
             bind(pRoot);
 
-            // Create all necessary styles
+            // Register all necessary styles, they will be created on demand
             for (size_t i=0; i<n; ++i)
             {
-                LSP_STATUS_ASSERT(create_builtin_style(list[i]));
+                LSP_STATUS_ASSERT(register_builtin_style(list[i]));
             }
 
             // Unset 'configuring' mode
@@ -280,7 +394,7 @@ namespace lsp
             // Create all necessary styles
             for (size_t i=0; i<n; ++i)
             {
-                LSP_STATUS_ASSERT(create_builtin_style(list[i]));
+                LSP_STATUS_ASSERT(register_builtin_style(list[i]));
             }
 
             // Unset 'configuring' mode
@@ -295,7 +409,7 @@ namespace lsp
             nFlags     |= S_CONFIGURING;
 
             // Create necessary style
-            LSP_STATUS_ASSERT(create_builtin_style(factory));
+            LSP_STATUS_ASSERT(register_builtin_style(factory));
 
             // Unset 'configuring' mode
             nFlags      = old;
@@ -332,6 +446,14 @@ namespace lsp
                 if (s != NULL)
                     continue;
 
+                // Builtin style has not been instantiated yet?
+                if (vFactories.contains(name))
+                {
+                    if (create_builtin_style(name) == NULL)
+                        return STATUS_NO_MEM;
+                    continue;
+                }
+
                 // Create new unbound style
                 if ((res = create_style(name)) != STATUS_OK)
                     return res;
@@ -341,122 +463,233 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Schema::link_styles(const StyleSheet *sheet)
+        StyleSheet::style_t *Schema::sheet_style(Style *s, const StyleSheet *sheet)
+        {
+            if (s == pRoot)
+                return sheet->pRoot;
+
+            LSPString name;
+            if (!name.set_utf8(s->name()))
+                return NULL;
+            return sheet->vStyles.get(&name);
+        }
+
+        status_t Schema::style_parents(lltl::parray<Style> *dst, Style *s, const StyleSheet *sheet)
+        {
+            // Style sheet defines parents explicitly?
+            StyleSheet::style_t *xs = sheet_style(s, sheet);
+            if (xs != NULL)
+                return resolve_parents(dst, &xs->parents);
+
+            // Keep relations of the root style if there is no root style in the sheet
+            if (s == pRoot)
+            {
+                for (size_t i=0, n=s->parents(); i<n; ++i)
+                    if (!dst->add(s->parent(i)))
+                        return STATUS_NO_MEM;
+                return STATUS_OK;
+            }
+
+            const char *default_parents = s->default_parents();
+            return resolve_parents(dst, (default_parents != NULL) ? default_parents : "root");
+        }
+
+        status_t Schema::unlink_styles(const StyleSheet *sheet)
         {
-            // List all possible styles sheet names
             status_t res;
-            lltl::parray<LSPString>  vss;
-            if (!vStyles.keys(&vss))
+            lltl::parray<Style> vs, parents;
+            if (!vStyles.values(&vs))
+                return STATUS_NO_MEM;
+            if (!vs.add(pRoot))
                 return STATUS_NO_MEM;
 
-            // For each style: link it to parents and reset the 'configured' flag
-            for (size_t i=0, n=vss.size(); i<n; ++i)
+            // Detach only styles which change the list of parents, this should be done
+            // before linking to avoid false detection of cyclic dependencies
+            for (size_t i=0, n=vs.size(); i<n; ++i)
             {
-                LSPString *name         = vss.uget(i);
-                Style *s                = vStyles.get(name);
+                Style *s = vs.uget(i);
                 if (s == NULL)
                     continue;
 
-                // Reset the 'configured' flag for styles
                 s->set_configured(false);
 
-                // Link to parents
-                StyleSheet::style_t *xs = sheet->vStyles.get(name);
-                if (xs != NULL)
-                {
-                    //lsp_trace("Linking style '%s'", name->get_utf8());
-                    res = apply_relations(s, &xs->parents);
-                }
-                else
-                {
-                    const char *default_parents = s->default_parents();
-                    if (default_parents == NULL)
-                        default_parents = "root";
-                    //lsp_trace("Linking style '%s' to default parents: '%s'", name->get_utf8(), default_parents);
-                    res = apply_relations(s, default_parents);
-                }
-
-                if (res != STATUS_OK)
+                parents.clear();
+                if ((res = style_parents(&parents, s, sheet)) != STATUS_OK)
                     return res;
+                if (!s->has_parents(&parents))
+                    s->detach_parents();
             }
 
             return STATUS_OK;
         }
 
-        bool Schema::check_parents_configured(Style *s)
+        status_t Schema::link_style(Style *s, const StyleSheet *sheet, lltl::parray<Style> *order)
         {
-            for (size_t i=0, n=s->parents(); i<n; ++i)
+            // Each style is visited only once, the 'configured' flag is used as a mark
+            if (s->configured())
+                return STATUS_OK;
+            s->set_configured(true);
+
+            status_t res;
+            lltl::parray<Style> parents;
+            if ((res = style_parents(&parents, s, sheet)) != STATUS_OK)
+                return res;
+
+            // Link parents first, this forms the topological order of styles
+            for (size_t i=0, n=parents.size(); i<n; ++i)
             {
-                Style *sp = s->parent(i);
-                if ((sp != NULL) && (!sp->configured()))
-                    return false;
+                if ((res = link_style(parents.uget(i), sheet, order)) != STATUS_OK)
+                    return res;
             }
 
-            return true;
+            // Attach parents if they have been detached
+            if (!s->has_parents(&parents))
+            {
+                //lsp_trace("Linking style '%s'", s->name());
+                if ((res = s->attach_parents(&parents)) != STATUS_OK)
+                    return res;
+            }
+
+            return (order->add(s)) ? STATUS_OK : STATUS_NO_MEM;
         }
 
-        status_t Schema::configure_styles(const StyleSheet *sheet)
+        status_t Schema::link_styles(const StyleSheet *sheet, lltl::parray<Style> *order)
         {
-            // List all possible styles sheet names
             status_t res;
-            lltl::parray<LSPString> vss;
-            if (!vStyles.keys(&vss))
+            lltl::parray<Style> vs;
+            if (!vStyles.values(&vs))
                 return STATUS_NO_MEM;
 
-            // Initialize all styles in the order of their inheritance
-            for (size_t i=0; vss.size() > 0; )
+            if (pRoot != NULL)
             {
-                i                      %= vss.size();
-                LSPString *name         = vss.uget(i);
-                Style *s                = vStyles.get(name);
+                if ((res = link_style(pRoot, sheet, order)) != STATUS_OK)
+                    return res;
+            }
 
-                // Style does not exists or is already configured?
-                if ((s == NULL) || (s->configured()))
-                {
-                    vss.remove(i); // Remove the key
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                Style *s = vs.uget(i);
+                if (s == NULL)
                     continue;
-                }
+                if ((res = link_style(s, sheet, order)) != STATUS_OK)
+                    return res;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t Schema::configure_styles(const StyleSheet *sheet, const lltl::parray<Style> *order, const lltl::parray<LSPString> *colors)
+        {
+            status_t res;
+            lltl::darray<color_ref_t> refs;
 
-                // Is there stylesheet present for this style?
-                StyleSheet::style_t *xs = sheet->vStyles.get(name);
+            // Parents always precede children in the list, so each style is configured only once
+            for (size_t i=0, n=order->size(); i<n; ++i)
+            {
+                Style *s                = order->uget(i);
+                StyleSheet::style_t *xs = sheet_style(s, sheet);
                 if (xs == NULL)
-                {
-                    s->set_configured(true);
-                    vss.remove(i); // Remove the key
                     continue;
-                }
 
-                // Check that parents of this style already have been configured
-                if (check_parents_configured(s))
+                //lsp_trace("Configuring style '%s'", s->name());
+                if ((res = apply_settings(s, xs)) != STATUS_OK)
+                    return res;
+                if (colors->size() > 0)
                 {
-                    //lsp_trace("Configuring style '%s'", name->get_utf8());
-                    if ((res = apply_settings(s, xs)) != STATUS_OK)
+                    if ((res = find_color_refs(&refs, s, xs, colors)) != STATUS_OK)
                         return res;
+                }
+            }
 
-                    s->set_configured(true);
-                    vss.remove(i); // Remove the key
+            // Refresh properties only after all styles have been configured
+            return refresh_colors(&refs);
+        }
+
+        bool Schema::is_color_char(lsp_wchar_t ch)
+        {
+            return
+                ((ch >= 'a') && (ch <= 'z')) ||
+                ((ch >= 'A') && (ch <= 'Z')) ||
+                ((ch >= '0') && (ch <= '9')) ||
+                (ch == '_') || (ch == '.') || (ch == '-') || (ch == '#') || (ch == '@');
+        }
+
+        bool Schema::refers_color(const LSPString *value, const LSPString *color)
+        {
+            // The name of color should be the whole token of the value
+            const ssize_t len = color->length();
+            if (len <= 0)
+                return false;
+
+            for (ssize_t first = 0; (first = value->index_of(first, color)) >= 0; ++first)
+            {
+                const ssize_t last = first + len;
+                if ((first > 0) && (is_color_char(value->char_at(first - 1))))
                     continue;
-                }
+                if ((last < ssize_t(value->length())) && (is_color_char(value->char_at(last))))
+                    continue;
+                return true;
+            }
+
+            return false;
+        }
 
-                // Increment the position
-                ++i;
+        status_t Schema::find_color_refs(lltl::darray<color_ref_t> *refs, Style *s, StyleSheet::style_t *xs, const lltl::parray<LSPString> *colors)
+        {
+            // Properties that refer named colors do not change their values when the color changes,
+            // so listeners should be notified explicitly
+            for (lltl::iterator<lltl::pair<LSPString, StyleSheet::property_t>> it = xs->properties.items(); it; ++it)
+            {
+                const StyleSheet::property_t *prop = it->value;
+                if ((prop->type != PT_STRING) && (prop->type != PT_UNKNOWN))
+                    continue;
+
+                for (size_t i=0, n=colors->size(); i<n; ++i)
+                {
+                    if (!refers_color(&prop->value, colors->uget(i)))
+                        continue;
+
+                    atom_t id = pAtoms->atom_id(it->key);
+                    if (id < 0)
+                        break;
+
+                    color_ref_t *ref = refs->add();
+                    if (ref == NULL)
+                        return STATUS_NO_MEM;
+                    ref->style      = s;
+                    ref->id         = id;
+                    break;
+                }
             }
 
             return STATUS_OK;
         }
 
-        status_t Schema::unlink_styles()
+        status_t Schema::refresh_colors(const lltl::darray<color_ref_t> *refs)
         {
-            lltl::parray<Style> vs;
-            if (!vStyles.values(&vs))
-                return STATUS_NO_MEM;
+            lltl::phashset<Style> visited;
 
-            for (size_t i=0, n=vs.size(); i<n; ++i)
+            // Styles may inherit the property by several paths, notify each style only once per property
+            for (size_t i=0, n=refs->size(); i<n; ++i)
             {
-                Style *s = vs.uget(i);
-                if (s != NULL)
-                    s->remove_all_parents();
+                const atom_t id = refs->uget(i)->id;
+
+                // Skip the property if it has already been processed
+                size_t k = 0;
+                while ((k < i) && (refs->uget(k)->id != id))
+                    ++k;
+                if (k < i)
+                    continue;
+
+                visited.flush();
+                for (size_t j=i; j<n; ++j)
+                {
+                    const color_ref_t *ref = refs->uget(j);
+                    if (ref->id == id)
+                        ref->style->refresh_property(id, &visited);
+                }
             }
+
             return STATUS_OK;
         }
 
@@ -464,45 +697,34 @@ namespace lsp
         {
             status_t res;
 
-            // Destroy all previously loaded and used fonts and apply new
-            if (pDisplay != NULL)
+            // Reload fonts only if the set of fonts has been changed
+            if ((pDisplay != NULL) && (fonts_changed(sheet)))
             {
                 pDisplay->display()->remove_all_fonts();
                 load_fonts_from_sheet(sheet, loader);
+                if ((res = copy_fonts_from_sheet(sheet)) != STATUS_OK)
+                    return res;
             }
 
-            // Destroy colors and copy colors from sheed
-            destroy_colors();
-            if ((res = init_colors_from_sheet(sheet)) != STATUS_OK)
-                return res;
-
-            // Destroy all relations between styles
-            if ((res = unlink_styles()) != STATUS_OK)
+            // Update colors and obtain the list of changed ones
+            lltl::parray<LSPString> colors;
+            if ((res = update_colors_from_sheet(sheet, &colors)) != STATUS_OK)
                 return res;
 
             // Create missing styles
             if ((res = create_missing_styles(sheet)) != STATUS_OK)
                 return res;
 
-            // Link root style and other styles
-            //lsp_trace("Linking root style");
-            if (sheet->pRoot != NULL)
-            {
-                if ((res = apply_relations(pRoot, &sheet->pRoot->parents)) != STATUS_OK)
-                    return res;
-            }
-            if ((res = link_styles(sheet)) != STATUS_OK)
+            // Change relations only for styles which have different parents and compute the
+            // topological order of styles
+            lltl::parray<Style> order;
+            if ((res = unlink_styles(sheet)) != STATUS_OK)
+                return res;
+            if ((res = link_styles(sheet, &order)) != STATUS_OK)
                 return res;
 
-            // Configure root style and others
-            //lsp_trace("Configuring root style");
-            if (sheet->pRoot != NULL)
-            {
-                if ((res = apply_settings(pRoot, sheet->pRoot)) != STATUS_OK)
-                    return res;
-                pRoot->set_configured(true);
-            }
-            if ((res = configure_styles(sheet)) != STATUS_OK)
+            // Configure styles, properties notify listeners only if their values have changed
+            if ((res = configure_styles(sheet, &order, &colors)) != STATUS_OK)
                 return res;
 
             // Update schema version
@@ -528,7 +750,7 @@ namespace lsp
                     return false;
 
                 p->name = it->key;
-                p->value = &it->value->value;
+                p->value = it->value;
                 p->order = it->value->order;
             }
 
@@ -556,11 +778,11 @@ namespace lsp
 //                    s->name(),
 //                    prop->name->get_utf8(),
 //                    int(prop->order),
-//                    prop->value->get_utf8(),
+//                    prop->value->value.get_utf8(),
 //                    int(pAtoms->atom_id(prop->name))
 //                );
 
-                if (parse_property_value(&v, prop->value, type) == STATUS_OK)
+                if (resolve_property_value(&v, prop->value, type) == STATUS_OK)
                 {
                     bool over = s->set_override(true);
                     switch (v.type)
@@ -581,26 +803,30 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Schema::apply_relations(Style *s, const lltl::parray<LSPString> *parents)
+        status_t Schema::resolve_parents(lltl::parray<Style> *dst, const LSPString *parent)
+        {
+            Style *ps = find_style(parent);
+            if ((ps == NULL) || (dst->index_of(ps) >= 0))
+                return STATUS_OK;
+
+//            lsp_trace("  parent: %s", parent->get_utf8());
+            return (dst->add(ps)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        status_t Schema::resolve_parents(lltl::parray<Style> *dst, const lltl::parray<LSPString> *parents)
         {
             status_t res;
 
             for (size_t i=0, n=parents->size(); i<n; ++i)
             {
-                const LSPString *parent = parents->uget(i);
-                Style *ps = (parent->equals_ascii("root")) ? pRoot : vStyles.get(parent);
-                if (ps != NULL)
-                {
-//                    lsp_trace("  parent: %s", parent->get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
-                        return res;
-                }
+                if ((res = resolve_parents(dst, parents->uget(i))) != STATUS_OK)
+                    return res;
             }
 
             return STATUS_OK;
         }
 
-        status_t Schema::apply_relations(Style *s, const char *list)
+        status_t Schema::resolve_parents(lltl::parray<Style> *dst, const char *list)
         {
             status_t res;
             LSPString parent, text;
@@ -620,15 +846,9 @@ namespace lsp
                 }
 
                 if (!parent.set(&text, first, last))
-                    return false;
-
-                Style *ps = (parent.equals_ascii("root")) ? pRoot : vStyles.get(&parent);
-                if (ps != NULL)
-                {
-//                    lsp_trace("  parent: %s", parent.get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
-                        return res;
-                }
+                    return STATUS_NO_MEM;
+                if ((res = resolve_parents(dst, &parent)) != STATUS_OK)
+                    return res;
 
                 first = last + 1;
             }
@@ -637,21 +857,15 @@ namespace lsp
             if (last > first)
             {
                 if (!parent.set(&text, first, last))
-                    return false;
-
-                Style *ps = (parent.equals_ascii("root")) ? pRoot : vStyles.get(&parent);
-                if (ps != NULL)
-                {
-//                    lsp_trace("  parent: %s", parent.get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
-                        return res;
-                }
+                    return STATUS_NO_MEM;
+                if ((res = resolve_parents(dst, &parent)) != STATUS_OK)
+                    return res;
             }
 
             return STATUS_OK;
         }
 
-        status_t Schema::create_builtin_style(IStyleFactory *init)
+        status_t Schema::register_builtin_style(IStyleFactory *init)
         {
             LSPString name;
 
@@ -660,38 +874,67 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             // Duplicates are disallowed
-            if (vStyles.contains(&name))
+            if ((vStyles.contains(&name)) || (vFactories.contains(&name)))
             {
                 lsp_warn("Duplicate style name: %s", init->name());
                 return STATUS_ALREADY_EXISTS;
             }
 
+            // The style will be created on the first demand
+            return (vFactories.create(&name, init)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        Style *Schema::create_builtin_style(const LSPString *name)
+        {
+            IStyleFactory *init = vFactories.get(name);
+            if (init == NULL)
+                return NULL;
+
+            // Builtin style should be created in configuration mode to set up default values
+            size_t old      = nFlags;
+            nFlags         |= S_CONFIGURING;
+            lsp_finally { nFlags = old; };
+
             // Create style
 //            lsp_trace("Creating style '%s' with default parents '%s'...", init->name(), init->default_parents());
             Style *style    = init->create(this);
             if (style == NULL)
-                return STATUS_NO_MEM;
+                return NULL;
 
-            // Initialize style and bind to Root by default
-            status_t res    = style->add_parent(pRoot);
-            if (res != STATUS_OK)
+            // Register style in the list before resolving parents, the factory is kept until
+            // the style is completely registered so the creation can be retried on failure
+            if (!vStyles.create(name, style))
             {
                 delete style;
-                return res;
+                return NULL;
             }
-
-            // Register style in the list
-            if (!vStyles.create(&name, style))
+            if (!vBuiltin.create(name, style))
             {
+                vStyles.remove(name, NULL);
                 delete style;
-                return STATUS_NO_MEM;
+                return NULL;
             }
+            vFactories.remove(name, NULL);
+
+            // Bind to default parents, they are also created on demand
+            lltl::parray<Style> parents;
+            const char *default_parents = style->default_parents();
+            status_t res    = resolve_parents(&parents, (default_parents != NULL) ? default_parents : "root");
+            if (res == STATUS_OK)
+                res             = style->attach_parents(&parents);
+            if (res != STATUS_OK)
+                lsp_warn("Could not link style '%s' to parents '%s', error code %d", init->name(), default_parents, int(res));
 
-            // Register style in the list
-            if (!vBuiltin.create(&name, style))
-                return STATUS_NO_MEM;
+            return style;
+        }
 
-            return STATUS_OK;
+        Style *Schema::find_style(const LSPString *name)
+        {
+            if (name->equals_ascii("root"))
+                return pRoot;
+
+            Style *s = vStyles.get(name);
+            return (s != NULL) ? s : create_builtin_style(name);
         }
 
         status_t Schema::create_style(const LSPString *name)
@@ -806,6 +1049,60 @@ namespace lsp
             return (tok.get_token(expr::TF_GET) == expr::TT_EOF) ? STATUS_OK : STATUS_BAD_FORMAT;
         }
     
+        status_t Schema::resolve_property_value(property_value_t *v, const StyleSheet::property_t *prop, property_type_t pt)
+        {
+            // Use the value pre-resolved by the style sheet if it matches the requested type
+            switch (pt)
+            {
+                case PT_BOOL:
+                    if (prop->type != PT_BOOL)
+                        break;
+                    v->bvalue       = prop->bvalue;
+                    v->type         = PT_BOOL;
+                    return STATUS_OK;
+
+                case PT_INT:
+                    if (prop->type != PT_INT)
+                        break;
+                    v->ivalue       = prop->ivalue;
+                    v->type         = PT_INT;
+                    return STATUS_OK;
+
+                case PT_FLOAT:
+                    if (prop->type == PT_FLOAT)
+                        v->fvalue       = prop->fvalue;
+                    else if (prop->type == PT_INT)
+                        v->fvalue       = prop->ivalue;
+                    else
+                        break;
+                    v->type         = PT_FLOAT;
+                    return STATUS_OK;
+
+                case PT_STRING:
+                    break;
+
+                default:
+                    if (prop->type == PT_BOOL)
+                        v->bvalue       = prop->bvalue;
+                    else if (prop->type == PT_INT)
+                        v->ivalue       = prop->ivalue;
+                    else if (prop->type == PT_FLOAT)
+                        v->fvalue       = prop->fvalue;
+                    else if (prop->type == PT_STRING)
+                    {
+                        if (!v->svalue.set(&prop->value))
+                            return STATUS_NO_MEM;
+                    }
+                    else
+                        break;
+                    v->type         = prop->type;
+                    return STATUS_OK;
+            }
+
+            // Parse the text value
+            return parse_property_value(v, &prop->value, pt);
+        }
+
         Style *Schema::get(const char *id)
         {
             LSPString tmp;
@@ -821,6 +1118,10 @@ namespace lsp
             if (s != NULL)
                 return s;
 
+            // Instantiate builtin style
+            if (vFactories.contains(id))
+                return create_builtin_style(id);
+
             // Create style
             s = new Style(this, id->get_utf8(), NULL);
             if (s == NULL)
@@ -882,6 +1183,16 @@ namespace lsp
             return pAtoms->atom_name(id);
         }
 
+        const atom_t *Schema::composite_atoms(atom_t base, const prop::desc_t *desc) const
+        {
+            return pAtoms->composite_atoms(base, desc);
+        }
+
+        const atom_t *Schema::composite_atoms(atom_t base, const char * const *postfix) const
+        {
+            return pAtoms->composite_atoms(base, postfix);
+        }
+
         status_t Schema::get_language(LSPString *dst) const
         {
             // Check state
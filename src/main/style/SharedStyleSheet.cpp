@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/tk/style/SharedStyleSheet.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        ipc::Mutex SharedStyleSheet::sLock;
+        lltl::parray<shared_stylesheet_t> SharedStyleSheet::vEntries;
+
+        status_t SharedStyleSheet::acquire(
+            shared_stylesheet_t **entry,
+            const char *path, const digest_t *stamp,
+            loader_t loader, void *arg)
+        {
+            if ((entry == NULL) || (path == NULL) || (stamp == NULL) || (loader == NULL))
+                return STATUS_BAD_ARGUMENTS;
+
+            LSPString key;
+            if (!key.set_utf8(path))
+                return STATUS_NO_MEM;
+
+            // Loading is performed under the lock, so concurrently opened
+            // displays wait for the style sheet instead of loading a copy
+            if (!sLock.lock())
+                return STATUS_UNKNOWN_ERR;
+            lsp_finally { sLock.unlock(); };
+
+            // Lookup for the already loaded style sheet
+            for (size_t i=0, n=vEntries.size(); i<n; ++i)
+            {
+                shared_stylesheet_t *item = vEntries.uget(i);
+                if ((digest_equals(&item->sStamp, stamp)) && (item->sPath.equals(&key)))
+                {
+                    ++item->nRefs;
+                    *entry      = item;
+                    return STATUS_OK;
+                }
+            }
+
+            // Load new style sheet
+            shared_stylesheet_t *e = new shared_stylesheet_t;
+            if (e == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally {
+                if (e != NULL)
+                    delete e;
+            };
+            e->sPath.swap(&key);
+            e->sStamp   = *stamp;
+            e->nRefs    = 1;
+
+            status_t res = loader(&e->sSheet, arg);
+            if (res != STATUS_OK)
+                return res;
+            if (!vEntries.add(e))
+                return STATUS_NO_MEM;
+
+            *entry      = e;
+            e           = NULL;
+
+            return STATUS_OK;
+        }
+
+        void SharedStyleSheet::release(shared_stylesheet_t *entry)
+        {
+            if (entry == NULL)
+                return;
+
+            if (!sLock.lock())
+                return;
+
+            bool removed = ((--entry->nRefs) == 0);
+            if (removed)
+                vEntries.premove(entry);
+
+            sLock.unlock();
+
+            // Destroy the style sheet outside of the lock
+            if (removed)
+                delete entry;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
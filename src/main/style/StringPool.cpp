@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        // The header of the empty string followed by the zeroed terminator
+        static StringPool::string_t empty_string[2];
+
+        StringPool::StringPool()
+        {
+            vBins       = NULL;
+            nBins       = 0;
+            nSize       = 0;
+        }
+
+        StringPool::~StringPool()
+        {
+            destroy();
+        }
+
+        void StringPool::destroy()
+        {
+            if (vBins == NULL)
+                return;
+
+            // Detach strings, they are freed on release of the last reference
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (string_t *s = vBins[i]; s != NULL; )
+                {
+                    string_t *next  = s->pNext;
+                    s->pNext        = NULL;
+                    s->pPool        = NULL;
+                    s               = next;
+                }
+            }
+
+            ::free(vBins);
+            vBins       = NULL;
+            nBins       = 0;
+            nSize       = 0;
+        }
+
+        size_t StringPool::hash(const char *s, size_t len)
+        {
+            // FNV-1a hash
+            size_t h    = 2166136261U;
+            for (size_t i=0; i<len; ++i)
+            {
+                h          ^= uint8_t(s[i]);
+                h          *= 16777619U;
+            }
+            return h;
+        }
+
+        bool StringPool::grow()
+        {
+            const size_t bins   = (nBins > 0) ? nBins << 1 : POOL_INITIAL_BINS;
+            string_t **vb       = static_cast<string_t **>(::calloc(bins, sizeof(string_t *)));
+            if (vb == NULL)
+                return false;
+
+            // Re-distribute strings between bins
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (string_t *s = vBins[i]; s != NULL; )
+                {
+                    string_t *next  = s->pNext;
+                    string_t **bin  = &vb[s->nHash & (bins - 1)];
+                    s->pNext        = *bin;
+                    *bin            = s;
+                    s               = next;
+                }
+            }
+
+            if (vBins != NULL)
+                ::free(vBins);
+            vBins               = vb;
+            nBins               = bins;
+
+            return true;
+        }
+
+        void StringPool::remove(string_t *s)
+        {
+            for (string_t **p = &vBins[s->nHash & (nBins - 1)]; *p != NULL; p = &(*p)->pNext)
+            {
+                if (*p == s)
+                {
+                    *p          = s->pNext;
+                    --nSize;
+                    return;
+                }
+            }
+        }
+
+        StringPool::string_t *StringPool::intern(const char *s)
+        {
+            const size_t len    = ::strlen(s);
+            if (len <= 0)
+                return empty_string;
+
+            // Lookup for existing string
+            const size_t h      = hash(s, len);
+            if (vBins != NULL)
+            {
+                for (string_t *xs = vBins[h & (nBins - 1)]; xs != NULL; xs = xs->pNext)
+                {
+                    if ((xs->nHash == h) && (xs->nLength == len) && (::memcmp(data(xs), s, len) == 0))
+                    {
+                        ++xs->nRefs;
+                        return xs;
+                    }
+                }
+            }
+
+            // Keep the load factor below 1
+            if ((nSize >= nBins) && (!grow()))
+                return NULL;
+
+            // Create new string
+            string_t *xs        = static_cast<string_t *>(::malloc(sizeof(string_t) + len + 1));
+            if (xs == NULL)
+                return NULL;
+
+            string_t **bin      = &vBins[h & (nBins - 1)];
+            xs->pNext           = *bin;
+            xs->pPool           = this;
+            xs->nHash           = h;
+            xs->nRefs           = 1;
+            xs->nLength         = len;
+            ::memcpy(data(xs), s, len + 1);
+            *bin                = xs;
+            ++nSize;
+
+            return xs;
+        }
+
+        StringPool::string_t *StringPool::copy(const char *s)
+        {
+            const size_t len    = ::strlen(s);
+            if (len <= 0)
+                return empty_string;
+
+            string_t *xs        = static_cast<string_t *>(::malloc(sizeof(string_t) + len + 1));
+            if (xs == NULL)
+                return NULL;
+
+            xs->pNext           = NULL;
+            xs->pPool           = NULL;
+            xs->nHash           = hash(s, len);
+            xs->nRefs           = 1;
+            xs->nLength         = len;
+            ::memcpy(data(xs), s, len + 1);
+
+            return xs;
+        }
+
+        StringPool::string_t *StringPool::empty()
+        {
+            return empty_string;
+        }
+
+        StringPool::string_t *StringPool::acquire(string_t *s)
+        {
+            if ((s != NULL) && (s != empty_string))
+                ++s->nRefs;
+            return s;
+        }
+
+        void StringPool::release(string_t *s)
+        {
+            if ((s == NULL) || (s == empty_string))
+                return;
+            if ((--s->nRefs) > 0)
+                return;
+
+            if (s->pPool != NULL)
+                s->pPool->remove(s);
+            ::free(s);
+        }
+
+        size_t StringPool::memory(const string_t *s)
+        {
+            if ((s == NULL) || (s == empty_string))
+                return 0;
+
+            return (sizeof(string_t) + s->nLength + 1) / s->nRefs;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
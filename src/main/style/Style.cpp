@@ -78,12 +78,16 @@ namespace lsp
 
             // Synchronize state with listeners and remove them
             synchronize();
+            for (size_t i=0, n=vListeners.size(); i<n; ++i)
+                release_shared(vListeners.uget(i));
             vListeners.flush();
 
             // Destroy stored properties
             for (size_t i=0, n=vProperties.size(); i<n; ++i)
                 undef_property(vProperties.uget(i));
             vProperties.flush();
+            vPending.flush();
+            vNotify.flush();
 
             // Destroy name
             if (sName != NULL)
@@ -108,16 +112,10 @@ namespace lsp
             switch (property->type)
             {
                 case PT_STRING:
-                    if (property->v.sValue != NULL)
-                    {
-                        ::free(property->v.sValue);
-                        property->v.sValue      = NULL;
-                    }
-                    if (property->dv.sValue != NULL)
-                    {
-                        ::free(property->dv.sValue);
-                        property->dv.sValue     = NULL;
-                    }
+                    StringPool::release(property->v.sValue);
+                    StringPool::release(property->dv.sValue);
+                    property->v.sValue      = NULL;
+                    property->dv.sValue     = NULL;
                     break;
                 default:
                     break;
@@ -205,26 +203,20 @@ namespace lsp
                     break;
                 case PT_STRING:
                 {
-                    // Update value if it has changed
-                    if (::strcmp(dst->v.sValue, src->v.sValue) != 0)
+                    // Strings are interned by the schema, equal strings have the same pointer
+                    if (dst->v.sValue != src->v.sValue)
                     {
-                        char *tmp = ::strdup(src->v.sValue);
-                        if (tmp == NULL)
-                            return STATUS_NO_MEM;
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = tmp;
                         ++dst->changes;
+                        StringPool::release(dst->v.sValue);
+                        dst->v.sValue   = StringPool::acquire(src->v.sValue);
                     }
 
                     // Copy default value in INIT mode
-                    if ((config) && (::strcmp(dst->dv.sValue, src->dv.sValue) != 0))
+                    if ((config) && (dst->dv.sValue != src->dv.sValue))
                     {
-                        char *tmp = ::strdup(src->dv.sValue);
-                        if (tmp == NULL)
-                            return STATUS_NO_MEM;
-                        ::free(dst->dv.sValue);
-                        dst->dv.sValue  = tmp;
                         ++dst->changes;
+                        StringPool::release(dst->dv.sValue);
+                        dst->dv.sValue  = StringPool::acquire(src->dv.sValue);
                     }
                     break;
                 }
@@ -259,25 +251,10 @@ namespace lsp
                     dst->dv.bValue  = (config) ? src->dv.bValue : false;
                     break;
                 case PT_STRING:
-                {
-                    // Update value
-                    if ((dst->v.sValue = ::strdup(src->v.sValue)) == NULL)
-                    {
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
-
-                    // Update default value
-                    const char *dv = (config) ? src->dv.sValue : "";
-                    if ((dst->dv.sValue = ::strdup(dv)) == NULL)
-                    {
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
+                    // Values are shared with the source until they get changed
+                    dst->v.sValue   = StringPool::acquire(src->v.sValue);
+                    dst->dv.sValue  = (config) ? StringPool::acquire(src->dv.sValue) : StringPool::empty();
                     break;
-                }
                 default:
                     return NULL;
             }
@@ -289,6 +266,8 @@ namespace lsp
             dst->flags      = flags;
             dst->owner      = this;
 
+            adopt_listeners(dst);
+
             return dst;
         }
 
@@ -315,18 +294,8 @@ namespace lsp
                     dst->dv.bValue  = false;
                     break;
                 case PT_STRING:
-                    if ((dst->v.sValue = ::strdup("")) == NULL)
-                    {
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
-                    if ((dst->dv.sValue = ::strdup("")) == NULL)
-                    {
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
+                    dst->v.sValue   = StringPool::empty();
+                    dst->dv.sValue  = StringPool::empty();
                     break;
                 default:
                     return NULL;
@@ -339,9 +308,160 @@ namespace lsp
             dst->flags      = flags;
             dst->owner      = this;
 
+            adopt_listeners(dst);
+
             return dst;
         }
 
+        void Style::adopt_listeners(property_t *p)
+        {
+            // The local copy of the property has been created, shared listeners observe it from now on
+            for (size_t i=0, n=vListeners.size(); i<n; ++i)
+            {
+                listener_t *lst = vListeners.uget(i);
+                if ((!lst->bShared) || (lst->nId != p->id))
+                    continue;
+
+                release_shared(lst);
+                lst->bShared    = false;
+                if (lst->bNotify)
+                    p->flags       |= F_NTF_LISTENERS;
+                ++p->refs;
+            }
+        }
+
+        void Style::share_properties()
+        {
+            for (ssize_t i=vProperties.size() - 1; i >= 0; --i)
+            {
+                property_t *p   = vProperties.uget(i);
+                if ((p->flags & (F_OVERRIDDEN | F_QUEUED)) || (p->refs <= 0))
+                    continue;
+
+                const property_t *parent = get_parent_property(p->id);
+                if ((parent == NULL) || (parent->type != p->type))
+                    continue;
+
+                // Listeners observe the property of parent style from now on
+                for (size_t j=0, n=vListeners.size(); j<n; ++j)
+                {
+                    listener_t *lst = vListeners.uget(j);
+                    if ((lst->bShared) || (lst->nId != p->id))
+                        continue;
+
+                    lst->bNotify        = false;
+                    lst->bShared        = true;
+                    lst->nType          = PT_UNKNOWN;
+                    lst->sValue.iValue  = 0;
+                    update_shared(lst, parent);
+                }
+
+                undef_property(p);
+                vProperties.premove(p);
+            }
+        }
+
+        void Style::release_shared(listener_t *lst)
+        {
+            if ((lst->bShared) && (lst->nType == PT_STRING))
+                StringPool::release(lst->sValue.sValue);
+            lst->nType          = PT_UNKNOWN;
+            lst->sValue.iValue  = 0;
+        }
+
+        bool Style::update_shared(listener_t *lst, const property_t *src)
+        {
+            // Property which is not inherited anymore is observed with the default value
+            property_t dfl;
+            if (src == NULL)
+            {
+                dfl.type        = lst->nType;
+                switch (dfl.type)
+                {
+                    case PT_INT:    dfl.v.iValue    = 0;                    break;
+                    case PT_FLOAT:  dfl.v.fValue    = 0.0f;                 break;
+                    case PT_BOOL:   dfl.v.bValue    = false;                break;
+                    case PT_STRING: dfl.v.sValue    = StringPool::empty();  break;
+                    default:
+                        return false;
+                }
+                src             = &dfl;
+            }
+
+            const property_type_t type = src->type;
+
+            // Compare with the last observed value
+            if (type == lst->nType)
+            {
+                switch (type)
+                {
+                    case PT_INT:
+                        if (lst->sValue.iValue == src->v.iValue)
+                            return false;
+                        lst->sValue.iValue  = src->v.iValue;
+                        return true;
+                    case PT_FLOAT:
+                        if (lst->sValue.fValue == src->v.fValue)
+                            return false;
+                        lst->sValue.fValue  = src->v.fValue;
+                        return true;
+                    case PT_BOOL:
+                        if (lst->sValue.bValue == src->v.bValue)
+                            return false;
+                        lst->sValue.bValue  = src->v.bValue;
+                        return true;
+                    case PT_STRING:
+                        // Strings are interned by the schema, equal strings have the same pointer
+                        if (lst->sValue.sValue == src->v.sValue)
+                            return false;
+                        StringPool::release(lst->sValue.sValue);
+                        lst->sValue.sValue  = StringPool::acquire(src->v.sValue);
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            // Type of the observed value has changed
+            release_shared(lst);
+            lst->nType          = type;
+            switch (type)
+            {
+                case PT_INT:    lst->sValue.iValue  = src->v.iValue;    break;
+                case PT_FLOAT:  lst->sValue.fValue  = src->v.fValue;    break;
+                case PT_BOOL:   lst->sValue.bValue  = src->v.bValue;    break;
+                case PT_STRING: lst->sValue.sValue  = StringPool::acquire(src->v.sValue); break;
+                default: break;
+            }
+
+            return true;
+        }
+
+        void Style::notify_shared(atom_t id, bool force)
+        {
+            // Listeners may bind and unbind properties, so the list is re-read at each iteration
+            for (size_t i=0; i<vListeners.size(); ++i)
+            {
+                listener_t *lst = vListeners.uget(i);
+                if ((!lst->bShared) || ((id >= 0) && (lst->nId != id)))
+                    continue;
+
+                const atom_t lid            = lst->nId;
+                IStyleListener *listener    = lst->pListener;
+                if ((!update_shared(lst, get_parent_property(lid))) && (!force))
+                    continue;
+
+                // In transaction, just set notification flag instead of issuing notification
+                if (vLocks.size() > 0)
+                {
+                    if ((vLocks.index_of(listener) < 0) && (!lst->bNotify) && (vPending.add(&lid)))
+                        lst->bNotify    = true;
+                }
+                else
+                    listener->notify(lid);
+            }
+        }
+
         status_t Style::sync_property(property_t *p)
         {
 //            lsp_trace("name = %s, flags=0x%x", atom_name(p->id), p->flags);
@@ -387,13 +507,10 @@ namespace lsp
                     break;
                 case PT_STRING:
                 {
-                    if (::strcmp(p->v.sValue, p->dv.sValue) == 0)
+                    if (p->v.sValue == p->dv.sValue)
                         return STATUS_OK;
-                    char *tmp = ::strdup(p->dv.sValue);
-                    if (tmp == NULL)
-                        return STATUS_NO_MEM;
-                    ::free(p->v.sValue);
-                    p->v.sValue = tmp;
+                    StringPool::release(p->v.sValue);
+                    p->v.sValue = StringPool::acquire(p->dv.sValue);
                     break;
                 }
                 default:
@@ -490,6 +607,13 @@ namespace lsp
                 }
             }
 
+            // Drop local copies which only mirror properties of parents
+            if (vLocks.is_empty())
+                share_properties();
+
+            // Deploy properties observed by shared listeners
+            notify_shared(-1, false);
+
             // Call all children for synchronize()
             for (size_t i=0, n=vChildren.size(); i<n; ++i)
             {
@@ -501,29 +625,53 @@ namespace lsp
 
         void Style::delayed_notify()
         {
-            size_t notified;
-
             if (nFlags & S_DELAYED)
                 return;
 
             nFlags |= S_DELAYED; // Disallow delayed notify because it is already active
             do
             {
-                notified = 0;
-                for (size_t i=0, n=vProperties.size(); i < n; ++i)
+                // Take the list of pending properties, notifications may add new items to it
+                vNotify.swap(&vPending);
+
+                for (size_t i=0, n=vNotify.size(); i < n; ++i)
                 {
-                    // Notify if notification is pending
-                    property_t *prop = vProperties.uget(i);
+                    // Property could be removed by previous notifications, look it up by identifier
+                    const atom_t id     = *vNotify.uget(i);
+                    property_t *prop    = get_property(id);
                     if (prop != NULL)
                     {
-                        notified       += notify_listeners_delayed(prop);
-                        notified       += notify_children_delayed(prop);
+                        // Notifications may change the property again, allow it to be queued
+                        prop->flags    &= ~F_QUEUED;
+                        notify_listeners_delayed(prop);
+                        notify_children_delayed(prop);
+                        continue;
+                    }
+
+                    // Shared listeners have no local property
+                    for (size_t j=0; j<vListeners.size(); ++j)
+                    {
+                        listener_t *lst = vListeners.uget(j);
+                        if ((lst->bShared) && (lst->bNotify) && (lst->nId == id))
+                        {
+                            lst->bNotify    = false;
+                            lst->pListener->notify(id);
+                        }
                     }
                 }
-            } while (notified > 0);
+                vNotify.clear();
+            } while (vPending.size() > 0);
             nFlags &= ~S_DELAYED;
         }
 
+        void Style::mark_pending(property_t *prop, size_t flags)
+        {
+            // Enqueue property only once until it is taken from the queue
+            if ((!(prop->flags & F_QUEUED)) && (vPending.add(&prop->id)))
+                prop->flags    |= F_QUEUED;
+            prop->flags    |= flags;
+        }
+
         void Style::notify_change(property_t *prop)
         {
             // Find the matching property (if present)
@@ -532,6 +680,7 @@ namespace lsp
             // Property not found?
             if ((p == NULL) || (p->refs <= 0))
             {
+                notify_shared(prop->id, false);
                 notify_children(prop); // Just bypass event to children
                 return;
             }
@@ -556,7 +705,7 @@ namespace lsp
             // In transaction, just set notification flag instead of issuing notification procedure
             if ((vLocks.size() > 0) && (prop->owner == this))
             {
-                prop->flags    |= F_NTF_CHILDREN;
+                mark_pending(prop, F_NTF_CHILDREN);
                 return;
             }
 
@@ -618,7 +767,7 @@ namespace lsp
 
                 // Are there any listeners pending?
                 if (count > 0)
-                    prop->flags    |= F_NTF_LISTENERS;
+                    mark_pending(prop, F_NTF_LISTENERS);
             }
             else
             {
@@ -796,6 +945,101 @@ namespace lsp
             return STATUS_OK;
         }
 
+        bool Style::has_parents(const lltl::parray<Style> *list) const
+        {
+            if (vParents.size() != list->size())
+                return false;
+
+            for (size_t i=0, n=vParents.size(); i<n; ++i)
+                if (vParents.uget(i) != list->uget(i))
+                    return false;
+
+            return true;
+        }
+
+        void Style::detach_parents()
+        {
+            // Remove self from parent lists without synchronization, the caller
+            // should attach new parents by calling attach_parents() after
+            for (size_t i=0, n=vParents.size(); i < n; ++i)
+            {
+                Style *parent = vParents.uget(i);
+                if (parent != NULL)
+                    parent->vChildren.premove(this);
+            }
+            vParents.clear();
+        }
+
+        status_t Style::attach_parents(const lltl::parray<Style> *list)
+        {
+            status_t res = STATUS_OK;
+
+            for (size_t i=0, n=list->size(); i<n; ++i)
+            {
+                Style *parent = list->uget(i);
+                if (parent == NULL)
+                    continue;
+
+                // Check
+                if (vParents.index_of(parent) >= 0)
+                {
+                    res     = STATUS_ALREADY_EXISTS;
+                    break;
+                }
+                if ((parent == this) || (this->has_child(parent, true)))
+                {
+                    res     = STATUS_BAD_HIERARCHY;
+                    break;
+                }
+
+                // Make bindings
+                if (!vParents.add(parent))
+                {
+                    res     = STATUS_NO_MEM;
+                    break;
+                }
+                if (!parent->vChildren.add(this))
+                {
+                    vParents.premove(parent);
+                    res     = STATUS_NO_MEM;
+                    break;
+                }
+            }
+
+            // Synchronize state once for all parents
+            synchronize();
+
+            return res;
+        }
+
+        void Style::refresh_property(atom_t id, lltl::phashset<Style> *visited)
+        {
+            // Style may be reached by several inheritance paths
+            if (visited->contains(this))
+                return;
+            if (!visited->put(this))
+                return;
+
+            // Notify listeners even if the value of property did not change
+            property_t *p = get_property(id);
+            if (p != NULL)
+                notify_listeners(p);
+            else
+                notify_shared(id, true);
+
+            // Pass the notification to children which inherit the property
+            for (size_t i=0, n=vChildren.size(); i<n; ++i)
+            {
+                Style *child = vChildren.uget(i);
+                if (child == NULL)
+                    continue;
+
+                const property_t *cp = child->get_property(id);
+                if ((cp == NULL) || (!(cp->flags & F_OVERRIDDEN)))
+                    child->refresh_property(id, visited);
+            }
+        }
+
         bool Style::has_child(Style *child, bool recursive)
         {
             if ((child == NULL) || (child == this))
@@ -876,11 +1120,38 @@ namespace lsp
             // Property has been found?
             if (p == NULL)
             {
-                // Lookup parent property
+                // Check that not already bound
+                if (is_bound(id, listener))
+                    return STATUS_ALREADY_BOUND;
+
+                // Observe the property of parent style until the property gets set locally
                 property_t *parent = get_parent_property(id);
+                if (parent != NULL)
+                {
+                    lst = vListeners.add();
+                    if (lst == NULL)
+                        return STATUS_NO_MEM;
+
+                    lst->nId        = id;
+                    lst->bNotify    = false;
+                    lst->bShared    = true;
+                    lst->nType      = PT_UNKNOWN;
+                    lst->sValue.iValue  = 0;
+                    lst->pListener  = listener;
+                    update_shared(lst, parent);
+
+                    if (vLocks.index_of(listener) >= 0)
+                        return STATUS_OK;
+                    if (vLocks.is_empty())
+                        listener->notify(id);
+                    else if (vPending.add(&id))
+                        lst->bNotify    = true;
+
+                    return STATUS_OK;
+                }
 
                 // Create property
-                p = (parent != NULL) ? create_property(id, parent, 0) : create_property(id, type, 0);
+                p = create_property(id, type, 0);
                 if (p == NULL)
                     return STATUS_NO_MEM;
 
@@ -908,14 +1179,21 @@ namespace lsp
             // Save listener to allocated binding
             lst->nId        = p->id;
             lst->bNotify    = vLocks.index_of(listener) < 0;
+            lst->bShared    = false;
+            lst->nType      = PT_UNKNOWN;
+            lst->sValue.iValue  = 0;
             lst->pListener  = listener;
             ++p->refs;
 
             if (lst->bNotify)
             {
-                p->flags       |= F_NTF_LISTENERS;
                 if ((vLocks.is_empty()) || (p->owner != this))
+                {
+                    p->flags       |= F_NTF_LISTENERS;
                     notify_listeners_delayed(p);
+                }
+                else
+                    mark_pending(p, F_NTF_LISTENERS);
             }
             notify_children(p);
 
@@ -952,6 +1230,14 @@ namespace lsp
             if (lst == NULL)
                 return STATUS_NOT_BOUND;
 
+            // Shared listener has no local property
+            if (lst->bShared)
+            {
+                release_shared(lst);
+                vListeners.premove(lst);
+                return STATUS_OK;
+            }
+
             // Get property
             property_t *p = get_property(id);
             if (p == NULL)
@@ -991,6 +1277,47 @@ namespace lsp
             vProperties.premove(p);
         }
 
+        size_t Style::memory_usage() const
+        {
+            size_t res      = sizeof(Style);
+            res            += vParents.capacity() * sizeof(Style *);
+            res            += vChildren.capacity() * sizeof(Style *);
+            res            += vListeners.capacity() * sizeof(listener_t);
+            res            += vLocks.capacity() * sizeof(IStyleListener *);
+            res            += (vPending.capacity() + vNotify.capacity()) * sizeof(atom_t);
+            if (sName != NULL)
+                res            += ::strlen(sName) + 1;
+            if (sDflParents != NULL)
+                res            += ::strlen(sDflParents) + 1;
+
+            return res + properties_memory_usage();
+        }
+
+        size_t Style::properties_memory_usage() const
+        {
+            size_t res      = vProperties.capacity() * sizeof(property_t);
+
+            for (size_t i=0, n=vProperties.size(); i<n; ++i)
+            {
+                const property_t *p = vProperties.uget(i);
+                if ((p == NULL) || (p->type != PT_STRING))
+                    continue;
+
+                res            += StringPool::memory(p->v.sValue);
+                res            += StringPool::memory(p->dv.sValue);
+            }
+
+            // Values observed by shared listeners
+            for (size_t i=0, n=vListeners.size(); i<n; ++i)
+            {
+                const listener_t *lst = vListeners.uget(i);
+                if ((lst->bShared) && (lst->nType == PT_STRING))
+                    res            += StringPool::memory(lst->sValue.sValue);
+            }
+
+            return res;
+        }
+
         Style::property_t *Style::get_property(atom_t id)
         {
             for (size_t i=0, n=vProperties.size(); i<n; ++i)
@@ -1148,7 +1475,7 @@ namespace lsp
 
             if (dst == NULL)
                 return STATUS_OK;
-            return (dst->set_utf8(prop->v.sValue)) ? STATUS_OK : STATUS_NO_MEM;
+            return (dst->set_utf8(StringPool::c_str(prop->v.sValue))) ? STATUS_OK : STATUS_NO_MEM;
         }
 
         status_t Style::get_string(const char *id, LSPString *dst) const
@@ -1176,7 +1503,7 @@ namespace lsp
                 return STATUS_BAD_TYPE;
 
             if (dst != NULL)
-                *dst = prop->v.sValue;
+                *dst = StringPool::c_str(prop->v.sValue);
             return STATUS_OK;
         }
 
@@ -1354,11 +1681,7 @@ namespace lsp
             if (value == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
-            property_t tmp;
-            tmp.type        = PT_STRING;
-            tmp.v.sValue    = const_cast<char *>(value->get_utf8());
-            tmp.dv.sValue   = tmp.v.sValue;
-            return set_property(id, &tmp);
+            return set_string(id, value->get_utf8());
         }
 
         status_t Style::set_string(const char *id, const LSPString *value)
@@ -1378,10 +1701,19 @@ namespace lsp
             if (value == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
+            // Intern the string, properties will reference it instead of making copies.
+            // Style without schema has no pool, the string is not shared then
+            StringPool::string_t *str = (pSchema != NULL) ?
+                pSchema->strings()->intern(value) :
+                StringPool::copy(value);
+            if (str == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally { StringPool::release(str); };
+
             property_t tmp;
             tmp.type        = PT_STRING;
-            tmp.v.sValue    = const_cast<char *>(value);
-            tmp.dv.sValue   = tmp.v.sValue;
+            tmp.v.sValue    = str;
+            tmp.dv.sValue   = str;
             return set_property(id, &tmp);
         }
 
@@ -1401,7 +1733,16 @@ namespace lsp
         {
             property_t *p = get_property(id);
             if (p == NULL)
+            {
+                // Property observed by shared listeners is not overridden
+                for (size_t i=0, n=vListeners.size(); i<n; ++i)
+                {
+                    const listener_t *lst = vListeners.uget(i);
+                    if ((lst->bShared) && (lst->nId == id))
+                        return STATUS_OK;
+                }
                 return STATUS_NOT_FOUND;
+            }
             else if (!(p->flags & F_OVERRIDDEN))
                 return STATUS_OK;
 
@@ -1458,28 +1799,17 @@ namespace lsp
                     break;
                 case PT_STRING:
                 {
-                    // Allocate strings
-                    char *ds = ::strdup(src->dv.sValue);
-                    if (ds == NULL)
-                        return STATUS_NO_MEM;
-
                     // Need to override values?
                     if ((!(p->flags & F_OVERRIDDEN)) &&
-                        (::strcmp(p->v.sValue, src->v.sValue) != 0))
+                        (p->v.sValue != src->v.sValue))
                     {
-                        char *s         = ::strdup(src->v.sValue);
-                        if (s == NULL)
-                        {
-                            ::free(ds);
-                            return STATUS_NO_MEM;
-                        }
-
-                        ::free(p->v.sValue);
-                        p->v.sValue     = s;
+                        StringPool::release(p->v.sValue);
+                        p->v.sValue     = StringPool::acquire(src->v.sValue);
                         ++p->changes;
                     }
 
-                    ::free(p->dv.sValue);
+                    StringPool::string_t *ds = StringPool::acquire(src->dv.sValue);
+                    StringPool::release(p->dv.sValue);
                     p->dv.sValue    = ds;
                     break;
                 }
@@ -1534,6 +1864,16 @@ namespace lsp
             return pSchema->atom_name(id);
         }
 
+        const atom_t *Style::composite_atoms(atom_t base, const prop::desc_t *desc) const
+        {
+            return pSchema->composite_atoms(base, desc);
+        }
+
+        const atom_t *Style::composite_atoms(atom_t base, const char * const *postfix) const
+        {
+            return pSchema->composite_atoms(base, postfix);
+        }
+
         status_t Style::set_default_parents(const char *parents)
         {
             char *copy = (parents != NULL) ? strdup(parents) : NULL;
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        StylePool::StylePool()
+        {
+            nThreads    = 0;
+            nResolved   = 0;
+            bShutdown   = false;
+        }
+
+        StylePool::~StylePool()
+        {
+            destroy();
+        }
+
+        void StylePool::destroy()
+        {
+            stop_workers();
+        }
+
+        void StylePool::set_threads(size_t threads)
+        {
+            if (nThreads == threads)
+                return;
+
+            // Workers are started again on demand by the next batch
+            stop_workers();
+            nThreads    = threads;
+        }
+
+        StylePool::batch_t *StylePool::next_batch(StyleSheet *sheet)
+        {
+            for (size_t i=0, n=vQueue.size(); i<n; ++i)
+            {
+                batch_t *b = vQueue.uget(i);
+                if ((sheet == NULL) || (b->sheet == sheet))
+                {
+                    vQueue.remove(i);
+                    return b;
+                }
+            }
+            return NULL;
+        }
+
+        void StylePool::resolve(batch_t *batch)
+        {
+            for (size_t i=0, n=batch->props.size(); i<n; ++i)
+                StyleSheet::resolve_value(batch->props.uget(i));
+        }
+
+        void StylePool::start_workers()
+        {
+            while (vWorkers.size() < nThreads)
+            {
+                ipc::Thread *t = new ipc::Thread(worker_proc, this);
+                if (t == NULL)
+                    return;
+                if ((!vWorkers.add(t)) || (t->start() != STATUS_OK))
+                {
+                    vWorkers.premove(t);
+                    delete t;
+                    return;
+                }
+            }
+        }
+
+        void StylePool::stop_workers()
+        {
+            if (vWorkers.size() <= 0)
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock(sLock);
+                bShutdown   = true;
+            }
+            sWork.notify_all();
+
+            for (size_t i=0, n=vWorkers.size(); i<n; ++i)
+            {
+                ipc::Thread *t = vWorkers.uget(i);
+                t->join();
+                delete t;
+            }
+            vWorkers.flush();
+
+            bShutdown   = false;
+        }
+
+        void StylePool::run_worker()
+        {
+            std::unique_lock<std::mutex> lock(sLock);
+
+            while (true)
+            {
+                // Wait for the next batch, pending batches are resolved before shutdown
+                sWork.wait(lock, [this] { return (bShutdown) || (vQueue.size() > 0); });
+                batch_t *b  = next_batch(NULL);
+                if (b == NULL)
+                    return;
+
+                lock.unlock();
+                resolve(b);
+                lock.lock();
+
+                nResolved  += b->props.size();
+                if ((--b->sheet->nBatches) == 0)
+                    sDone.notify_all();
+                delete b;
+            }
+        }
+
+        status_t StylePool::worker_proc(void *arg)
+        {
+            StylePool *self     = static_cast<StylePool *>(arg);
+            self->run_worker();
+            return STATUS_OK;
+        }
+
+        status_t StylePool::submit(StyleSheet *sheet, lltl::parray<StyleSheet::property_t> *props)
+        {
+            if (props->size() <= 0)
+                return STATUS_OK;
+
+            // Resolve values by the calling thread if there are no workers
+            if (nThreads > 0)
+                start_workers();
+            if (vWorkers.size() <= 0)
+            {
+                for (size_t i=0, n=props->size(); i<n; ++i)
+                    StyleSheet::resolve_value(props->uget(i));
+                nResolved  += props->size();
+                props->clear();
+                return STATUS_OK;
+            }
+
+            // Enqueue the batch
+            batch_t *b  = new batch_t;
+            if (b == NULL)
+                return STATUS_NO_MEM;
+            b->sheet    = sheet;
+            b->props.swap(props);
+
+            {
+                std::lock_guard<std::mutex> lock(sLock);
+                if (!vQueue.add(b))
+                {
+                    props->swap(&b->props);
+                    delete b;
+                    return STATUS_NO_MEM;
+                }
+                ++sheet->nBatches;
+            }
+            sWork.notify_one();
+
+            return STATUS_OK;
+        }
+
+        void StylePool::wait(StyleSheet *sheet)
+        {
+            std::unique_lock<std::mutex> lock(sLock);
+
+            // Resolve batches of the style sheet not taken by workers yet
+            for (batch_t *b = next_batch(sheet); b != NULL; b = next_batch(sheet))
+            {
+                lock.unlock();
+                resolve(b);
+                lock.lock();
+
+                nResolved  += b->props.size();
+                --sheet->nBatches;
+                delete b;
+            }
+
+            // Wait for batches being resolved by workers
+            sDone.wait(lock, [sheet] { return sheet->nBatches == 0; });
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
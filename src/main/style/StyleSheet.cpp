@@ -22,12 +22,75 @@
 #include <lsp-plug.in/tk/tk.h>
 #include <lsp-plug.in/io/InStringSequence.h>
 #include <lsp-plug.in/expr/Tokenizer.h>
+#include <lsp-plug.in/io/InFileStream.h>
+#include <lsp-plug.in/io/OutFileStream.h>
+#include <lsp-plug.in/io/OutMemoryStream.h>
 #include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/runtime/system.h>
 
 namespace lsp
 {
     namespace tk
     {
+        //---------------------------------------------------------------------
+        // Binary format primitives, all values are stored in native byte order,
+        // the magic number allows to detect the byte order mismatch
+        static const uint32_t BINARY_MAGIC  = 0x534b544c; // 'LTKS'
+
+        static status_t write_data(io::IOutStream *os, const void *data, size_t size)
+        {
+            ssize_t res = os->write(data, size);
+            if (res < 0)
+                return status_t(-res);
+            return (size_t(res) == size) ? STATUS_OK : STATUS_IO_ERROR;
+        }
+
+        template <class T>
+            static inline status_t write_value(io::IOutStream *os, T value)
+            {
+                return write_data(os, &value, sizeof(value));
+            }
+
+        static status_t write_string(io::IOutStream *os, const LSPString *s)
+        {
+            const char *utf8    = s->get_utf8();
+            if (utf8 == NULL)
+                return STATUS_NO_MEM;
+
+            const uint32_t len  = ::strlen(utf8);
+            LSP_STATUS_ASSERT(write_value(os, len));
+            return write_data(os, utf8, len);
+        }
+
+        static bool read_data(void *dst, size_t size, const uint8_t **head, const uint8_t *tail)
+        {
+            if (size_t(tail - *head) < size)
+                return false;
+            ::memcpy(dst, *head, size);
+            *head      += size;
+            return true;
+        }
+
+        template <class T>
+            static inline bool read_value(T *value, const uint8_t **head, const uint8_t *tail)
+            {
+                return read_data(value, sizeof(T), head, tail);
+            }
+
+        static status_t read_string(LSPString *s, const uint8_t **head, const uint8_t *tail)
+        {
+            uint32_t len;
+            if (!read_value(&len, head, tail))
+                return STATUS_CORRUPTED;
+            if (size_t(tail - *head) < len)
+                return STATUS_CORRUPTED;
+            if (!s->set_utf8(reinterpret_cast<const char *>(*head), len))
+                return STATUS_NO_MEM;
+            *head      += len;
+            return STATUS_OK;
+        }
+
+        //---------------------------------------------------------------------
         StyleSheet::style_t::style_t()
         {
             order_gen       = 0;
@@ -61,9 +124,16 @@ namespace lsp
         StyleSheet::StyleSheet()
         {
             pRoot       = NULL;
+            pPool       = NULL;
+            nBatches    = 0;
         }
 
         StyleSheet::~StyleSheet()
+        {
+            do_destroy();
+        }
+
+        void StyleSheet::do_destroy()
         {
             // Delete root style
             if (pRoot != NULL)
@@ -126,6 +196,10 @@ namespace lsp
             status_t item, res = STATUS_OK;
             bool read = false;
 
+            // Property values may be resolved by the pool while the document is being
+            // parsed, all of them should be resolved before return
+            lsp_finally { complete_resolve(); };
+
             while (true)
             {
                 if ((item = p->read_next()) < 0)
@@ -163,6 +237,7 @@ namespace lsp
                 }
             }
 
+            complete_resolve();
             if ((read) && (res == STATUS_OK))
                 res = validate();
 
@@ -938,7 +1013,10 @@ namespace lsp
                             sError.fmt_utf8("Could not copy value of property '%s' for style '%s'", name->get_utf8(), style->name.get_utf8());
                             return STATUS_NO_MEM;
                         }
-                        *dst            = release_ptr(prop);
+                        property_t *xprop   = release_ptr(prop);
+                        *dst                = xprop;
+                        if ((res = queue_resolve(xprop)) != STATUS_OK)
+                            sError.fmt_utf8("Could not resolve value of property '%s' for style '%s'", name->get_utf8(), style->name.get_utf8());
 
                         return res;
                     }
@@ -953,6 +1031,70 @@ namespace lsp
             }
         }
 
+        status_t StyleSheet::resolve_value(property_t *prop)
+        {
+            io::InStringSequence is(&prop->value);
+            expr::Tokenizer tok(&is);
+
+            // Resolve the value in the same way as it is done for untyped properties
+            expr::token_t t     = tok.get_token(expr::TF_GET);
+            if ((t == expr::TT_TRUE) || (t == expr::TT_FALSE))
+            {
+                prop->bvalue        = (t == expr::TT_TRUE);
+                prop->type          = PT_BOOL;
+            }
+            else if (t == expr::TT_IVALUE)
+            {
+                prop->ivalue        = tok.int_value();
+                prop->type          = PT_INT;
+            }
+            else if (t == expr::TT_FVALUE)
+            {
+                prop->fvalue        = tok.float_value();
+                prop->type          = PT_FLOAT;
+            }
+            else
+            {
+                prop->type          = PT_STRING;
+                return STATUS_OK;
+            }
+
+            // Value should not contain extra tokens
+            if (tok.get_token(expr::TF_GET) != expr::TT_EOF)
+            {
+                prop->type          = PT_UNKNOWN;
+                return STATUS_BAD_FORMAT;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t StyleSheet::queue_resolve(property_t *prop)
+        {
+            if ((pPool == NULL) || (pPool->threads() <= 0))
+            {
+                resolve_value(prop);
+                return STATUS_OK;
+            }
+
+            if (!vPending.add(prop))
+                return STATUS_NO_MEM;
+
+            return (vPending.size() >= RESOLVE_BATCH) ? pPool->submit(this, &vPending) : STATUS_OK;
+        }
+
+        void StyleSheet::complete_resolve()
+        {
+            // Resolve the rest of properties by the current thread
+            for (size_t i=0, n=vPending.size(); i<n; ++i)
+                resolve_value(vPending.uget(i));
+            vPending.flush();
+
+            // Wait for batches passed to the pool
+            if (pPool != NULL)
+                pPool->wait(this);
+        }
+
         status_t StyleSheet::parse_style_class(LSPString *cname, const LSPString *text)
         {
             if (!cname->set(text))
@@ -1457,8 +1599,460 @@ namespace lsp
             return STATUS_OK;
         }
 
-    } /* namespace tk */
-} /* namespace lsp */
 
+        status_t StyleSheet::write_style(io::IOutStream *os, const style_t *s)
+        {
+            // Write header
+            LSP_STATUS_ASSERT(write_string(os, &s->name));
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(s->order_gen)));
+
+            // Write parents
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(s->parents.size())));
+            for (size_t i=0, n=s->parents.size(); i<n; ++i)
+            {
+                LSP_STATUS_ASSERT(write_string(os, s->parents.uget(i)));
+            }
+
+            // Write properties
+            lltl::parray<LSPString> keys;
+            if (!s->properties.keys(&keys))
+                return STATUS_NO_MEM;
+
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(keys.size())));
+            for (size_t i=0, n=keys.size(); i<n; ++i)
+            {
+                const LSPString *key    = keys.uget(i);
+                const property_t *p     = s->properties.get(key);
+                if (p == NULL)
+                    return STATUS_BAD_STATE;
+
+                LSP_STATUS_ASSERT(write_string(os, key));
+                LSP_STATUS_ASSERT(write_value(os, uint32_t(p->order)));
+                LSP_STATUS_ASSERT(write_string(os, &p->value));
+                LSP_STATUS_ASSERT(write_value(os, uint8_t(p->type)));
+                switch (p->type)
+                {
+                    case PT_BOOL:   LSP_STATUS_ASSERT(write_value(os, uint8_t(p->bvalue)));    break;
+                    case PT_INT:    LSP_STATUS_ASSERT(write_value(os, int64_t(p->ivalue)));    break;
+                    case PT_FLOAT:  LSP_STATUS_ASSERT(write_value(os, p->fvalue));             break;
+                    default: break;
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t StyleSheet::read_style(style_t *s, const uint8_t **head, const uint8_t *tail)
+        {
+            uint32_t count, order;
+            status_t res;
+
+            // Read header
+            LSP_STATUS_ASSERT(read_string(&s->name, head, tail));
+            if (!read_value(&order, head, tail))
+                return STATUS_CORRUPTED;
+            s->order_gen    = order;
+
+            // Read parents
+            if (!read_value(&count, head, tail))
+                return STATUS_CORRUPTED;
+            for (size_t i=0; i<count; ++i)
+            {
+                LSPString *parent   = new LSPString();
+                if (parent == NULL)
+                    return STATUS_NO_MEM;
+                if (!s->parents.add(parent))
+                {
+                    delete parent;
+                    return STATUS_NO_MEM;
+                }
+                LSP_STATUS_ASSERT(read_string(parent, head, tail));
+            }
+
+            // Read properties
+            if (!read_value(&count, head, tail))
+                return STATUS_CORRUPTED;
+
+            LSPString key;
+            for (size_t i=0; i<count; ++i)
+            {
+                uint8_t type;
+                LSP_STATUS_ASSERT(read_string(&key, head, tail));
+                if (s->properties.contains(&key))
+                    return STATUS_CORRUPTED;
+
+                property_t *p       = new property_t;
+                if (p == NULL)
+                    return STATUS_NO_MEM;
+                if (!s->properties.create(&key, p))
+                {
+                    delete p;
+                    return STATUS_NO_MEM;
+                }
+
+                if (!read_value(&order, head, tail))
+                    return STATUS_CORRUPTED;
+                p->order            = order;
+                if ((res = read_string(&p->value, head, tail)) != STATUS_OK)
+                    return res;
+                if (!read_value(&type, head, tail))
+                    return STATUS_CORRUPTED;
+
+                p->type             = property_type_t(type);
+                switch (p->type)
+                {
+                    case PT_BOOL:
+                    {
+                        uint8_t v;
+                        if (!read_value(&v, head, tail))
+                            return STATUS_CORRUPTED;
+                        p->bvalue           = v != 0;
+                        break;
+                    }
+                    case PT_INT:
+                    {
+                        int64_t v;
+                        if (!read_value(&v, head, tail))
+                            return STATUS_CORRUPTED;
+                        p->ivalue           = v;
+                        break;
+                    }
+                    case PT_FLOAT:
+                        if (!read_value(&p->fvalue, head, tail))
+                            return STATUS_CORRUPTED;
+                        break;
+                    case PT_STRING:
+                    case PT_UNKNOWN:
+                        break;
+                    default:
+                        return STATUS_CORRUPTED;
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t StyleSheet::save_binary(io::IOutStream *os, const digest_t *stamp) const
+        {
+            if (os == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            digest_t xstamp;
+            if (stamp != NULL)
+                xstamp      = *stamp;
+            else
+                clear_digest(&xstamp);
+
+            // Write header
+            LSP_STATUS_ASSERT(write_value(os, BINARY_MAGIC));
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(BINARY_VERSION)));
+            LSP_STATUS_ASSERT(write_value(os, xstamp));
+            LSP_STATUS_ASSERT(write_string(os, &sTitle));
+
+            lltl::parray<LSPString> keys;
+
+            // Write colors
+            if (!vColors.keys(&keys))
+                return STATUS_NO_MEM;
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(keys.size())));
+            for (size_t i=0, n=keys.size(); i<n; ++i)
+            {
+                const LSPString *key    = keys.uget(i);
+                const lsp::Color *c     = vColors.get(key);
+                if (c == NULL)
+                    return STATUS_BAD_STATE;
+
+                LSP_STATUS_ASSERT(write_string(os, key));
+                LSP_STATUS_ASSERT(write_value(os, c->red()));
+                LSP_STATUS_ASSERT(write_value(os, c->green()));
+                LSP_STATUS_ASSERT(write_value(os, c->blue()));
+                LSP_STATUS_ASSERT(write_value(os, c->alpha()));
+            }
+
+            // Write constants
+            keys.clear();
+            if (!vConstants.keys(&keys))
+                return STATUS_NO_MEM;
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(keys.size())));
+            for (size_t i=0, n=keys.size(); i<n; ++i)
+            {
+                const LSPString *key    = keys.uget(i);
+                const LSPString *value  = vConstants.get(key);
+                if (value == NULL)
+                    return STATUS_BAD_STATE;
+
+                LSP_STATUS_ASSERT(write_string(os, key));
+                LSP_STATUS_ASSERT(write_string(os, value));
+            }
+
+            // Write fonts
+            keys.clear();
+            if (!vFonts.keys(&keys))
+                return STATUS_NO_MEM;
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(keys.size())));
+            for (size_t i=0, n=keys.size(); i<n; ++i)
+            {
+                const LSPString *key    = keys.uget(i);
+                const font_t *f         = vFonts.get(key);
+                if (f == NULL)
+                    return STATUS_BAD_STATE;
+
+                LSP_STATUS_ASSERT(write_string(os, key));
+                LSP_STATUS_ASSERT(write_string(os, &f->name));
+                LSP_STATUS_ASSERT(write_string(os, &f->path));
+                LSP_STATUS_ASSERT(write_value(os, uint8_t(f->alias)));
+            }
+
+            // Write root style
+            LSP_STATUS_ASSERT(write_value(os, uint8_t(pRoot != NULL)));
+            if (pRoot != NULL)
+            {
+                LSP_STATUS_ASSERT(write_style(os, pRoot));
+            }
+
+            // Write styles
+            keys.clear();
+            if (!vStyles.keys(&keys))
+                return STATUS_NO_MEM;
+            LSP_STATUS_ASSERT(write_value(os, uint32_t(keys.size())));
+            for (size_t i=0, n=keys.size(); i<n; ++i)
+            {
+                const style_t *s        = vStyles.get(keys.uget(i));
+                if (s == NULL)
+                    return STATUS_BAD_STATE;
+                LSP_STATUS_ASSERT(write_style(os, s));
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t StyleSheet::save_binary(const io::Path *path, const digest_t *stamp) const
+        {
+            if (path == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            // Serialize data to memory first to write the file at once
+            io::OutMemoryStream data;
+            lsp_finally { data.drop(); };
+            status_t res = save_binary(&data, stamp);
+            if (res != STATUS_OK)
+                return res;
+
+            // Write the temporary file with the unique name next to the target file
+            system::time_t ts;
+            system::get_time(&ts);
+            LSPString name;
+            io::Path tmp;
+            if (!name.fmt_utf8("%s.%llx-%llx.tmp", path->as_utf8(),
+                (unsigned long long)(ts.seconds), (unsigned long long)(ts.nanos)))
+                return STATUS_NO_MEM;
+            if ((res = tmp.set(&name)) != STATUS_OK)
+                return res;
+
+            io::OutFileStream os;
+            if ((res = os.open(&tmp, io::File::FM_WRITE_NEW)) != STATUS_OK)
+                return res;
+            res = write_data(&os, data.data(), data.size());
+            status_t res2 = os.close();
+            if (res == STATUS_OK)
+                res     = res2;
+
+            // Replace the target file
+            if (res == STATUS_OK)
+                res     = io::File::rename(&tmp, path);
+            if (res != STATUS_OK)
+                io::File::remove(&tmp);
+
+            return res;
+        }
+
+        status_t StyleSheet::save_binary(const char *path, const digest_t *stamp) const
+        {
+            if (path == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? save_binary(&tmp, stamp) : res;
+        }
+
+        status_t StyleSheet::load_binary(const void *data, size_t size, const digest_t *stamp)
+        {
+            if (data == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if ((pRoot != NULL) || (!vStyles.is_empty()) || (!vColors.is_empty()) ||
+                (!vFonts.is_empty()) || (!vConstants.is_empty()))
+                return STATUS_BAD_STATE;
+
+            // Do not leave partially loaded data on error
+            status_t res = read_binary(data, size, stamp);
+            if (res != STATUS_OK)
+            {
+                do_destroy();
+                sTitle.truncate();
+            }
+
+            return res;
+        }
+
+        status_t StyleSheet::read_binary(const void *data, size_t size, const digest_t *stamp)
+        {
+            const uint8_t *head = static_cast<const uint8_t *>(data);
+            const uint8_t *tail = &head[size];
+            uint32_t magic, version, count;
+            digest_t xstamp, dstamp;
+            uint8_t flag;
+            status_t res;
+
+            if (stamp == NULL)
+            {
+                clear_digest(&dstamp);
+                stamp       = &dstamp;
+            }
+
+            // Read and check header
+            if ((!read_value(&magic, &head, tail)) ||
+                (!read_value(&version, &head, tail)))
+                return STATUS_CORRUPTED;
+            if ((magic != BINARY_MAGIC) || (version != BINARY_VERSION))
+                return STATUS_UNSUPPORTED_FORMAT;
+            if (!read_value(&xstamp, &head, tail))
+                return STATUS_CORRUPTED;
+            if (!digest_equals(&xstamp, stamp))
+                return STATUS_UNSUPPORTED_FORMAT;
+            LSP_STATUS_ASSERT(read_string(&sTitle, &head, tail));
+
+            LSPString key;
+
+            // Read colors
+            if (!read_value(&count, &head, tail))
+                return STATUS_CORRUPTED;
+            for (size_t i=0; i<count; ++i)
+            {
+                float rgba[4];
+                LSP_STATUS_ASSERT(read_string(&key, &head, tail));
+                if (!read_data(rgba, sizeof(rgba), &head, tail))
+                    return STATUS_CORRUPTED;
+
+                lsp::Color *c   = new lsp::Color();
+                if (c == NULL)
+                    return STATUS_NO_MEM;
+                c->set_rgba(rgba[0], rgba[1], rgba[2], rgba[3]);
+                if (!vColors.create(&key, c))
+                {
+                    delete c;
+                    return STATUS_CORRUPTED;
+                }
+            }
+
+            // Read constants
+            if (!read_value(&count, &head, tail))
+                return STATUS_CORRUPTED;
+            for (size_t i=0; i<count; ++i)
+            {
+                LSP_STATUS_ASSERT(read_string(&key, &head, tail));
+                LSPString *value    = new LSPString();
+                if (value == NULL)
+                    return STATUS_NO_MEM;
+                if (!vConstants.create(&key, value))
+                {
+                    delete value;
+                    return STATUS_CORRUPTED;
+                }
+                LSP_STATUS_ASSERT(read_string(value, &head, tail));
+            }
+
+            // Read fonts
+            if (!read_value(&count, &head, tail))
+                return STATUS_CORRUPTED;
+            for (size_t i=0; i<count; ++i)
+            {
+                LSP_STATUS_ASSERT(read_string(&key, &head, tail));
+                font_t *f           = new font_t;
+                if (f == NULL)
+                    return STATUS_NO_MEM;
+                if (!vFonts.create(&key, f))
+                {
+                    delete f;
+                    return STATUS_CORRUPTED;
+                }
+
+                LSP_STATUS_ASSERT(read_string(&f->name, &head, tail));
+                LSP_STATUS_ASSERT(read_string(&f->path, &head, tail));
+                if (!read_value(&flag, &head, tail))
+                    return STATUS_CORRUPTED;
+                f->alias            = flag != 0;
+            }
+
+            // Read root style
+            if (!read_value(&flag, &head, tail))
+                return STATUS_CORRUPTED;
+            if (flag)
+            {
+                if ((pRoot = new style_t()) == NULL)
+                    return STATUS_NO_MEM;
+                LSP_STATUS_ASSERT(read_style(pRoot, &head, tail));
+            }
+
+            // Read styles
+            if (!read_value(&count, &head, tail))
+                return STATUS_CORRUPTED;
+            for (size_t i=0; i<count; ++i)
+            {
+                style_t *s          = new style_t();
+                if (s == NULL)
+                    return STATUS_NO_MEM;
+                if ((res = read_style(s, &head, tail)) != STATUS_OK)
+                {
+                    delete s;
+                    return res;
+                }
+                if (!vStyles.create(&s->name, s))
+                {
+                    delete s;
+                    return STATUS_CORRUPTED;
+                }
+            }
+
+            // All data should be consumed
+            if (head != tail)
+                return STATUS_CORRUPTED;
+
+            return validate();
+        }
 
+        status_t StyleSheet::load_binary(const io::Path *path, const digest_t *stamp)
+        {
+            if (path == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            // Read the whole file into memory
+            io::InFileStream is;
+            status_t res = is.open(path);
+            if (res != STATUS_OK)
+                return res;
 
+            io::OutMemoryStream data;
+            lsp_finally { data.drop(); };
+            wssize_t count = is.sink(&data);
+            res = is.close();
+            if (count < 0)
+                return status_t(-count);
+            if (res != STATUS_OK)
+                return res;
+
+            return load_binary(data.data(), data.size(), stamp);
+        }
+
+        status_t StyleSheet::load_binary(const char *path, const digest_t *stamp)
+        {
+            if (path == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? load_binary(&tmp, stamp) : res;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -27,10 +27,29 @@ namespace lsp
     {
         Atoms::Atoms()
         {
+            vComposite      = NULL;
+            nCompositeBins  = 0;
+            nComposite      = 0;
         }
         
         Atoms::~Atoms()
         {
+            // Destroy composite atoms
+            if (vComposite != NULL)
+            {
+                for (size_t i=0; i<nCompositeBins; ++i)
+                {
+                    for (composite_t *c = vComposite[i]; c != NULL; )
+                    {
+                        composite_t *next = c->pNext;
+                        ::free(c);
+                        c = next;
+                    }
+                }
+                ::free(vComposite);
+                vComposite      = NULL;
+            }
+
             // Destroy atoms
             for (size_t i=0, n=vAtomList.size(); i<n; ++i)
             {
@@ -129,6 +148,136 @@ namespace lsp
 
             return atom->id;
         }
-    
+
+        inline size_t Atoms::composite_hash(atom_t base, const void *key)
+        {
+            return size_t(base) * 0x9e3779b1U + (uintptr_t(key) >> 3);
+        }
+
+        Atoms::composite_t *Atoms::find_composite(atom_t base, const void *key)
+        {
+            if (vComposite == NULL)
+                return NULL;
+
+            const size_t h = composite_hash(base, key);
+            for (composite_t *c = vComposite[h & (nCompositeBins - 1)]; c != NULL; c = c->pNext)
+            {
+                if ((c->nBase == base) && (c->pKey == key))
+                    return c;
+            }
+
+            return NULL;
+        }
+
+        bool Atoms::grow_composite()
+        {
+            const size_t bins   = (nCompositeBins > 0) ? nCompositeBins << 1 : COMPOSITE_INITIAL_BINS;
+            composite_t **vb    = static_cast<composite_t **>(::calloc(bins, sizeof(composite_t *)));
+            if (vb == NULL)
+                return false;
+
+            for (size_t i=0; i<nCompositeBins; ++i)
+            {
+                for (composite_t *c = vComposite[i]; c != NULL; )
+                {
+                    composite_t *next   = c->pNext;
+                    composite_t **bin   = &vb[composite_hash(c->nBase, c->pKey) & (bins - 1)];
+                    c->pNext            = *bin;
+                    *bin                = c;
+                    c                   = next;
+                }
+            }
+
+            if (vComposite != NULL)
+                ::free(vComposite);
+            vComposite          = vb;
+            nCompositeBins      = bins;
+
+            return true;
+        }
+
+        Atoms::composite_t *Atoms::make_composite(atom_t base, const void *key, const char * const *postfix, size_t count)
+        {
+            const char *prefix  = atom_name(base);
+            if (prefix == NULL)
+                return NULL;
+
+            if ((nComposite >= nCompositeBins) && (!grow_composite()))
+                return NULL;
+
+            composite_t *c      = static_cast<composite_t *>(::malloc(sizeof(composite_t) + count * sizeof(atom_t)));
+            if (c == NULL)
+                return NULL;
+
+            // Resolve atoms
+            LSPString name;
+            if (!name.set_utf8(prefix))
+            {
+                ::free(c);
+                return NULL;
+            }
+            const size_t len    = name.length();
+
+            for (size_t i=0; i<count; ++i)
+            {
+                name.set_length(len);
+                atom_t atom         = (name.append_ascii(postfix[i])) ? atom_id(name.get_utf8()) : -STATUS_NO_MEM;
+                if (atom < 0)
+                {
+                    ::free(c);
+                    return NULL;
+                }
+                c->vAtoms[i]        = atom;
+            }
+
+            // Register list
+            composite_t **bin   = &vComposite[composite_hash(base, key) & (nCompositeBins - 1)];
+            c->pNext            = *bin;
+            c->pKey             = key;
+            c->nBase            = base;
+            *bin                = c;
+            ++nComposite;
+
+            return c;
+        }
+
+        const atom_t *Atoms::composite_atoms(atom_t base, const prop::desc_t *desc)
+        {
+            if ((base < 0) || (desc == NULL))
+                return NULL;
+
+            composite_t *c  = find_composite(base, desc);
+            if (c != NULL)
+                return c->vAtoms;
+
+            // Form the list of postfixes
+            lltl::parray<const char> postfix;
+            for (const prop::desc_t *d = desc; d->postfix != NULL; ++d)
+            {
+                if (!postfix.add(d->postfix))
+                    return NULL;
+            }
+
+            c               = make_composite(base, desc, postfix.array(), postfix.size());
+            return (c != NULL) ? c->vAtoms : NULL;
+        }
+
+        const atom_t *Atoms::composite_atoms(atom_t base, const char * const *postfix)
+        {
+            if ((base < 0) || (postfix == NULL))
+                return NULL;
+
+            composite_t *c  = find_composite(base, postfix);
+            if (c != NULL)
+                return c->vAtoms;
+
+            size_t count    = 0;
+            while (postfix[count] != NULL)
+                ++count;
+
+            c               = make_composite(base, postfix, postfix, count);
+            return (c != NULL) ? c->vAtoms : NULL;
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
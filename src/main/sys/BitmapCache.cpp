@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/tk/helpers/draw.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        //---------------------------------------------------------------------
+        ScaledBitmaps::ScaledBitmaps()
+        {
+        }
+
+        ScaledBitmaps::~ScaledBitmaps()
+        {
+            clear();
+        }
+
+        void ScaledBitmaps::clear()
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                mm::Bitmap *b = vItems.uget(i);
+                if (b != NULL)
+                    delete b;
+            }
+            vItems.flush();
+        }
+
+        const mm::Bitmap *ScaledBitmaps::get(const mm::Bitmap *src, size_t width, size_t height)
+        {
+            if ((width * height) > MAX_PIXELS)
+                return NULL;
+
+            // Lookup for existing item and move it to the head of the list
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                mm::Bitmap *b = vItems.uget(i);
+                if ((b->width() != width) || (b->height() != height))
+                    continue;
+
+                if (i > 0)
+                {
+                    vItems.remove(i);
+                    if (!vItems.insert(0, b))
+                    {
+                        delete b;
+                        return NULL;
+                    }
+                }
+                return b;
+            }
+
+            // Create new item
+            mm::Bitmap *b = new mm::Bitmap();
+            if (b == NULL)
+                return NULL;
+            if ((scale_bitmap(b, src, width, height) != STATUS_OK) || (!vItems.insert(0, b)))
+            {
+                delete b;
+                return NULL;
+            }
+
+            // Evict the least recently used item
+            if (vItems.size() > MAX_ITEMS)
+            {
+                const size_t last   = vItems.size() - 1;
+                mm::Bitmap *item    = vItems.uget(last);
+                vItems.remove(last);
+                delete item;
+            }
+
+            return b;
+        }
+
+        //---------------------------------------------------------------------
+        struct BitmapCache::image_t
+        {
+            LSPString       sPath;          // Path to the image
+            mm::IColorMap  *pMap;           // Color map used for decoding
+            mm::Bitmap      sBitmap;        // Decoded bitmap
+            ScaledBitmaps   sScaled;        // Pre-scaled versions of bitmap
+            BitmapCache    *pCache;         // Cache the image belongs to
+            size_t          nRefs;          // Number of references
+        };
+
+        BitmapCache::BitmapCache()
+        {
+        }
+
+        BitmapCache::~BitmapCache()
+        {
+            destroy();
+        }
+
+        void BitmapCache::destroy()
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                image_t *image = vItems.uget(i);
+                if (image != NULL)
+                    image->pCache   = NULL;
+            }
+            vItems.flush();
+        }
+
+        BitmapCache::image_t *BitmapCache::lookup(const LSPString *path, mm::IColorMap *map)
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                image_t *image = vItems.uget(i);
+                if ((image->pMap == map) && (image->sPath.equals(path)))
+                    return image;
+            }
+            return NULL;
+        }
+
+        void BitmapCache::unlink(image_t *image)
+        {
+            vItems.premove(image);
+        }
+
+        status_t BitmapCache::acquire(image_t **image, const char *path, mm::IColorMap *map)
+        {
+            LSPString tmp;
+            if (path == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (!tmp.set_utf8(path))
+                return STATUS_NO_MEM;
+            return acquire(image, &tmp, map);
+        }
+
+        status_t BitmapCache::acquire(image_t **image, const LSPString *path, mm::IColorMap *map)
+        {
+            if ((image == NULL) || (path == NULL))
+                return STATUS_BAD_ARGUMENTS;
+
+            // Lookup for already decoded image
+            image_t *item = lookup(path, map);
+            if (item != NULL)
+            {
+                *image      = retain(item);
+                return STATUS_OK;
+            }
+
+            // Decode the image
+            if ((item = new image_t) == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally {
+                if (item != NULL)
+                    delete item;
+            };
+
+            item->pMap      = map;
+            item->pCache    = this;
+            item->nRefs     = 1;
+            if (!item->sPath.set(path))
+                return STATUS_NO_MEM;
+            status_t res    = item->sBitmap.load(path, mm::PIXFMT_PBGRA8888, map);
+            if (res != STATUS_OK)
+                return res;
+            if (!vItems.add(item))
+                return STATUS_NO_MEM;
+
+            *image          = release_ptr(item);
+            return STATUS_OK;
+        }
+
+        BitmapCache::image_t *BitmapCache::retain(image_t *image)
+        {
+            if (image != NULL)
+                ++image->nRefs;
+            return image;
+        }
+
+        void BitmapCache::release(image_t **image)
+        {
+            image_t *item = *image;
+            if (item == NULL)
+                return;
+            *image      = NULL;
+
+            if ((--item->nRefs) > 0)
+                return;
+
+            if (item->pCache != NULL)
+                item->pCache->unlink(item);
+            delete item;
+        }
+
+        const mm::Bitmap *BitmapCache::bitmap(const image_t *image)
+        {
+            return &image->sBitmap;
+        }
+
+        const mm::Bitmap *BitmapCache::scaled(image_t *image, size_t width, size_t height)
+        {
+            return image->sScaled.get(&image->sBitmap, width, height);
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
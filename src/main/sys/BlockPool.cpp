@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static inline size_t pool_block_size(size_t size)
+        {
+            size    = lsp_max(size, sizeof(void *));
+            return align_size(size, DEFAULT_ALIGN);
+        }
+
+        BlockPool::BlockPool(size_t block_size, size_t chunk_size)
+        {
+            pChunks     = NULL;
+            pFree       = NULL;
+            nBlockSize  = (block_size > 0) ? pool_block_size(block_size) : 0;
+            nChunkSize  = lsp_max(chunk_size, size_t(DEFAULT_CHUNK_SIZE));
+            nChunks     = 0;
+            nAllocated  = 0;
+            nReferences = 0;
+            bDynamic    = false;
+        }
+
+        BlockPool::~BlockPool()
+        {
+            destroy();
+        }
+
+        void BlockPool::destroy()
+        {
+            for (chunk_t *c = pChunks; c != NULL; )
+            {
+                chunk_t *next   = c->pNext;
+                ::free(c);
+                c               = next;
+            }
+
+            pChunks     = NULL;
+            pFree       = NULL;
+            nChunks     = 0;
+            nAllocated  = 0;
+        }
+
+        BlockPool *BlockPool::create(size_t block_size, size_t chunk_size)
+        {
+            BlockPool *pool     = new BlockPool(block_size, chunk_size);
+            if (pool == NULL)
+                return NULL;
+
+            pool->nReferences   = 1;
+            pool->bDynamic      = true;
+            return pool;
+        }
+
+        BlockPool *BlockPool::acquire()
+        {
+            ++nReferences;
+            return this;
+        }
+
+        void BlockPool::release()
+        {
+            if (nReferences <= 0)
+                return;
+            if (((--nReferences) == 0) && (bDynamic))
+                delete this;
+        }
+
+        status_t BlockPool::set_block_size(size_t size)
+        {
+            if (size <= 0)
+                return STATUS_BAD_ARGUMENTS;
+            if (pChunks != NULL)
+                return STATUS_BAD_STATE;
+
+            nBlockSize  = pool_block_size(size);
+            return STATUS_OK;
+        }
+
+        bool BlockPool::grow()
+        {
+            const size_t hdr    = align_size(sizeof(chunk_t), DEFAULT_ALIGN);
+            const size_t count  = (nChunkSize - hdr) / nBlockSize;
+            if (count <= 0)
+                return false;
+
+            chunk_t *c          = static_cast<chunk_t *>(::malloc(nChunkSize));
+            if (c == NULL)
+                return false;
+            c->pNext            = pChunks;
+            c->nSize            = nChunkSize;
+            pChunks             = c;
+            ++nChunks;
+
+            // Link all blocks of the chunk into the free list
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>(c) + hdr;
+            for (size_t i=0; i<count; ++i, ptr += nBlockSize)
+            {
+                block_t *b          = reinterpret_cast<block_t *>(ptr);
+                b->pNext            = pFree;
+                pFree               = b;
+            }
+
+            return true;
+        }
+
+        void *BlockPool::alloc()
+        {
+            if (nBlockSize <= 0)
+                return NULL;
+            if ((pFree == NULL) && (!grow()))
+                return NULL;
+
+            block_t *b          = pFree;
+            pFree               = b->pNext;
+            ++nAllocated;
+
+            return b;
+        }
+
+        void BlockPool::free(void *ptr)
+        {
+            if (ptr == NULL)
+                return;
+
+            block_t *b          = static_cast<block_t *>(ptr);
+            b->pNext            = pFree;
+            pFree               = b;
+            --nAllocated;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -21,9 +21,12 @@
 
 #include <lsp-plug.in/tk/tk.h>
 #include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/ws/factory.h>
 #include <lsp-plug.in/i18n/Dictionary.h>
+#include <lsp-plug.in/io/InMemoryStream.h>
 #include <private/tk/style/BuiltinStyle.h>
+#include <private/tk/style/SharedStyleSheet.h>
 
 namespace lsp
 {
@@ -36,12 +39,27 @@ namespace lsp
             pDisplay        = NULL;
             pResourceLoader = NULL;
             pEnv            = NULL;
+            pSharedSheet    = NULL;
+            bSharedSchema   = false;
+            pSlotPool       = NULL;
+            bHeadless       = false;
+            pHeadless       = NULL;
+            nLayoutStart    = 0;
+            reset_layout_stats();
 
             // Apply custom settings
             if (settings != NULL)
             {
                 pResourceLoader     = settings->resources;
                 pEnv                = (settings->environment != NULL) ? settings->environment->clone() : NULL;
+                bSharedSchema       = settings->shared_schema;
+                if (settings->pooled_slots)
+                    pSlotPool           = BlockPool::create(SlotSet::item_size());
+                bHeadless           = settings->headless;
+                sRenderPool.set_threads(settings->render_threads);
+                sStylePool.set_threads(settings->style_threads);
+                if (settings->glass_cache_size > 0)
+                    sGlassCache.set_budget(settings->glass_cache_size);
             }
         }
 
@@ -58,6 +76,10 @@ namespace lsp
 
         void Display::do_destroy()
         {
+            // Drop pending updates
+            sMailbox.destroy();
+            vRelayout.flush();
+
             // Auto-destruct widgets
             size_t n    = sWidgets.size();
             for (size_t i=0; i<n; ++i)
@@ -81,13 +103,31 @@ namespace lsp
             sSlots.execute(SLOT_DESTROY, NULL);
             sSlots.destroy();
 
+            // Release the pool of widget slots, widgets that outlive the display keep it alive
+            if (pSlotPool != NULL)
+            {
+                pSlotPool->release();
+                pSlotPool       = NULL;
+            }
+
+            // Destroy shared surfaces
+            sGlassCache.destroy();
+            sBitmapCache.destroy();
+            sRenderPool.destroy();
+            sStylePool.destroy();
+
             // Destroy schema
             sSchema.destroy();
+            if (pSharedSheet != NULL)
+            {
+                SharedStyleSheet::release(pSharedSheet);
+                pSharedSheet    = NULL;
+            }
 
             // Destroy display
             if (pDisplay != NULL)
             {
-                ws::free_display(pDisplay);
+                free_display(pDisplay);
                 pDisplay = NULL;
             }
 
@@ -112,6 +152,7 @@ namespace lsp
             if (_this == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
+            _this->sMailbox.process(_this);
             _this->slots()->execute(tk::SLOT_IDLE, NULL, _this);
             _this->garbage_collect();
 
@@ -155,7 +196,11 @@ namespace lsp
         status_t Display::init(int argc, const char **argv)
         {
             // Create display
-            ws::IDisplay *dpy = ws::create_display(argc, argv);
+            ws::IDisplay *dpy = NULL;
+            if (bHeadless)
+                dpy     = pHeadless = new HeadlessDisplay();
+            else
+                dpy     = ws::create_display(argc, argv);
             if (dpy == NULL)
                 return STATUS_NO_MEM;
 
@@ -167,12 +212,24 @@ namespace lsp
             if (res != STATUS_OK)
             {
                 dpy->destroy();
-                ws::free_display(dpy);
+                free_display(dpy);
             }
 
             return res;
         }
 
+        void Display::free_display(ws::IDisplay *dpy)
+        {
+            if ((dpy != NULL) && (dpy == pHeadless))
+            {
+                dpy->destroy();
+                delete pHeadless;
+                pHeadless   = NULL;
+            }
+            else
+                ws::free_display(dpy);
+        }
+
         status_t Display::init(ws::IDisplay *dpy, int argc, const char **argv)
         {
             // Should be non-null
@@ -251,19 +308,105 @@ namespace lsp
             if (schema_path == NULL)
                 return STATUS_OK;
 
-            // Load style sheet
-            StyleSheet sheet;
-            io::IInSequence *is = pResourceLoader->read_sequence(schema_path);
+            // Load style sheet privately
+            if (!bSharedSchema)
+            {
+                StyleSheet sheet;
+                if ((res = load_stylesheet(&sheet, schema_path)) != STATUS_OK)
+                    return res;
+
+                return sSchema.apply(&sheet);
+            }
+
+            // Obtain the style sheet shared between displays, the stamp of the source
+            // data ensures that the modified source is loaded again. The schema itself
+            // is not shared: styles hold listeners and atoms of the display
+            stylesheet_source_t src;
+            lsp_finally { src.data.drop(); };
+            if ((res = read_stylesheet(&src.data, &src.stamp, schema_path)) != STATUS_OK)
+                return res;
+            src.display     = this;
+
+            if ((res = SharedStyleSheet::acquire(&pSharedSheet, schema_path, &src.stamp, load_shared_stylesheet, &src)) != STATUS_OK)
+                return res;
+
+            // Apply the shared style sheet, it is immutable and is kept alive by the acquired reference
+            return sSchema.apply(SharedStyleSheet::sheet(pSharedSheet));
+        }
+
+        status_t Display::read_stylesheet(io::OutMemoryStream *data, digest_t *stamp, const char *path)
+        {
+            io::IInStream *is = pResourceLoader->read_stream(path);
             if (is == NULL)
                 return STATUS_NOT_FOUND;
+            lsp_finally {
+                is->close();
+                delete is;
+            };
+
+            // Read the raw source data, it is decoded only if the cache is outdated
+            wssize_t count = is->sink(data);
+            if (count < 0)
+                return status_t(-count);
+
+            // The digest of the data serves as a stamp of the source
+            sha256(stamp, data->data(), data->size());
+            return STATUS_OK;
+        }
+
+        status_t Display::load_stylesheet(StyleSheet *sheet, const char *path)
+        {
+            // Parse style sheet directly if there is no cache
+            const char *cache_path = pEnv->get_utf8(LSP_TK_ENV_SCHEMA_CACHE);
+            if (cache_path == NULL)
+            {
+                io::IInSequence *is = pResourceLoader->read_sequence(path);
+                if (is == NULL)
+                    return STATUS_NOT_FOUND;
+                return sheet->parse_data(is, WRAP_CLOSE | WRAP_DELETE);
+            }
 
-            // Parse style
-            res = sheet.parse_data(is, WRAP_CLOSE | WRAP_DELETE);
+            io::OutMemoryStream data;
+            lsp_finally { data.drop(); };
+            digest_t stamp;
+            status_t res = read_stylesheet(&data, &stamp, path);
             if (res != STATUS_OK)
                 return res;
 
-            // Apply loaded schema
-            return sSchema.apply(&sheet);
+            return load_stylesheet(sheet, &data, &stamp);
+        }
+
+        status_t Display::load_stylesheet(StyleSheet *sheet, const io::OutMemoryStream *data, const digest_t *stamp)
+        {
+            status_t res;
+            sheet->set_pool(&sStylePool);
+            lsp_finally { sheet->set_pool(NULL); };
+
+            io::InMemoryStream is;
+            is.wrap(data->data(), data->size());
+
+            // Parse style sheet directly if there is no cache
+            const char *cache_path = pEnv->get_utf8(LSP_TK_ENV_SCHEMA_CACHE);
+            if (cache_path == NULL)
+                return sheet->parse_data(&is);
+
+            // Try to load the precompiled style sheet
+            if ((res = sheet->load_binary(cache_path, stamp)) == STATUS_OK)
+                return res;
+
+            // Parse the style sheet and update cache
+            if ((res = sheet->parse_data(&is)) != STATUS_OK)
+                return res;
+            if ((res = sheet->save_binary(cache_path, stamp)) != STATUS_OK)
+                lsp_warn("Could not save schema cache to '%s', error code %d", cache_path, int(res));
+
+            return STATUS_OK;
+        }
+
+        status_t Display::load_shared_stylesheet(StyleSheet *sheet, void *arg)
+        {
+            stylesheet_source_t *src = static_cast<stylesheet_source_t *>(arg);
+            return src->display->load_stylesheet(sheet, &src->data, &src->stamp);
         }
 
         status_t Display::main()
@@ -287,6 +430,7 @@ namespace lsp
                 return STATUS_UNKNOWN_ERR;
             lsp_finally { sLock.unlock(); };
 
+            sMailbox.process(this);
             return pDisplay->process_pending_events();
         }
 
@@ -299,6 +443,7 @@ namespace lsp
                 return STATUS_UNKNOWN_ERR;
             lsp_finally { sLock.unlock(); };
 
+            sMailbox.process(this);
             return pDisplay->main_iteration();
         }
 
@@ -464,6 +609,114 @@ namespace lsp
             return vGarbage.add(widget) ? STATUS_OK : STATUS_NO_MEM;
         }
 
+        status_t Display::queue_relayout(Widget *widget, const ws::size_limit_t *limit)
+        {
+            relayout_t *item    = vRelayout.add();
+            if (item == NULL)
+                return STATUS_NO_MEM;
+
+            item->pWidget       = widget;
+            item->sLimit        = *limit;
+
+            return STATUS_OK;
+        }
+
+        void Display::cancel_relayout(Widget *widget)
+        {
+            for (size_t i=0, n=vRelayout.size(); i<n; ++i)
+            {
+                if (vRelayout.uget(i)->pWidget == widget)
+                {
+                    vRelayout.remove(i);
+                    return;
+                }
+            }
+        }
+
+        size_t Display::process_relayout(Widget *toplevel)
+        {
+            size_t confined = 0;
+
+            // Committing relayout may append new items to the queue, they are processed in the same loop
+            for (size_t i=0; i<vRelayout.size(); )
+            {
+                const relayout_t *item  = vRelayout.uget(i);
+                if (item->pWidget->toplevel() != toplevel)
+                {
+                    ++i;
+                    continue;
+                }
+
+                Widget *w               = item->pWidget;
+                const ws::size_limit_t limit = item->sLimit;
+                vRelayout.remove(i);
+
+                if (w->commit_relayout(&limit))
+                    ++confined;
+            }
+
+            return confined;
+        }
+
+        void Display::end_layout(bool partial)
+        {
+            const size_t count  = sLayoutStats.nRealized - nLayoutStart;
+            if (count == 0)
+                return;
+
+            ++sLayoutStats.nPasses;
+            if (partial)
+                ++sLayoutStats.nPartial;
+            sLayoutStats.nWidgets = count;
+        }
+
+        void Display::reset_layout_stats()
+        {
+            sLayoutStats.nPasses    = 0;
+            sLayoutStats.nPartial   = 0;
+            sLayoutStats.nWidgets   = 0;
+            sLayoutStats.nRealized  = 0;
+            nLayoutStart            = 0;
+        }
+
+        status_t Display::census(lltl::darray<w_census_t> *dst)
+        {
+            dst->clear();
+
+            for (size_t i=0, n=sWidgets.size(); i<n; ++i)
+            {
+                const item_t *item  = sWidgets.uget(i);
+                const Widget *w     = (item != NULL) ? item->widget : NULL;
+                if (w == NULL)
+                    continue;
+
+                // Find the record for the widget class
+                w_census_t *rec     = NULL;
+                for (size_t j=0, m=dst->size(); j<m; ++j)
+                {
+                    w_census_t *c       = dst->uget(j);
+                    if (c->pClass == w->get_class())
+                    {
+                        rec                 = c;
+                        break;
+                    }
+                }
+
+                if (rec == NULL)
+                {
+                    if ((rec = dst->add()) == NULL)
+                        return STATUS_NO_MEM;
+                    ::memset(rec, 0, sizeof(w_census_t));
+                    rec->pClass         = w->get_class();
+                }
+
+                ++rec->nInstances;
+                w->memory_usage(&rec->sMemory);
+            }
+
+            return STATUS_OK;
+        }
+
         const ws::MonitorInfo *Display::enum_monitors(size_t *count)
         {
             return pDisplay->enum_monitors(count);
@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/tk/helpers/draw.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        struct GlassCache::glass_t
+        {
+            size_t          nType;          // Type of glass
+            uint32_t        nGlassColor;    // Color of the glass
+            uint32_t        nBorderColor;   // Color of the border
+            size_t          nMask;          // Rounding mask
+            ssize_t         nThick;         // Thickness of the border
+            ssize_t         nRadius;        // Rounding radius
+            size_t          nWidth;         // Width of the glass
+            size_t          nHeight;        // Height of the glass
+            bool            bFlat;          // Flat border
+
+            lsp::Color      sGlass;         // Actual glass color
+            lsp::Color      sBorder;        // Actual border color
+            ws::ISurface   *pSurface;       // Rendered surface
+            size_t          nRefs;          // Number of references
+            GlassCache     *pCache;         // Owning cache, NULL if the cache has been destroyed
+            glass_t        *pPrev;          // Previous item in the LRU list
+            glass_t        *pNext;          // Next item in the LRU list
+        };
+
+        GlassCache::GlassCache()
+        {
+            pHead       = NULL;
+            pTail       = NULL;
+            nBudget     = DEFAULT_BUDGET;
+            nUsed       = 0;
+        }
+
+        GlassCache::~GlassCache()
+        {
+            destroy();
+        }
+
+        void GlassCache::destroy()
+        {
+            // Destroy all surfaces, detach items that are still referenced by widgets
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                glass_t *item = vItems.uget(i);
+                drop_surface(item);
+                if (item->nRefs > 0)
+                {
+                    item->pCache    = NULL;
+                    item->pPrev     = NULL;
+                    item->pNext     = NULL;
+                }
+                else
+                    delete item;
+            }
+
+            vItems.flush();
+            pHead       = NULL;
+            pTail       = NULL;
+            nUsed       = 0;
+        }
+
+        void GlassCache::link_lru(glass_t *item)
+        {
+            item->pPrev     = NULL;
+            item->pNext     = pHead;
+            if (pHead != NULL)
+                pHead->pPrev    = item;
+            else
+                pTail           = item;
+            pHead           = item;
+        }
+
+        void GlassCache::unlink_lru(glass_t *item)
+        {
+            if ((item->pPrev == NULL) && (pHead != item))
+                return;
+
+            if (item->pPrev != NULL)
+                item->pPrev->pNext  = item->pNext;
+            else
+                pHead               = item->pNext;
+            if (item->pNext != NULL)
+                item->pNext->pPrev  = item->pPrev;
+            else
+                pTail               = item->pPrev;
+
+            item->pPrev     = NULL;
+            item->pNext     = NULL;
+        }
+
+        void GlassCache::drop_surface(glass_t *item)
+        {
+            if (item->pSurface == NULL)
+                return;
+
+            nUsed      -= lsp_min(nUsed, item->nWidth * item->nHeight * sizeof(uint32_t));
+            item->pSurface->destroy();
+            delete item->pSurface;
+            item->pSurface  = NULL;
+        }
+
+        void GlassCache::drop(glass_t *item)
+        {
+            unlink_lru(item);
+            vItems.premove(item);
+            drop_surface(item);
+            delete item;
+        }
+
+        void GlassCache::evict(size_t budget)
+        {
+            // The LRU list contains only unreferenced items with rendered surfaces
+            while ((nUsed > budget) && (pTail != NULL))
+                drop(pTail);
+        }
+
+        bool GlassCache::match(const glass_t *a, const glass_t *b)
+        {
+            return
+                (a->nType == b->nType) &&
+                (a->nWidth == b->nWidth) &&
+                (a->nHeight == b->nHeight) &&
+                (a->nMask == b->nMask) &&
+                (a->nRadius == b->nRadius) &&
+                (a->nThick == b->nThick) &&
+                (a->bFlat == b->bFlat) &&
+                (a->nGlassColor == b->nGlassColor) &&
+                (a->nBorderColor == b->nBorderColor);
+        }
+
+        void GlassCache::init_key(glass_t *key,
+            glass_type_t type,
+            const lsp::Color &gc, const lsp::Color *bc,
+            size_t mask, ssize_t thick, ssize_t radius,
+            size_t width, size_t height, bool flat)
+        {
+            key->nType          = type;
+            key->nGlassColor    = gc.rgba32();
+            key->nBorderColor   = (bc != NULL) ? bc->rgba32() : 0;
+            key->nMask          = mask;
+            key->nThick         = thick;
+            key->nRadius        = radius;
+            key->nWidth         = width;
+            key->nHeight        = height;
+            key->bFlat          = flat;
+
+            key->sGlass.copy(gc);
+            if (bc != NULL)
+                key->sBorder.copy(bc);
+            key->pSurface       = NULL;
+            key->nRefs          = 0;
+            key->pCache         = NULL;
+            key->pPrev          = NULL;
+            key->pNext          = NULL;
+        }
+
+        GlassCache::glass_t *GlassCache::lookup(const glass_t *key)
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                glass_t *item = vItems.uget(i);
+                if (match(item, key))
+                    return item;
+            }
+            return NULL;
+        }
+
+        ws::ISurface *GlassCache::acquire(glass_t **g, ws::ISurface *s, const glass_t *key)
+        {
+            glass_t *item   = *g;
+
+            // Check that the glass held by the widget still matches the parameters
+            if ((item == NULL) || (item->pCache != this) || (!match(item, key)))
+            {
+                glass_t *found  = lookup(key);
+                if (found == NULL)
+                {
+                    found           = new glass_t;
+                    if (found == NULL)
+                        return NULL;
+                    *found          = *key;
+                    found->pCache   = this;
+                    if (!vItems.add(found))
+                    {
+                        delete found;
+                        return NULL;
+                    }
+                }
+
+                if ((found->nRefs++) == 0)
+                    unlink_lru(found);
+                release(g);
+                *g              = found;
+                item            = found;
+            }
+
+            // Drop the surface if it has become invalid
+            if ((item->pSurface != NULL) && (!item->pSurface->valid()))
+                drop_surface(item);
+            if (item->pSurface != NULL)
+                return item->pSurface;
+
+            // Render the glass
+            ws::ISurface *gs    = NULL;
+            if (item->nType == GT_BORDER_GLASS)
+                create_border_glass(&gs, s,
+                    item->sGlass, item->sBorder,
+                    item->nMask, item->nThick, item->nRadius,
+                    item->nWidth, item->nHeight, item->bFlat);
+            else
+                create_glass(&gs, s,
+                    item->sGlass,
+                    item->nMask, item->nRadius,
+                    item->nWidth, item->nHeight);
+            if (gs == NULL)
+                return NULL;
+
+            item->pSurface      = gs;
+            nUsed              += item->nWidth * item->nHeight * sizeof(uint32_t);
+
+            // Keep the cache within the budget
+            evict(nBudget);
+
+            return gs;
+        }
+
+        ws::ISurface *GlassCache::glass(glass_t **g, ws::ISurface *s,
+            const lsp::Color &c,
+            size_t mask, ssize_t radius, size_t width, size_t height)
+        {
+            glass_t key;
+            init_key(&key, GT_GLASS, c, NULL, mask, 0, radius, width, height, false);
+            return acquire(g, s, &key);
+        }
+
+        ws::ISurface *GlassCache::border_glass(glass_t **g, ws::ISurface *s,
+            const lsp::Color &gc, const lsp::Color &bc,
+            size_t mask, ssize_t thick, ssize_t radius,
+            size_t width, size_t height, bool flat)
+        {
+            glass_t key;
+            init_key(&key, GT_BORDER_GLASS, gc, &bc, mask, thick, radius, width, height, flat);
+            return acquire(g, s, &key);
+        }
+
+        void GlassCache::release(glass_t **g)
+        {
+            glass_t *item   = *g;
+            if (item == NULL)
+                return;
+            *g              = NULL;
+
+            if (item->nRefs > 0)
+                --item->nRefs;
+            if (item->nRefs > 0)
+                return;
+
+            // Free the item detached from the destroyed cache
+            if (item->pCache == NULL)
+            {
+                delete item;
+                return;
+            }
+
+            item->pCache->do_release(item);
+        }
+
+        void GlassCache::do_release(glass_t *item)
+        {
+            // Keep the rendered surface for further reuse while it fits the budget
+            if (item->pSurface == NULL)
+                drop(item);
+            else
+            {
+                link_lru(item);
+                evict(nBudget);
+            }
+        }
+
+        void GlassCache::set_budget(size_t budget)
+        {
+            nBudget     = budget;
+            evict(nBudget);
+        }
+
+        void GlassCache::gc()
+        {
+            evict(0);
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
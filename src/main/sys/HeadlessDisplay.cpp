@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/runtime/system.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr size_t HEADLESS_SCREEN_WIDTH       = 1920;
+        static constexpr size_t HEADLESS_SCREEN_HEIGHT      = 1080;
+
+        HeadlessDisplay::HeadlessDisplay():
+            ws::IDisplay()
+        {
+            nScreenWidth    = HEADLESS_SCREEN_WIDTH;
+            nScreenHeight   = HEADLESS_SCREEN_HEIGHT;
+            bQuit           = false;
+        }
+
+        HeadlessDisplay::~HeadlessDisplay()
+        {
+            destroy();
+        }
+
+        status_t HeadlessDisplay::init(int argc, const char **argv)
+        {
+            bQuit           = false;
+            return ws::IDisplay::init(argc, argv);
+        }
+
+        void HeadlessDisplay::destroy()
+        {
+            // Detach all windows still alive, they will be destroyed by their owners
+            vPending.flush();
+            for (size_t i=0, n=vWindows.size(); i<n; ++i)
+            {
+                HeadlessWindow *wnd = vWindows.uget(i);
+                wnd->pHeadless      = NULL;
+            }
+            vWindows.flush();
+
+            ws::IDisplay::destroy();
+        }
+
+        status_t HeadlessDisplay::attach(HeadlessWindow *wnd)
+        {
+            if (wnd == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (vWindows.index_of(wnd) >= 0)
+                return STATUS_OK;
+            return (vWindows.add(wnd)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        void HeadlessDisplay::detach(HeadlessWindow *wnd)
+        {
+            vWindows.premove(wnd);
+
+            // Drop all pending events of the window
+            for (size_t i=0; i<vPending.size(); )
+            {
+                if (vPending.uget(i)->pWindow == wnd)
+                    vPending.remove(i);
+                else
+                    ++i;
+            }
+        }
+
+        status_t HeadlessDisplay::send_event(ws::IWindow *wnd, const ws::event_t *ev)
+        {
+            if ((wnd == NULL) || (ev == NULL))
+                return STATUS_BAD_ARGUMENTS;
+
+            HeadlessWindow *hwnd = static_cast<HeadlessWindow *>(wnd);
+            if (vWindows.index_of(hwnd) < 0)
+                return STATUS_NOT_FOUND;
+
+            pending_t *p    = vPending.add();
+            if (p == NULL)
+                return STATUS_NO_MEM;
+
+            p->pWindow      = hwnd;
+            p->sEvent       = *ev;
+            if (p->sEvent.nTime == 0)
+                p->sEvent.nTime = system::get_time_millis();
+
+            return STATUS_OK;
+        }
+
+        size_t HeadlessDisplay::dispatch_events()
+        {
+            // Events sent by the handlers will be delivered by the next iteration
+            lltl::darray<pending_t> queue;
+            queue.swap(&vPending);
+
+            for (size_t i=0, n=queue.size(); i<n; ++i)
+            {
+                pending_t *p    = queue.uget(i);
+                // The window may be destroyed by one of previous events
+                if (vWindows.index_of(p->pWindow) >= 0)
+                    p->pWindow->dispatch(&p->sEvent);
+            }
+
+            return queue.size();
+        }
+
+        status_t HeadlessDisplay::main()
+        {
+            bQuit           = false;
+
+            while (!bQuit)
+            {
+                status_t res    = main_iteration();
+                if (res != STATUS_OK)
+                    return res;
+                if (bQuit)
+                    break;
+                wait_events(10);
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t HeadlessDisplay::main_iteration()
+        {
+            const ws::timestamp_t ts = system::get_time_millis();
+
+            dispatch_events();
+            call_main_task(ts);
+            return process_pending_tasks(ts);
+        }
+
+        void HeadlessDisplay::quit_main()
+        {
+            bQuit           = true;
+        }
+
+        status_t HeadlessDisplay::wait_events(wssize_t millis)
+        {
+            if ((vPending.size() <= 0) && (millis > 0))
+                ipc::Thread::sleep(millis);
+            return STATUS_OK;
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window()
+        {
+            return new HeadlessWindow(this, default_screen());
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window(size_t screen)
+        {
+            return new HeadlessWindow(this, screen);
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window(void *handle)
+        {
+            // There are no native windows to embed into
+            return new HeadlessWindow(this, default_screen());
+        }
+
+        ws::ISurface *HeadlessDisplay::create_surface(size_t width, size_t height)
+        {
+            return new HeadlessSurface(width, height);
+        }
+
+        size_t HeadlessDisplay::screens()
+        {
+            return 1;
+        }
+
+        size_t HeadlessDisplay::default_screen()
+        {
+            return 0;
+        }
+
+        status_t HeadlessDisplay::screen_size(size_t screen, ssize_t *w, ssize_t *h)
+        {
+            if (screen != 0)
+                return STATUS_BAD_ARGUMENTS;
+            if (w != NULL)
+                *w              = nScreenWidth;
+            if (h != NULL)
+                *h              = nScreenHeight;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessDisplay::work_area_geometry(ws::rectangle_t *r)
+        {
+            if (r == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            r->nLeft        = 0;
+            r->nTop         = 0;
+            r->nWidth       = nScreenWidth;
+            r->nHeight      = nScreenHeight;
+            return STATUS_OK;
+        }
+
+        void HeadlessDisplay::set_screen_size(size_t width, size_t height)
+        {
+            nScreenWidth    = width;
+            nScreenHeight   = height;
+        }
+
+        // Fonts are not rasterized, so there is nothing to load
+        status_t HeadlessDisplay::add_font(const char *name, const char *path)
+        {
+            return ((name != NULL) && (path != NULL)) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessDisplay::add_font(const char *name, const io::Path *path)
+        {
+            return ((name != NULL) && (path != NULL)) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessDisplay::add_font(const char *name, const LSPString *path)
+        {
+            return ((name != NULL) && (path != NULL)) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessDisplay::add_font(const char *name, io::IInStream *is)
+        {
+            return ((name != NULL) && (is != NULL)) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessDisplay::add_font_alias(const char *name, const char *alias)
+        {
+            return ((name != NULL) && (alias != NULL)) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessDisplay::remove_font(const char *name)
+        {
+            return (name != NULL) ? STATUS_OK : STATUS_BAD_ARGUMENTS;
+        }
+
+        void HeadlessDisplay::remove_all_fonts()
+        {
+        }
+
+        bool HeadlessDisplay::get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            HeadlessSurface::estimate_font(f, fp);
+            return true;
+        }
+
+        bool HeadlessDisplay::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text)
+        {
+            if (text == NULL)
+                return false;
+
+            HeadlessSurface::estimate_text(f, tp, HeadlessSurface::glyphs(text));
+            return true;
+        }
+
+        bool HeadlessDisplay::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return false;
+
+            first   = lsp_limit(first, 0, ssize_t(text->length()));
+            last    = lsp_limit(last, first, ssize_t(text->length()));
+            HeadlessSurface::estimate_text(f, tp, last - first);
+            return true;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
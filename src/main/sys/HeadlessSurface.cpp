@@ -0,0 +1,1109 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+
+        static inline uint32_t scale_pixel(uint32_t p, uint32_t k)
+        {
+            // k is in range 0..256
+            const uint32_t rb   = (((p & 0x00ff00ff) * k) >> 8) & 0x00ff00ff;
+            const uint32_t ag   = (((p >> 8) & 0x00ff00ff) * k) & 0xff00ff00;
+            return ag | rb;
+        }
+
+        static inline uint32_t blend_pixel(uint32_t dst, uint32_t src)
+        {
+            const uint32_t sa   = src >> 24;
+            if (sa == 0xff)
+                return src;
+            if (sa == 0)
+                return dst;
+            return src + scale_pixel(dst, 256 - sa);
+        }
+
+        static inline uint32_t make_pixel(float r, float g, float b, float a)
+        {
+            const float ka  = lsp_limit(1.0f - a, 0.0f, 1.0f);
+            const uint32_t pr = uint32_t(lsp_limit(r, 0.0f, 1.0f) * ka * 255.0f + 0.5f);
+            const uint32_t pg = uint32_t(lsp_limit(g, 0.0f, 1.0f) * ka * 255.0f + 0.5f);
+            const uint32_t pb = uint32_t(lsp_limit(b, 0.0f, 1.0f) * ka * 255.0f + 0.5f);
+
+            return (uint32_t(ka * 255.0f + 0.5f) << 24) | (pr << 16) | (pg << 8) | pb;
+        }
+
+        static inline uint32_t make_pixel(const Color &c)
+        {
+            return make_pixel(c.red(), c.green(), c.blue(), c.alpha());
+        }
+
+        /**
+         * Gradient rasterized by the headless surface, the color outside of the
+         * gradient range is the color of the nearest stop
+         */
+        class HeadlessGradient: public ws::IGradient
+        {
+            protected:
+                typedef struct stop_t
+                {
+                    float       offset;
+                    float       r, g, b, a;
+                } stop_t;
+
+            protected:
+                lltl::darray<stop_t>    vStops;
+                float                   fX0, fY0;       // Start point or center of the start circle
+                float                   fX1, fY1;       // End point or center of the end circle
+                float                   fR;             // Radius of the end circle, negative for linear gradient
+
+            public:
+                explicit HeadlessGradient(float x0, float y0, float x1, float y1, float r)
+                {
+                    fX0         = x0;
+                    fY0         = y0;
+                    fX1         = x1;
+                    fY1         = y1;
+                    fR          = r;
+                }
+
+                virtual ~HeadlessGradient() override
+                {
+                    vStops.flush();
+                }
+
+            public:
+                virtual void add_color(float offset, float r, float g, float b, float a) override
+                {
+                    // Keep stops sorted by offset
+                    size_t index = vStops.size();
+                    while ((index > 0) && (vStops.uget(index - 1)->offset > offset))
+                        --index;
+
+                    stop_t *s = vStops.insert(index);
+                    if (s == NULL)
+                        return;
+                    s->offset   = offset;
+                    s->r        = r;
+                    s->g        = g;
+                    s->b        = b;
+                    s->a        = a;
+                }
+
+                bool offset(float *t, float x, float y) const
+                {
+                    const float dx  = fX1 - fX0;
+                    const float dy  = fY1 - fY0;
+                    const float px  = x - fX0;
+                    const float py  = y - fY0;
+
+                    // Linear gradient: projection of the point to the gradient vector
+                    if (fR < 0.0f)
+                    {
+                        const float d   = dx*dx + dy*dy;
+                        *t              = (d > 0.0f) ? (px*dx + py*dy) / d : 0.0f;
+                        return true;
+                    }
+
+                    // Radial gradient: the start circle has zero radius, find the largest t
+                    // for which the point lies on the circle with center c0 + t*(c1 - c0)
+                    // and radius t*r
+                    const float qa  = dx*dx + dy*dy - fR*fR;
+                    const float qb  = px*dx + py*dy;
+                    const float qc  = px*px + py*py;
+                    if (fabsf(qa) < 1e-6f)
+                    {
+                        if (fabsf(qb) < 1e-6f)
+                            return false;
+                        *t              = qc / (2.0f * qb);
+                        return *t >= 0.0f;
+                    }
+
+                    const float disc = qb*qb - qa*qc;
+                    if (disc < 0.0f)
+                        return false;
+                    const float sq  = sqrtf(disc);
+                    const float t1  = (qb + sq) / qa;
+                    const float t2  = (qb - sq) / qa;
+                    *t              = lsp_max(t1, t2);
+                    if (*t < 0.0f)
+                        *t              = lsp_min(t1, t2);
+                    return *t >= 0.0f;
+                }
+
+                uint32_t color(float x, float y) const
+                {
+                    const size_t n = vStops.size();
+                    float t;
+                    if ((n <= 0) || (!offset(&t, x, y)))
+                        return 0;
+
+                    // Find the pair of stops and interpolate between them
+                    const stop_t *s0 = vStops.uget(0);
+                    if (t <= s0->offset)
+                        return make_pixel(s0->r, s0->g, s0->b, s0->a);
+                    for (size_t i=1; i<n; ++i)
+                    {
+                        const stop_t *s1 = vStops.uget(i);
+                        if (t < s1->offset)
+                        {
+                            const float d   = s1->offset - s0->offset;
+                            const float k   = (d > 0.0f) ? (t - s0->offset) / d : 0.0f;
+                            return make_pixel(
+                                s0->r + (s1->r - s0->r) * k,
+                                s0->g + (s1->g - s0->g) * k,
+                                s0->b + (s1->b - s0->b) * k,
+                                s0->a + (s1->a - s0->a) * k);
+                        }
+                        s0 = s1;
+                    }
+
+                    return make_pixel(s0->r, s0->g, s0->b, s0->a);
+                }
+        };
+
+        HeadlessSurface::HeadlessSurface(size_t width, size_t height):
+            ws::ISurface(width, height, ws::ST_IMAGE)
+        {
+            nCols           = width;
+            nRows           = height;
+            vData           = NULL;
+            pBuffer         = NULL;
+
+            sClip.nLeft     = 0;
+            sClip.nTop      = 0;
+            sClip.nWidth    = width;
+            sClip.nHeight   = height;
+
+            const size_t count  = width * height;
+            if (count > 0)
+            {
+                vData           = alloc_aligned<uint32_t>(pBuffer, count, DEFAULT_ALIGN);
+                if (vData != NULL)
+                    bzero(vData, count * sizeof(uint32_t));
+            }
+        }
+
+        HeadlessSurface::~HeadlessSurface()
+        {
+            destroy();
+        }
+
+        void HeadlessSurface::destroy()
+        {
+            free_aligned(pBuffer);
+            vData           = NULL;
+            nCols           = 0;
+            nRows           = 0;
+            sClip.nWidth    = 0;
+            sClip.nHeight   = 0;
+            vClips.flush();
+            vPoints.flush();
+            vEdges.flush();
+            vCrossings.flush();
+        }
+
+        ws::ISurface *HeadlessSurface::create(size_t width, size_t height)
+        {
+            HeadlessSurface *s = new HeadlessSurface(width, height);
+            if (s == NULL)
+                return NULL;
+            if ((s->vData == NULL) && (width * height > 0))
+            {
+                delete s;
+                return NULL;
+            }
+            return s;
+        }
+
+        void HeadlessSurface::fill(uint32_t color, float left, float top, float width, float height)
+        {
+            if (vData == NULL)
+                return;
+
+            // Compute the area to fill
+            ssize_t l   = lsp_max(ssize_t(roundf(left)), sClip.nLeft);
+            ssize_t t   = lsp_max(ssize_t(roundf(top)), sClip.nTop);
+            ssize_t r   = lsp_min(ssize_t(roundf(left + width)), sClip.nLeft + sClip.nWidth);
+            ssize_t b   = lsp_min(ssize_t(roundf(top + height)), sClip.nTop + sClip.nHeight);
+            if ((l >= r) || (t >= b))
+                return;
+
+            for (ssize_t y=t; y<b; ++y)
+            {
+                uint32_t *row = &vData[y * nCols];
+                if ((color >> 24) == 0xff)
+                {
+                    for (ssize_t x=l; x<r; ++x)
+                        row[x]      = color;
+                }
+                else
+                {
+                    for (ssize_t x=l; x<r; ++x)
+                        row[x]      = blend_pixel(row[x], color);
+                }
+            }
+        }
+
+        void HeadlessSurface::blit(const void *data, size_t width, size_t height, size_t stride,
+            float x, float y, float sx, float sy, float a)
+        {
+            if ((vData == NULL) || (data == NULL) || (sx <= 0.0f) || (sy <= 0.0f))
+                return;
+
+            const uint32_t k    = uint32_t(lsp_limit(1.0f - a, 0.0f, 1.0f) * 256.0f);
+            if (k == 0)
+                return;
+
+            // Compute the destination area
+            ssize_t l   = lsp_max(ssize_t(roundf(x)), sClip.nLeft);
+            ssize_t t   = lsp_max(ssize_t(roundf(y)), sClip.nTop);
+            ssize_t r   = lsp_min(ssize_t(roundf(x + width * sx)), sClip.nLeft + sClip.nWidth);
+            ssize_t b   = lsp_min(ssize_t(roundf(y + height * sy)), sClip.nTop + sClip.nHeight);
+            if ((l >= r) || (t >= b))
+                return;
+
+            // Use nearest neighbour sampling
+            const uint8_t *src  = static_cast<const uint8_t *>(data);
+            for (ssize_t dy=t; dy<b; ++dy)
+            {
+                const ssize_t row   = lsp_limit(ssize_t((dy - y + 0.5f) / sy), 0, ssize_t(height) - 1);
+                const uint32_t *sp  = reinterpret_cast<const uint32_t *>(&src[row * stride]);
+                uint32_t *dp        = &vData[dy * nCols];
+
+                for (ssize_t dx=l; dx<r; ++dx)
+                {
+                    const ssize_t col   = lsp_limit(ssize_t((dx - x + 0.5f) / sx), 0, ssize_t(width) - 1);
+                    uint32_t p          = sp[col];
+                    if (k < 256)
+                        p                   = scale_pixel(p, k);
+                    dp[dx]              = blend_pixel(dp[dx], p);
+                }
+            }
+        }
+
+        void HeadlessSurface::add_point(float x, float y)
+        {
+            point_t *p = vPoints.add();
+            if (p == NULL)
+                return;
+            p->x        = x;
+            p->y        = y;
+        }
+
+        void HeadlessSurface::add_arc(float cx, float cy, float r, float a1, float a2)
+        {
+            // Angles grow clockwise, the end angle is always after the start angle
+            while (a2 < a1)
+                a2         += 2.0f * M_PI;
+
+            // Choose the number of segments that keeps the chord error below the quarter of pixel
+            r               = lsp_max(r, 0.0f);
+            const float step    = (r > 0.25f) ? 2.0f * acosf(1.0f - 0.25f / r) : M_PI * 0.5f;
+            const size_t n      = lsp_limit(size_t(ceilf((a2 - a1) / step)), size_t(1), size_t(0x400));
+            const float delta   = (a2 - a1) / n;
+
+            for (size_t i=0; i<=n; ++i)
+            {
+                const float a   = a1 + delta * i;
+                add_point(cx + r * cosf(a), cy + r * sinf(a));
+            }
+        }
+
+        void HeadlessSurface::close_contour(ssize_t orient)
+        {
+            const size_t n = vPoints.size();
+            if (n < 3)
+            {
+                vPoints.clear();
+                return;
+            }
+
+            // Force the orientation of the contour if required
+            const point_t *p = vPoints.uget(0);
+            float area = 0.0f;
+            for (size_t i=0; i<n; ++i)
+            {
+                const point_t *a = &p[i], *b = &p[(i + 1) % n];
+                area           += a->x * b->y - b->x * a->y;
+            }
+            const ssize_t sign  = ((orient > 0) && (area < 0.0f)) || ((orient < 0) && (area > 0.0f)) ? -1 : 1;
+
+            // Emit non-horizontal edges
+            for (size_t i=0; i<n; ++i)
+            {
+                const point_t *a = &p[i], *b = &p[(i + 1) % n];
+                if (a->y == b->y)
+                    continue;
+
+                edge_t *e       = vEdges.add();
+                if (e == NULL)
+                    break;
+
+                if (a->y > b->y)
+                    lsp::swap(a, b);
+                e->x0           = a->x;
+                e->y0           = a->y;
+                e->y1           = b->y;
+                e->k            = (b->x - a->x) / (b->y - a->y);
+                e->dir          = ((a == &p[i]) ? 1 : -1) * sign;
+            }
+
+            vPoints.clear();
+        }
+
+        void HeadlessSurface::add_polygon(const float *x, const float *y, size_t n, ssize_t orient)
+        {
+            for (size_t i=0; i<n; ++i)
+                add_point(x[i], y[i]);
+            close_contour(orient);
+        }
+
+        void HeadlessSurface::add_round_rect(size_t mask, float radius, float left, float top, float width, float height, ssize_t orient)
+        {
+            if ((width <= 0.0f) || (height <= 0.0f))
+                return;
+
+            const float r   = lsp_limit(radius, 0.0f, lsp_min(width, height) * 0.5f);
+            const float right = left + width, bottom = top + height;
+
+            if ((r > 0.0f) && (mask & SURFMASK_LT_CORNER))
+                add_arc(left + r, top + r, r, M_PI, M_PI * 1.5f);
+            else
+                add_point(left, top);
+
+            if ((r > 0.0f) && (mask & SURFMASK_RT_CORNER))
+                add_arc(right - r, top + r, r, M_PI * 1.5f, M_PI * 2.0f);
+            else
+                add_point(right, top);
+
+            if ((r > 0.0f) && (mask & SURFMASK_RB_CORNER))
+                add_arc(right - r, bottom - r, r, 0.0f, M_PI * 0.5f);
+            else
+                add_point(right, bottom);
+
+            if ((r > 0.0f) && (mask & SURFMASK_LB_CORNER))
+                add_arc(left + r, bottom - r, r, M_PI * 0.5f, M_PI);
+            else
+                add_point(left, bottom);
+
+            close_contour(orient);
+        }
+
+        void HeadlessSurface::add_circle(float cx, float cy, float r, ssize_t orient)
+        {
+            if (r <= 0.0f)
+                return;
+            add_arc(cx, cy, r, 0.0f, 2.0f * M_PI);
+            close_contour(orient);
+        }
+
+        void HeadlessSurface::add_segment(float x0, float y0, float x1, float y1, float width)
+        {
+            // The segment is a rectangle with butt caps
+            const float dx  = x1 - x0;
+            const float dy  = y1 - y0;
+            const float len = sqrtf(dx*dx + dy*dy);
+            if ((len <= 0.0f) || (width <= 0.0f))
+                return;
+
+            const float nx  = -dy * width * 0.5f / len;
+            const float ny  = dx * width * 0.5f / len;
+
+            add_point(x0 + nx, y0 + ny);
+            add_point(x1 + nx, y1 + ny);
+            add_point(x1 - nx, y1 - ny);
+            add_point(x0 - nx, y0 - ny);
+            close_contour(1);
+        }
+
+        void HeadlessSurface::add_polyline(const float *x, const float *y, size_t n, float width)
+        {
+            for (size_t i=1; i<n; ++i)
+                add_segment(x[i-1], y[i-1], x[i], y[i], width);
+
+            // Round joins between segments of thick lines
+            if (width > 1.0f)
+            {
+                for (size_t i=1; i+1<n; ++i)
+                    add_circle(x[i], y[i], width * 0.5f, 1);
+            }
+        }
+
+        void HeadlessSurface::add_parametric(point_t *p, float a, float b, float c, float left, float right, float top, float bottom)
+        {
+            // Compute the points of the line a*x + b*y + c = 0 on the borders of the area
+            if (fabsf(a) > fabsf(b))
+            {
+                p[0].x      = -(c + b*top) / a;
+                p[0].y      = top;
+                p[1].x      = -(c + b*bottom) / a;
+                p[1].y      = bottom;
+            }
+            else if (b != 0.0f)
+            {
+                p[0].x      = left;
+                p[0].y      = -(c + a*left) / b;
+                p[1].x      = right;
+                p[1].y      = -(c + a*right) / b;
+            }
+            else
+            {
+                p[0].x      = left;
+                p[0].y      = top;
+                p[1].x      = left;
+                p[1].y      = top;
+            }
+        }
+
+        void HeadlessSurface::fill_span(uint32_t *row, ssize_t y, ssize_t left, ssize_t right, uint32_t color, ws::IGradient *g)
+        {
+            if (g != NULL)
+            {
+                const HeadlessGradient *hg = static_cast<const HeadlessGradient *>(g);
+                const float yc  = y + 0.5f;
+                for (ssize_t x=left; x<right; ++x)
+                    row[x]          = blend_pixel(row[x], hg->color(x + 0.5f, yc));
+            }
+            else if ((color >> 24) == 0xff)
+            {
+                for (ssize_t x=left; x<right; ++x)
+                    row[x]          = color;
+            }
+            else
+            {
+                for (ssize_t x=left; x<right; ++x)
+                    row[x]          = blend_pixel(row[x], color);
+            }
+        }
+
+        void HeadlessSurface::fill_path(uint32_t color, ws::IGradient *g)
+        {
+            lsp_finally {
+                vEdges.clear();
+                vPoints.clear();
+            };
+
+            const size_t n_edges = vEdges.size();
+            if ((vData == NULL) || (n_edges <= 0))
+                return;
+            if ((g == NULL) && ((color >> 24) == 0))
+                return;
+
+            // Compute the range of rows which pixel centers are covered by edges
+            const edge_t *edges = vEdges.uget(0);
+            float ymin = edges[0].y0, ymax = edges[0].y1;
+            for (size_t i=1; i<n_edges; ++i)
+            {
+                ymin            = lsp_min(ymin, edges[i].y0);
+                ymax            = lsp_max(ymax, edges[i].y1);
+            }
+
+            const ssize_t cl    = sClip.nLeft;
+            const ssize_t cr    = sClip.nLeft + sClip.nWidth;
+            const ssize_t t     = lsp_max(ssize_t(ceilf(ymin - 0.5f)), sClip.nTop);
+            const ssize_t b     = lsp_min(ssize_t(ceilf(ymax - 0.5f)), sClip.nTop + sClip.nHeight);
+
+            for (ssize_t y=t; y<b; ++y)
+            {
+                // Find crossings of the scan line with edges
+                const float yc  = y + 0.5f;
+                vCrossings.clear();
+                for (size_t i=0; i<n_edges; ++i)
+                {
+                    const edge_t *e = &edges[i];
+                    if ((yc < e->y0) || (yc >= e->y1))
+                        continue;
+
+                    crossing_t *c   = vCrossings.add();
+                    if (c == NULL)
+                        return;
+                    c->x            = e->x0 + (yc - e->y0) * e->k;
+                    c->dir          = e->dir;
+                }
+
+                const size_t n  = vCrossings.size();
+                if (n < 2)
+                    continue;
+
+                // Sort crossings, their number is small
+                crossing_t *c   = vCrossings.uget(0);
+                for (size_t i=1; i<n; ++i)
+                {
+                    const crossing_t tmp = c[i];
+                    size_t j = i;
+                    for ( ; (j > 0) && (c[j-1].x > tmp.x); --j)
+                        c[j]            = c[j-1];
+                    c[j]            = tmp;
+                }
+
+                // Fill spans with non-zero winding number
+                uint32_t *row   = &vData[y * nCols];
+                ssize_t winding = 0;
+                for (size_t i=0; i+1<n; ++i)
+                {
+                    winding        += c[i].dir;
+                    if (winding == 0)
+                        continue;
+
+                    const ssize_t l = lsp_max(ssize_t(ceilf(c[i].x - 0.5f)), cl);
+                    const ssize_t r = lsp_min(ssize_t(ceilf(c[i+1].x - 0.5f)), cr);
+                    if (l < r)
+                        fill_span(row, y, l, r, color, g);
+                }
+            }
+        }
+
+        void HeadlessSurface::draw_glyphs(const ws::Font &f, uint32_t color, float x, float y, const lsp_wchar_t *text, size_t length)
+        {
+            ws::font_parameters_t fp;
+            ws::text_parameters_t tp;
+            estimate_font(f, &fp);
+            estimate_text(f, &tp, 1);
+
+            // Each visible glyph is drawn as a box between the baseline and the x-height
+            const float advance = tp.XAdvance;
+            const float height  = fp.Ascent * 0.7f;
+            for (size_t i=0; i<length; ++i)
+            {
+                const lsp_wchar_t ch = text[i];
+                if ((ch == ' ') || (ch == '\t') || (ch == '\n') || (ch == '\r'))
+                    continue;
+                fill(color, x + advance * (i + 0.1f), y - height, advance * 0.8f, height);
+            }
+        }
+
+        void HeadlessSurface::draw_glyphs(const ws::Font &f, uint32_t color, float x, float y, const char *text)
+        {
+            LSPString tmp;
+            if (!tmp.set_utf8(text))
+                return;
+            draw_glyphs(f, color, x, y, tmp.characters(), tmp.length());
+        }
+
+        void HeadlessSurface::clear(const Color &color)
+        {
+            clear_rgba(make_pixel(color));
+        }
+
+        void HeadlessSurface::clear_rgb(uint32_t color)
+        {
+            clear_rgba(color | 0xff000000);
+        }
+
+        void HeadlessSurface::clear_rgba(uint32_t color)
+        {
+            if (vData == NULL)
+                return;
+
+            // Clearing replaces the contents of the clipped area
+            const ssize_t r     = sClip.nLeft + sClip.nWidth;
+            const ssize_t b     = sClip.nTop + sClip.nHeight;
+            for (ssize_t y=sClip.nTop; y<b; ++y)
+            {
+                uint32_t *row = &vData[y * nCols];
+                for (ssize_t x=sClip.nLeft; x<r; ++x)
+                    row[x]      = color;
+            }
+        }
+
+        void HeadlessSurface::fill_rect(const Color &color, size_t mask, float radius, float left, float top, float width, float height)
+        {
+            // Rectangles without rounded corners are filled directly
+            if ((radius <= 0.0f) || (!(mask & SURFMASK_ALL_CORNER)))
+            {
+                fill(make_pixel(color), left, top, width, height);
+                return;
+            }
+
+            add_round_rect(mask, radius, left, top, width, height, 1);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_rect(const Color &color, size_t mask, float radius, const ws::rectangle_t *r)
+        {
+            fill_rect(color, mask, radius, r->nLeft, r->nTop, r->nWidth, r->nHeight);
+        }
+
+        void HeadlessSurface::fill_rect(ws::IGradient *g, size_t mask, float radius, float left, float top, float width, float height)
+        {
+            if (g == NULL)
+                return;
+            add_round_rect(mask, radius, left, top, width, height, 1);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::fill_rect(ws::IGradient *g, size_t mask, float radius, const ws::rectangle_t *r)
+        {
+            fill_rect(g, mask, radius, r->nLeft, r->nTop, r->nWidth, r->nHeight);
+        }
+
+        void HeadlessSurface::wire_rect(const Color &color, size_t mask, float radius, float left, float top, float width, float height, float line_width)
+        {
+            // The stroke is the frame between outer and inner outlines of the rectangle
+            const float hw  = line_width * 0.5f;
+            add_round_rect(mask, radius + hw, left - hw, top - hw, width + line_width, height + line_width, 1);
+            add_round_rect(mask, lsp_max(radius - hw, 0.0f), left + hw, top + hw, width - line_width, height - line_width, -1);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::wire_rect(const Color &color, size_t mask, float radius, const ws::rectangle_t *rect, float line_width)
+        {
+            wire_rect(color, mask, radius, rect->nLeft, rect->nTop, rect->nWidth, rect->nHeight, line_width);
+        }
+
+        void HeadlessSurface::wire_rect(ws::IGradient *g, size_t mask, float radius, float left, float top, float width, float height, float line_width)
+        {
+            if (g == NULL)
+                return;
+            const float hw  = line_width * 0.5f;
+            add_round_rect(mask, radius + hw, left - hw, top - hw, width + line_width, height + line_width, 1);
+            add_round_rect(mask, lsp_max(radius - hw, 0.0f), left + hw, top + hw, width - line_width, height - line_width, -1);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::wire_rect(ws::IGradient *g, size_t mask, float radius, const ws::rectangle_t *rect, float line_width)
+        {
+            wire_rect(g, mask, radius, rect->nLeft, rect->nTop, rect->nWidth, rect->nHeight, line_width);
+        }
+
+        void HeadlessSurface::fill_frame(const Color &color, size_t flags, float radius,
+            float fx, float fy, float fw, float fh,
+            float ix, float iy, float iw, float ih)
+        {
+            // The inner rectangle with rounded corners is cut from the outer one
+            add_round_rect(SURFMASK_NONE, 0.0f, fx, fy, fw, fh, 1);
+            add_round_rect(flags, radius, ix, iy, iw, ih, -1);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_frame(const Color &color, size_t flags, float radius, const ws::rectangle_t *out, const ws::rectangle_t *in)
+        {
+            fill_frame(color, flags, radius,
+                out->nLeft, out->nTop, out->nWidth, out->nHeight,
+                in->nLeft, in->nTop, in->nWidth, in->nHeight);
+        }
+
+        void HeadlessSurface::fill_sector(const Color &color, float cx, float cy, float radius, float angle1, float angle2)
+        {
+            add_point(cx, cy);
+            add_arc(cx, cy, radius, angle1, angle2);
+            close_contour(0);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_triangle(ws::IGradient *g, float x0, float y0, float x1, float y1, float x2, float y2)
+        {
+            if (g == NULL)
+                return;
+            add_point(x0, y0);
+            add_point(x1, y1);
+            add_point(x2, y2);
+            close_contour(0);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::fill_triangle(const Color &color, float x0, float y0, float x1, float y1, float x2, float y2)
+        {
+            add_point(x0, y0);
+            add_point(x1, y1);
+            add_point(x2, y2);
+            close_contour(0);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_circle(const Color &color, float x, float y, float r)
+        {
+            add_circle(x, y, r, 1);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_circle(ws::IGradient *g, float x, float y, float r)
+        {
+            if (g == NULL)
+                return;
+            add_circle(x, y, r, 1);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::wire_arc(const Color &color, float x, float y, float r, float a1, float a2, float width)
+        {
+            // The stroke of arc is the area between outer and inner arcs
+            const float hw  = width * 0.5f;
+            add_arc(x, y, r + hw, a1, a2);
+            const size_t last = vPoints.size();
+            add_arc(x, y, lsp_max(r - hw, 0.0f), a1, a2);
+
+            // Reverse the inner arc to build the closed contour
+            point_t *p = vPoints.uget(0);
+            if (p != NULL)
+            {
+                for (size_t i=last, j=vPoints.size() - 1; i < j; ++i, --j)
+                    lsp::swap(p[i], p[j]);
+            }
+
+            close_contour(0);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_poly(const Color &color, const float *x, const float *y, size_t n)
+        {
+            add_polygon(x, y, n, 0);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::fill_poly(ws::IGradient *g, const float *x, const float *y, size_t n)
+        {
+            if (g == NULL)
+                return;
+            add_polygon(x, y, n, 0);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::wire_poly(const Color &color, float width, const float *x, const float *y, size_t n)
+        {
+            add_polyline(x, y, n, width);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::draw_poly(const Color &fill, const Color &wire, float width, const float *x, const float *y, size_t n)
+        {
+            fill_poly(fill, x, y, n);
+            if (width > 0.0f)
+                wire_poly(wire, width, x, y, n);
+        }
+
+        void HeadlessSurface::square_dot(const Color &color, float x, float y, float width)
+        {
+            const float hw  = width * 0.5f;
+            fill(make_pixel(color), x - hw, y - hw, width, width);
+        }
+
+        void HeadlessSurface::square_dot(float x, float y, float width, float r, float g, float b, float a)
+        {
+            const float hw  = width * 0.5f;
+            fill(make_pixel(r, g, b, a), x - hw, y - hw, width, width);
+        }
+
+        void HeadlessSurface::line(const Color &color, float x0, float y0, float x1, float y1, float width)
+        {
+            add_segment(x0, y0, x1, y1, width);
+            fill_path(make_pixel(color), NULL);
+        }
+
+        void HeadlessSurface::line(ws::IGradient *g, float x0, float y0, float x1, float y1, float width)
+        {
+            if (g == NULL)
+                return;
+            add_segment(x0, y0, x1, y1, width);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::parametric_line(const Color &color, float a, float b, float c, float width)
+        {
+            parametric_line(color, a, b, c, 0.0f, nCols, 0.0f, nRows, width);
+        }
+
+        void HeadlessSurface::parametric_line(const Color &color, float a, float b, float c,
+            float left, float right, float top, float bottom, float width)
+        {
+            point_t p[2];
+            add_parametric(p, a, b, c, left, right, top, bottom);
+            line(color, p[0].x, p[0].y, p[1].x, p[1].y, width);
+        }
+
+        void HeadlessSurface::parametric_bar(ws::IGradient *g,
+            float a1, float b1, float c1, float a2, float b2, float c2,
+            float left, float right, float top, float bottom)
+        {
+            if (g == NULL)
+                return;
+
+            point_t p[4];
+            add_parametric(&p[0], a1, b1, c1, left, right, top, bottom);
+            add_parametric(&p[2], a2, b2, c2, left, right, top, bottom);
+
+            add_point(p[0].x, p[0].y);
+            add_point(p[1].x, p[1].y);
+            add_point(p[3].x, p[3].y);
+            add_point(p[2].x, p[2].y);
+            close_contour(0);
+            fill_path(0, g);
+        }
+
+        void HeadlessSurface::out_text(const ws::Font &f, const Color &color, float x, float y, const char *text)
+        {
+            if (text == NULL)
+                return;
+            draw_glyphs(f, make_pixel(color), x, y, text);
+        }
+
+        void HeadlessSurface::out_text(const ws::Font &f, const Color &color, float x, float y, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return;
+            first   = lsp_limit(first, 0, ssize_t(text->length()));
+            last    = lsp_limit(last, first, ssize_t(text->length()));
+            draw_glyphs(f, make_pixel(color), x, y, &text->characters()[first], last - first);
+        }
+
+        void HeadlessSurface::out_text_relative(const ws::Font &f, const Color &color, float x, float y, float dx, float dy, const char *text)
+        {
+            if (text == NULL)
+                return;
+
+            LSPString tmp;
+            if (!tmp.set_utf8(text))
+                return;
+            out_text_relative(f, color, x, y, dx, dy, &tmp, 0, tmp.length());
+        }
+
+        void HeadlessSurface::out_text_relative(const ws::Font &f, const Color &color, float x, float y, float dx, float dy,
+            const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return;
+            first   = lsp_limit(first, 0, ssize_t(text->length()));
+            last    = lsp_limit(last, first, ssize_t(text->length()));
+
+            // Align the text box relative to the point
+            ws::font_parameters_t fp;
+            ws::text_parameters_t tp;
+            estimate_font(f, &fp);
+            estimate_text(f, &tp, last - first);
+
+            const float fx  = x - tp.XBearing + (dx - 1.0f) * tp.Width * 0.5f;
+            const float fy  = y + fp.Ascent - (dy + 1.0f) * fp.Height * 0.5f;
+            draw_glyphs(f, make_pixel(color), fx, fy, &text->characters()[first], last - first);
+        }
+
+        void HeadlessSurface::draw(ws::ISurface *s, float x, float y, float sx, float sy, float a)
+        {
+            if ((s == NULL) || (s->type() != ws::ST_IMAGE))
+                return;
+
+            HeadlessSurface *hs = static_cast<HeadlessSurface *>(s);
+            if (hs == this)
+                return;
+            blit(hs->vData, hs->nCols, hs->nRows, hs->stride(), x, y, sx, sy, a);
+        }
+
+        void HeadlessSurface::draw_rotate(ws::ISurface *s, float x, float y, float sx, float sy, float ra, float a)
+        {
+            if ((vData == NULL) || (s == NULL) || (s->type() != ws::ST_IMAGE) || (sx == 0.0f) || (sy == 0.0f))
+                return;
+
+            HeadlessSurface *hs = static_cast<HeadlessSurface *>(s);
+            if ((hs == this) || (hs->vData == NULL))
+                return;
+            const uint32_t k    = uint32_t(lsp_limit(1.0f - a, 0.0f, 1.0f) * 256.0f);
+            if (k == 0)
+                return;
+
+            // Compute the bounding box of the rotated image
+            const float ca = cosf(ra), sa = sinf(ra);
+            const float w = hs->nCols * sx, h = hs->nRows * sy;
+            const float px[4] = { 0.0f, w * ca, w * ca - h * sa, -h * sa };
+            const float py[4] = { 0.0f, w * sa, w * sa + h * ca, h * ca };
+            float xmin = px[0], xmax = px[0], ymin = py[0], ymax = py[0];
+            for (size_t i=1; i<4; ++i)
+            {
+                xmin        = lsp_min(xmin, px[i]);
+                xmax        = lsp_max(xmax, px[i]);
+                ymin        = lsp_min(ymin, py[i]);
+                ymax        = lsp_max(ymax, py[i]);
+            }
+
+            const ssize_t l = lsp_max(ssize_t(floorf(x + xmin)), sClip.nLeft);
+            const ssize_t t = lsp_max(ssize_t(floorf(y + ymin)), sClip.nTop);
+            const ssize_t r = lsp_min(ssize_t(ceilf(x + xmax)), sClip.nLeft + sClip.nWidth);
+            const ssize_t b = lsp_min(ssize_t(ceilf(y + ymax)), sClip.nTop + sClip.nHeight);
+
+            // Map each destination pixel back to the source using nearest neighbour sampling
+            for (ssize_t dy=t; dy<b; ++dy)
+            {
+                uint32_t *dp        = &vData[dy * nCols];
+                const float ry      = dy + 0.5f - y;
+                for (ssize_t dx=l; dx<r; ++dx)
+                {
+                    const float rx      = dx + 0.5f - x;
+                    const float u       = (rx * ca + ry * sa) / sx;
+                    const float v       = (ry * ca - rx * sa) / sy;
+                    if ((u < 0.0f) || (v < 0.0f) || (u >= hs->nCols) || (v >= hs->nRows))
+                        continue;
+
+                    uint32_t p          = hs->vData[size_t(v) * hs->nCols + size_t(u)];
+                    if (k < 256)
+                        p                   = scale_pixel(p, k);
+                    dp[dx]              = blend_pixel(dp[dx], p);
+                }
+            }
+        }
+
+        void HeadlessSurface::draw_clipped(ws::ISurface *s, float x, float y, float sx, float sy, float sw, float sh, float a)
+        {
+            if ((s == NULL) || (s->type() != ws::ST_IMAGE))
+                return;
+
+            HeadlessSurface *hs = static_cast<HeadlessSurface *>(s);
+            if ((hs == this) || (hs->vData == NULL))
+                return;
+
+            // Limit the source area to the source surface
+            const ssize_t l = lsp_max(ssize_t(sx), 0);
+            const ssize_t t = lsp_max(ssize_t(sy), 0);
+            const ssize_t r = lsp_min(ssize_t(sx + sw), ssize_t(hs->nCols));
+            const ssize_t b = lsp_min(ssize_t(sy + sh), ssize_t(hs->nRows));
+            if ((l >= r) || (t >= b))
+                return;
+
+            blit(&hs->vData[t * hs->nCols + l], r - l, b - t, hs->stride(),
+                x + (l - sx), y + (t - sy), 1.0f, 1.0f, a);
+        }
+
+        void HeadlessSurface::draw_raw(const void *data, size_t width, size_t height, size_t stride,
+            float x, float y, float sx, float sy, float a)
+        {
+            blit(data, width, height, stride, x, y, sx, sy, a);
+        }
+
+        ws::IGradient *HeadlessSurface::linear_gradient(float x0, float y0, float x1, float y1)
+        {
+            return new HeadlessGradient(x0, y0, x1, y1, -1.0f);
+        }
+
+        ws::IGradient *HeadlessSurface::radial_gradient(float cx0, float cy0, float cx1, float cy1, float r)
+        {
+            return new HeadlessGradient(cx0, cy0, cx1, cy1, lsp_max(r, 0.0f));
+        }
+
+        void HeadlessSurface::clip_begin(float x, float y, float w, float h)
+        {
+            if (!vClips.add(&sClip))
+                return;
+
+            // Intersect with the current clipping rectangle
+            ssize_t l   = lsp_max(ssize_t(roundf(x)), sClip.nLeft);
+            ssize_t t   = lsp_max(ssize_t(roundf(y)), sClip.nTop);
+            ssize_t r   = lsp_min(ssize_t(roundf(x + w)), sClip.nLeft + sClip.nWidth);
+            ssize_t b   = lsp_min(ssize_t(roundf(y + h)), sClip.nTop + sClip.nHeight);
+
+            sClip.nLeft     = l;
+            sClip.nTop      = t;
+            sClip.nWidth    = lsp_max(r - l, 0);
+            sClip.nHeight   = lsp_max(b - t, 0);
+        }
+
+        void HeadlessSurface::clip_end()
+        {
+            const size_t n = vClips.size();
+            if (n <= 0)
+                return;
+
+            sClip       = *vClips.uget(n - 1);
+            vClips.remove(n - 1);
+        }
+
+        uint32_t HeadlessSurface::pixel(ssize_t x, ssize_t y) const
+        {
+            if ((vData == NULL) || (x < 0) || (y < 0) || (x >= ssize_t(nCols)) || (y >= ssize_t(nRows)))
+                return 0;
+            return vData[y * nCols + x];
+        }
+
+        void HeadlessSurface::read_pixels(void *dst, size_t stride) const
+        {
+            if (vData == NULL)
+                return;
+
+            uint8_t *dp         = static_cast<uint8_t *>(dst);
+            const size_t row    = nCols * sizeof(uint32_t);
+            for (size_t y=0; y<nRows; ++y, dp += stride)
+                memcpy(dp, &vData[y * nCols], row);
+        }
+
+        size_t HeadlessSurface::glyphs(const char *text)
+        {
+            // Count UTF-8 code points
+            size_t length = 0;
+            for (const uint8_t *p = reinterpret_cast<const uint8_t *>(text); *p != '\0'; ++p)
+                if ((*p & 0xc0) != 0x80)
+                    ++length;
+            return length;
+        }
+
+        void HeadlessSurface::estimate_font(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            const float size    = lsp_max(f.size(), 0.0f);
+            fp->Ascent          = ceilf(size * 0.8f);
+            fp->Descent         = ceilf(size * 0.2f);
+            fp->Height          = fp->Ascent + fp->Descent;
+        }
+
+        void HeadlessSurface::estimate_text(const ws::Font &f, ws::text_parameters_t *tp, size_t length)
+        {
+            const float size    = lsp_max(f.size(), 0.0f);
+            const float advance = ceilf(size * 0.6f);
+
+            tp->XBearing        = 0.0f;
+            tp->YBearing        = -ceilf(size * 0.8f);
+            tp->Width           = advance * length;
+            tp->Height          = ceilf(size * 0.8f) + ceilf(size * 0.2f);
+            tp->XAdvance        = tp->Width;
+            tp->YAdvance        = tp->Height;
+        }
+
+        bool HeadlessSurface::get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            estimate_font(f, fp);
+            return true;
+        }
+
+        bool HeadlessSurface::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text)
+        {
+            if (text == NULL)
+                return false;
+
+            estimate_text(f, tp, glyphs(text));
+            return true;
+        }
+
+        bool HeadlessSurface::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return false;
+
+            first   = lsp_limit(first, 0, ssize_t(text->length()));
+            last    = lsp_limit(last, first, ssize_t(text->length()));
+            estimate_text(f, tp, last - first);
+            return true;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        HeadlessWindow::HeadlessWindow(HeadlessDisplay *dpy, size_t screen):
+            ws::IWindow(dpy, NULL)
+        {
+            pHeadless           = dpy;
+            pSurface            = NULL;
+            nScreen             = screen;
+            bVisible            = false;
+
+            sGeometry.nLeft     = 0;
+            sGeometry.nTop      = 0;
+            sGeometry.nWidth    = 32;
+            sGeometry.nHeight   = 32;
+
+            bzero(&sConstraints, sizeof(sConstraints));
+            sConstraints.nMinWidth  = -1;
+            sConstraints.nMinHeight = -1;
+            sConstraints.nMaxWidth  = -1;
+            sConstraints.nMaxHeight = -1;
+
+            enBorderStyle       = ws::BS_SIZEABLE;
+            enPointer           = ws::MP_DEFAULT;
+            nActions            = ws::WA_ALL;
+        }
+
+        HeadlessWindow::~HeadlessWindow()
+        {
+            destroy();
+        }
+
+        status_t HeadlessWindow::init()
+        {
+            return pHeadless->attach(this);
+        }
+
+        void HeadlessWindow::destroy()
+        {
+            if (pHeadless != NULL)
+            {
+                pHeadless->detach(this);
+                pHeadless       = NULL;
+            }
+            if (pSurface != NULL)
+            {
+                pSurface->destroy();
+                delete pSurface;
+                pSurface        = NULL;
+            }
+            bVisible        = false;
+            pHandler        = NULL;
+        }
+
+        void HeadlessWindow::notify(size_t type)
+        {
+            if (pHeadless == NULL)
+                return;
+
+            ws::event_t ev;
+            ws::init_event(&ev);
+            ev.nType        = type;
+            ev.nLeft        = sGeometry.nLeft;
+            ev.nTop         = sGeometry.nTop;
+            ev.nWidth       = sGeometry.nWidth;
+            ev.nHeight      = sGeometry.nHeight;
+
+            pHeadless->send_event(this, &ev);
+        }
+
+        status_t HeadlessWindow::dispatch(const ws::event_t *ev)
+        {
+            return (pHandler != NULL) ? pHandler->handle_event(ev) : STATUS_OK;
+        }
+
+        status_t HeadlessWindow::update_geometry(const ws::rectangle_t *r)
+        {
+            ws::rectangle_t xr  = *r;
+
+            // Apply size constraints
+            if ((sConstraints.nMaxWidth >= 0) && (xr.nWidth > sConstraints.nMaxWidth))
+                xr.nWidth           = sConstraints.nMaxWidth;
+            if ((sConstraints.nMaxHeight >= 0) && (xr.nHeight > sConstraints.nMaxHeight))
+                xr.nHeight          = sConstraints.nMaxHeight;
+            if ((sConstraints.nMinWidth >= 0) && (xr.nWidth < sConstraints.nMinWidth))
+                xr.nWidth           = sConstraints.nMinWidth;
+            if ((sConstraints.nMinHeight >= 0) && (xr.nHeight < sConstraints.nMinHeight))
+                xr.nHeight          = sConstraints.nMinHeight;
+            xr.nWidth           = lsp_max(xr.nWidth, 1);
+            xr.nHeight          = lsp_max(xr.nHeight, 1);
+
+            if ((xr.nLeft == sGeometry.nLeft) &&
+                (xr.nTop == sGeometry.nTop) &&
+                (xr.nWidth == sGeometry.nWidth) &&
+                (xr.nHeight == sGeometry.nHeight))
+                return STATUS_OK;
+
+            sGeometry           = xr;
+            if (bVisible)
+                notify(ws::UIE_RESIZE);
+
+            return STATUS_OK;
+        }
+
+        ws::ISurface *HeadlessWindow::get_surface()
+        {
+            if (!bVisible)
+                return NULL;
+
+            // Re-create the surface if the size of the window has changed
+            if ((pSurface != NULL) &&
+                ((pSurface->width() != size_t(sGeometry.nWidth)) || (pSurface->height() != size_t(sGeometry.nHeight))))
+            {
+                pSurface->destroy();
+                delete pSurface;
+                pSurface        = NULL;
+            }
+
+            if (pSurface == NULL)
+                pSurface        = new HeadlessSurface(sGeometry.nWidth, sGeometry.nHeight);
+
+            return pSurface;
+        }
+
+        void *HeadlessWindow::handle()
+        {
+            return this;
+        }
+
+        size_t HeadlessWindow::screen()
+        {
+            return nScreen;
+        }
+
+        bool HeadlessWindow::is_visible()
+        {
+            return bVisible;
+        }
+
+        status_t HeadlessWindow::move(ssize_t left, ssize_t top)
+        {
+            ws::rectangle_t r   = sGeometry;
+            r.nLeft             = left;
+            r.nTop              = top;
+            return update_geometry(&r);
+        }
+
+        status_t HeadlessWindow::resize(ssize_t width, ssize_t height)
+        {
+            ws::rectangle_t r   = sGeometry;
+            r.nWidth            = width;
+            r.nHeight           = height;
+            return update_geometry(&r);
+        }
+
+        status_t HeadlessWindow::set_geometry(const ws::rectangle_t *realize)
+        {
+            return (realize != NULL) ? update_geometry(realize) : STATUS_BAD_ARGUMENTS;
+        }
+
+        status_t HeadlessWindow::get_geometry(ws::rectangle_t *realize)
+        {
+            if (realize == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            *realize            = sGeometry;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::get_absolute_geometry(ws::rectangle_t *realize)
+        {
+            return get_geometry(realize);
+        }
+
+        status_t HeadlessWindow::set_size_constraints(const ws::size_limit_t *c)
+        {
+            if (c == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            sConstraints        = *c;
+
+            ws::rectangle_t r   = sGeometry;
+            return update_geometry(&r);
+        }
+
+        status_t HeadlessWindow::get_size_constraints(ws::size_limit_t *c)
+        {
+            if (c == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            *c                  = sConstraints;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::show()
+        {
+            if (bVisible)
+                return STATUS_OK;
+
+            bVisible            = true;
+            notify(ws::UIE_SHOW);
+            notify(ws::UIE_RESIZE);
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::show(ws::IWindow *over)
+        {
+            return show();
+        }
+
+        status_t HeadlessWindow::hide()
+        {
+            if (!bVisible)
+                return STATUS_OK;
+
+            bVisible            = false;
+            notify(ws::UIE_HIDE);
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::set_caption(const char *caption)
+        {
+            if (caption == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            return (sCaption.set_utf8(caption)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        status_t HeadlessWindow::set_caption(const LSPString *caption)
+        {
+            if (caption == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            return (sCaption.set(caption)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        status_t HeadlessWindow::get_caption(LSPString *text)
+        {
+            if (text == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            return (text->set(&sCaption)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        status_t HeadlessWindow::set_border_style(ws::border_style_t style)
+        {
+            enBorderStyle       = style;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::get_border_style(ws::border_style_t *style)
+        {
+            if (style != NULL)
+                *style              = enBorderStyle;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::set_window_actions(size_t actions)
+        {
+            nActions            = actions;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::get_window_actions(size_t *actions)
+        {
+            if (actions != NULL)
+                *actions            = nActions;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::set_mouse_pointer(ws::mouse_pointer_t pointer)
+        {
+            enPointer           = pointer;
+            return STATUS_OK;
+        }
+
+        ws::mouse_pointer_t HeadlessWindow::get_mouse_pointer()
+        {
+            return enPointer;
+        }
+
+        status_t HeadlessWindow::take_focus()
+        {
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::grab_events(ws::grab_t group)
+        {
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::ungrab_events()
+        {
+            return STATUS_OK;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
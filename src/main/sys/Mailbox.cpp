@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr uint64_t FREE_INDEX_MASK       = 0xffffffffu;
+        static constexpr uint64_t FREE_COUNTER_STEP     = uint64_t(1) << 32;
+
+        Mailbox::Mailbox(size_t capacity)
+        {
+            sStub.pNext.store(NULL, std::memory_order_relaxed);
+            sStub.nFree.store(0, std::memory_order_relaxed);
+            sStub.pHandler  = NULL;
+            sStub.pRelease  = NULL;
+            sStub.nSize     = 0;
+
+            pHead.store(&sStub, std::memory_order_relaxed);
+            pTail           = &sStub;
+
+            // Preallocate messages and link them into the free list
+            capacity        = lsp_min(capacity, size_t(FREE_INDEX_MASK));
+            vMessages       = (capacity > 0) ? new message_t[capacity] : NULL;
+            nCapacity       = (vMessages != NULL) ? capacity : 0;
+            for (size_t i=0; i<nCapacity; ++i)
+            {
+                message_t *msg  = &vMessages[i];
+                msg->pNext.store(NULL, std::memory_order_relaxed);
+                msg->nFree.store(uint32_t((i + 1 < nCapacity) ? i + 2 : 0), std::memory_order_relaxed);
+                msg->pHandler   = NULL;
+                msg->pRelease   = NULL;
+                msg->nSize      = 0;
+            }
+            nFreeHead.store((nCapacity > 0) ? 1 : 0, std::memory_order_release);
+        }
+
+        Mailbox::~Mailbox()
+        {
+            destroy();
+
+            if (vMessages != NULL)
+            {
+                delete [] vMessages;
+                vMessages       = NULL;
+            }
+            nCapacity       = 0;
+        }
+
+        void Mailbox::destroy()
+        {
+            for (message_t *msg = pop(); msg != NULL; msg = pop())
+            {
+                if (msg->pRelease != NULL)
+                    msg->pRelease((msg->nSize > 0) ? msg->vData : NULL);
+                free_message(msg);
+            }
+        }
+
+        Mailbox::message_t *Mailbox::alloc_message()
+        {
+            // The counter in the upper half of the head prevents from ABA problem
+            // when other producers take and the consumer returns the same message
+            uint64_t head   = nFreeHead.load(std::memory_order_acquire);
+            while (true)
+            {
+                const size_t index  = size_t(head & FREE_INDEX_MASK);
+                if (index == 0)
+                    return NULL;
+
+                message_t *msg      = &vMessages[index - 1];
+                const uint64_t next = (head & ~FREE_INDEX_MASK) + FREE_COUNTER_STEP + msg->nFree.load(std::memory_order_relaxed);
+                if (nFreeHead.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire))
+                    return msg;
+            }
+        }
+
+        void Mailbox::free_message(message_t *msg)
+        {
+            const uint64_t index    = uint64_t(msg - vMessages) + 1;
+            uint64_t head           = nFreeHead.load(std::memory_order_relaxed);
+            uint64_t next;
+            do
+            {
+                msg->nFree.store(uint32_t(head & FREE_INDEX_MASK), std::memory_order_relaxed);
+                next                    = (head & ~FREE_INDEX_MASK) + FREE_COUNTER_STEP + index;
+            } while (!nFreeHead.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void Mailbox::push(message_t *msg)
+        {
+            msg->pNext.store(NULL, std::memory_order_relaxed);
+            message_t *prev = pHead.exchange(msg, std::memory_order_acq_rel);
+            prev->pNext.store(msg, std::memory_order_release);
+        }
+
+        Mailbox::message_t *Mailbox::pop()
+        {
+            message_t *tail = pTail;
+            message_t *next = tail->pNext.load(std::memory_order_acquire);
+
+            // Skip the stub message
+            if (tail == &sStub)
+            {
+                if (next == NULL)
+                    return NULL;
+                pTail           = next;
+                tail            = next;
+                next            = next->pNext.load(std::memory_order_acquire);
+            }
+
+            if (next != NULL)
+            {
+                pTail           = next;
+                return tail;
+            }
+
+            // The producer is in the middle of posting, the message will be processed later
+            if (tail != pHead.load(std::memory_order_acquire))
+                return NULL;
+
+            // Tail is the last message, put the stub after it to detach it
+            push(&sStub);
+            next            = tail->pNext.load(std::memory_order_acquire);
+            if (next == NULL)
+                return NULL;
+
+            pTail           = next;
+            return tail;
+        }
+
+        status_t Mailbox::post(update_handler_t handler, const void *data, size_t size, release_handler_t release)
+        {
+            if ((handler == NULL) || ((data == NULL) && (size > 0)))
+                return STATUS_BAD_ARGUMENTS;
+            if (size > MAX_DATA_SIZE)
+                return STATUS_TOO_BIG;
+
+            message_t *msg  = alloc_message();
+            if (msg == NULL)
+                return STATUS_OVERFLOW;
+
+            msg->pHandler   = handler;
+            msg->pRelease   = release;
+            msg->nSize      = size;
+            if (size > 0)
+                ::memcpy(msg->vData, data, size);
+
+            push(msg);
+            return STATUS_OK;
+        }
+
+        size_t Mailbox::process(Display *dpy)
+        {
+            size_t count = 0;
+            for (message_t *msg = pop(); msg != NULL; msg = pop())
+            {
+                msg->pHandler(dpy, (msg->nSize > 0) ? msg->vData : NULL);
+                free_message(msg);
+                ++count;
+            }
+
+            return count;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
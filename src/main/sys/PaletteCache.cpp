@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static inline uint32_t float_bits(float v)
+        {
+            uint32_t res;
+            ::memcpy(&res, &v, sizeof(res));
+            return res;
+        }
+
+        PaletteCache::PaletteCache()
+        {
+            clear();
+        }
+
+        PaletteCache::~PaletteCache()
+        {
+        }
+
+        void PaletteCache::clear()
+        {
+            for (size_t i=0; i<CACHE_SIZE; ++i)
+                vEntries[i].bValid  = false;
+            nHits       = 0;
+            nMisses     = 0;
+        }
+
+        size_t PaletteCache::entry_index(const float *src, float k)
+        {
+            uint32_t hash   = float_bits(k) * 0x9e3779b1;
+            for (size_t i=0; i<4; ++i)
+                hash            = (hash ^ float_bits(src[i])) * 0x01000193;
+            return (hash ^ (hash >> 16)) & (CACHE_SIZE - 1);
+        }
+
+        void PaletteCache::scale_lch_luminance(lsp::Color *color, float k)
+        {
+            float src[4];
+            color->get_rgba(src[0], src[1], src[2], src[3]);
+
+            // Check that entry matches
+            entry_t *e      = &vEntries[entry_index(src, k)];
+            if ((e->bValid) &&
+                (e->fBright == k) &&
+                (::memcmp(e->vSrc, src, sizeof(src)) == 0))
+            {
+                ++nHits;
+                color->set_rgba(e->vDst[0], e->vDst[1], e->vDst[2], e->vDst[3]);
+                return;
+            }
+
+            // Compute the new value and replace the entry
+            ++nMisses;
+            color->scale_lch_luminance(k);
+
+            ::memcpy(e->vSrc, src, sizeof(src));
+            e->fBright      = k;
+            color->get_rgba(e->vDst[0], e->vDst[1], e->vDst[2], e->vDst[3]);
+            e->bValid       = true;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
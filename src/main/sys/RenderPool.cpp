@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        RenderPool::RenderPool()
+        {
+            nNext       = 0;
+            nBatch      = 0;
+            nBusy       = 0;
+            nThreads    = 0;
+            nDrawn      = 0;
+            bActive     = false;
+            bOpen       = false;
+            bShutdown   = false;
+        }
+
+        RenderPool::~RenderPool()
+        {
+            destroy();
+        }
+
+        void RenderPool::destroy()
+        {
+            stop_workers();
+            vWidgets.flush();
+            vBatch.flush();
+        }
+
+        void RenderPool::set_threads(size_t threads)
+        {
+            if (nThreads == threads)
+                return;
+
+            // Workers are started again on demand by the next batch
+            stop_workers();
+            nThreads    = threads;
+        }
+
+        status_t RenderPool::add(Widget *widget)
+        {
+            return (vWidgets.add(widget)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        void RenderPool::remove(Widget *widget)
+        {
+            vWidgets.premove(widget);
+        }
+
+        Widget *RenderPool::next_widget()
+        {
+            std::lock_guard<std::mutex> lock(sLock);
+            return (nNext < vBatch.size()) ? vBatch.uget(nNext++) : NULL;
+        }
+
+        void RenderPool::draw_widgets()
+        {
+            for (Widget *w = next_widget(); w != NULL; w = next_widget())
+                w->draw_surface();
+        }
+
+        void RenderPool::start_workers()
+        {
+            while (vWorkers.size() < nThreads)
+            {
+                ipc::Thread *t = new ipc::Thread(worker_proc, this);
+                if (t == NULL)
+                    return;
+                if ((!vWorkers.add(t)) || (t->start() != STATUS_OK))
+                {
+                    vWorkers.premove(t);
+                    delete t;
+                    return;
+                }
+            }
+        }
+
+        void RenderPool::stop_workers()
+        {
+            if (vWorkers.size() <= 0)
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock(sLock);
+                bShutdown   = true;
+            }
+            sWork.notify_all();
+
+            for (size_t i=0, n=vWorkers.size(); i<n; ++i)
+            {
+                ipc::Thread *t = vWorkers.uget(i);
+                t->join();
+                delete t;
+            }
+            vWorkers.flush();
+
+            bShutdown   = false;
+        }
+
+        void RenderPool::run_worker()
+        {
+            std::unique_lock<std::mutex> lock(sLock);
+            size_t batch = nBatch;
+
+            while (true)
+            {
+                // Wait for the next batch
+                sWork.wait(lock, [this, batch] { return (bShutdown) || ((bOpen) && (nBatch != batch)); });
+                if (bShutdown)
+                    return;
+
+                // Join the batch and draw widgets until it becomes empty
+                batch       = nBatch;
+                ++nBusy;
+                lock.unlock();
+                draw_widgets();
+                lock.lock();
+
+                if ((--nBusy) == 0)
+                    sDone.notify_one();
+            }
+        }
+
+        status_t RenderPool::worker_proc(void *arg)
+        {
+            RenderPool *self    = static_cast<RenderPool *>(arg);
+            self->run_worker();
+            return STATUS_OK;
+        }
+
+        size_t RenderPool::execute(Widget *toplevel)
+        {
+            // Collect widgets of the toplevel widget with pending redraw
+            for (size_t i=0, n=vWidgets.size(); i<n; ++i)
+            {
+                Widget *w = vWidgets.uget(i);
+                if ((w->surface_draw_pending()) && (w->toplevel() == toplevel))
+                {
+                    if (!vBatch.add(w))
+                        break;
+                }
+            }
+
+            const size_t count  = vBatch.size();
+            if (count == 0)
+                return 0;
+            lsp_finally {
+                vBatch.clear();
+                bActive     = false;
+            };
+
+            // Wake up workers if there is more than one widget to draw,
+            // the calling thread also participates in drawing
+            bActive     = true;
+            if (count > 1)
+                start_workers();
+
+            {
+                std::lock_guard<std::mutex> lock(sLock);
+                nNext       = 0;
+                ++nBatch;
+                bOpen       = (count > 1) && (vWorkers.size() > 0);
+            }
+            if (bOpen)
+                sWork.notify_all();
+
+            draw_widgets();
+
+            // Close the batch and wait for workers that still draw widgets
+            {
+                std::unique_lock<std::mutex> lock(sLock);
+                bOpen       = false;
+                sDone.wait(lock, [this] { return nBusy == 0; });
+            }
+            nDrawn     += count;
+
+            return count;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -20,8 +20,12 @@
  */
 
 #include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
 
-#define ID_GEN_MASK         0x7fffff
+#define ID_INDEX_BITS       16
+#define ID_INDEX_MASK       ((1 << ID_INDEX_BITS) - 1)
+#define ID_GEN_MASK         0x7fff
+#define EXEC_STACK_ITEMS    8
 
 namespace lsp
 {
@@ -29,7 +33,9 @@ namespace lsp
     {
         Slot::Slot(bool tracking)
         {
-            nID         = 0;
+            nFree       = -1;
+            nRemoved    = 0;
+            nIntercept  = 0;
             bTracking   = tracking;
         }
 
@@ -40,16 +46,16 @@ namespace lsp
 
         inline Slot::item_t *Slot::find_item(handler_id_t id)
         {
-            for (size_t i=0, n=vItems.size(); i<n; ++i)
-            {
-                item_t *ptr = vItems.uget(i);
-                if (ptr->nID == id)
-                    return ptr;
-            }
+            if (id < 0)
+                return NULL;
+
+            handle_t *h = vHandles.get(id & ID_INDEX_MASK);
+            if ((h == NULL) || (h->nPos < 0) || (h->nGen != size_t(id >> ID_INDEX_BITS)))
+                return NULL;
 
-            return NULL;
+            return vItems.uget(h->nPos);
         }
-    
+
         handler_id_t Slot::bind(event_handler_t handler, void *arg, bool enabled)
         {
             return bind(handler, false, arg, enabled);
@@ -60,49 +66,128 @@ namespace lsp
             return bind(handler, true, arg, enabled);
         }
 
+        ssize_t Slot::alloc_handle()
+        {
+            // Take the free handle
+            if (nFree >= 0)
+            {
+                ssize_t idx     = nFree;
+                handle_t *h     = vHandles.uget(idx);
+                nFree           = h->nNext;
+                return idx;
+            }
+
+            // Allocate new handle
+            ssize_t idx     = vHandles.size();
+            if (idx > ID_INDEX_MASK)
+                return -STATUS_OVERFLOW;
+
+            handle_t *h     = vHandles.add();
+            if (h == NULL)
+                return -STATUS_NO_MEM;
+            h->nPos         = -1;
+            h->nNext        = -1;
+            h->nGen         = 0;
+
+            return idx;
+        }
+
         handler_id_t Slot::bind(event_handler_t handler, bool intercept, void *arg, bool enabled)
         {
             // Check data
             if (handler == NULL)
                 return -STATUS_BAD_ARGUMENTS;
 
-            // Now try to allocate new data
+            // Allocate handle
+            ssize_t idx         = alloc_handle();
+            if (idx < 0)
+                return idx;
+            handle_t *h         = vHandles.uget(idx);
+
+            // Initialize item and bind it
             item_t item;
+            size_t mask         = (intercept) ? BIND_DFL | BIND_INTERCEPT : BIND_DFL;
+            item.nID            = handler_id_t((h->nGen << ID_INDEX_BITS) | idx);
+            item.nFlags         = (enabled) ? mask | BIND_ENABLED : mask;
+            item.pHandler       = handler;
+            item.pPtr           = arg;
 
-            // Generate handler identifier
-            do
+            // Now try to allocate new data
+            h->nPos             = vItems.size();
+            if (!vItems.add(&item))
             {
-                item.nID    = nID;
-                nID         = (nID + 1) & ID_GEN_MASK;
-            } while (find_item(item.nID) != NULL);
+                h->nPos             = -1;
+                h->nNext            = nFree;
+                nFree               = idx;
+                return -STATUS_NO_MEM;
+            }
+            if (intercept)
+                ++nIntercept;
 
-            // Initialize item and bind it
-            size_t mask        = (intercept) ? BIND_DFL | BIND_INTERCEPT : BIND_DFL;
-            item.nFlags        = (enabled) ? mask | BIND_ENABLED : mask;
-            item.pHandler      = handler;
-            item.pPtr          = arg;
+            return item.nID;
+        }
 
-            // Now try to allocate new data
-            return (vItems.add(&item)) ? item.nID : -STATUS_NO_MEM;
+        void Slot::release_handle(handler_id_t id)
+        {
+            // The generation is updated to invalidate the identifier
+            ssize_t idx         = id & ID_INDEX_MASK;
+            handle_t *h         = vHandles.uget(idx);
+            h->nPos             = -1;
+            h->nGen             = (h->nGen + 1) & ID_GEN_MASK;
+            h->nNext            = nFree;
+            nFree               = idx;
         }
 
-        status_t Slot::unbind(handler_id_t id)
+        void Slot::remove_item(item_t *item)
         {
-            // Check data
-            if (id < 0)
-                return STATUS_BAD_ARGUMENTS;
+            release_handle(item->nID);
+
+            // Mark item as removed
+            if (item->nFlags & BIND_INTERCEPT)
+                --nIntercept;
+            item->nID           = -1;
+            item->nFlags        = BIND_REMOVED;
+            item->pHandler      = NULL;
+            item->pPtr          = NULL;
+            ++nRemoved;
+
+            // Compact the list when it contains enough removed items
+            if ((nRemoved << 1) >= vItems.size())
+                compact();
+        }
 
+        void Slot::compact()
+        {
+            size_t j = 0;
             for (size_t i=0, n=vItems.size(); i<n; ++i)
             {
-                item_t *ptr = vItems.uget(i);
-                if (ptr->nID == id)
+                item_t *ptr     = vItems.uget(i);
+                if (ptr->nFlags & BIND_REMOVED)
+                    continue;
+                if (i != j)
                 {
-                    vItems.remove(i);
-                    return STATUS_OK;
+                    *(vItems.uget(j))   = *ptr;
+                    vHandles.uget(ptr->nID & ID_INDEX_MASK)->nPos = j;
                 }
+                ++j;
             }
 
-            return -STATUS_NOT_FOUND;
+            vItems.truncate(j);
+            nRemoved        = 0;
+        }
+
+        status_t Slot::unbind(handler_id_t id)
+        {
+            // Check data
+            if (id < 0)
+                return STATUS_BAD_ARGUMENTS;
+
+            item_t *ptr     = find_item(id);
+            if (ptr == NULL)
+                return -STATUS_NOT_FOUND;
+
+            remove_item(ptr);
+            return STATUS_OK;
         }
 
         handler_id_t Slot::unbind(event_handler_t handler, void *arg)
@@ -117,7 +202,7 @@ namespace lsp
                 if ((ptr->pHandler == handler) && (ptr->pPtr == arg))
                 {
                     handler_id_t id  = ptr->nID;
-                    vItems.remove(i);
+                    remove_item(ptr);
                     return id;
                 }
             }
@@ -127,8 +212,20 @@ namespace lsp
 
         size_t Slot::unbind_all()
         {
-            size_t removed = vItems.size();
+            size_t removed = vItems.size() - nRemoved;
+
+            // Invalidate all handles that are in use
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                item_t *ptr = vItems.uget(i);
+                if (!(ptr->nFlags & BIND_REMOVED))
+                    release_handle(ptr->nID);
+            }
+
             vItems.flush();
+            nRemoved        = 0;
+            nIntercept      = 0;
+
             return removed;
         }
 
@@ -167,7 +264,7 @@ namespace lsp
                 return 0;
 
             size_t disabled         = 0;
-            size_t mask             = (handler && interceptor) ? BIND_ENABLED : BIND_ENABLED | BIND_INTERCEPT;
+            size_t mask             = (handler && interceptor) ? BIND_ENABLED | BIND_REMOVED : BIND_ENABLED | BIND_INTERCEPT | BIND_REMOVED;
             size_t check            = ((!handler) && interceptor) ? BIND_INTERCEPT | BIND_ENABLED : BIND_ENABLED;
 
             for (size_t i=0, n=vItems.size(); i<n; ++i)
@@ -200,7 +297,7 @@ namespace lsp
         size_t Slot::enable_all(bool handler, bool interceptor)
         {
             size_t enabled          = 0;
-            size_t mask             = (handler && interceptor) ? BIND_ENABLED : BIND_ENABLED | BIND_INTERCEPT;
+            size_t mask             = (handler && interceptor) ? BIND_ENABLED | BIND_REMOVED : BIND_ENABLED | BIND_INTERCEPT | BIND_REMOVED;
             size_t check            = ((!handler) && interceptor) ? BIND_INTERCEPT : 0;
 
             for (size_t i=0, n=vItems.size(); i<n; ++i)
@@ -240,35 +337,49 @@ namespace lsp
 
         status_t Slot::execute(Widget *sender, void *data)
         {
-            // Make a copy of handlers first
-            lltl::darray<item_t> copy;
-            if (!copy.set(&vItems))
-                return STATUS_NO_MEM;
+            const size_t n = vItems.size() - nRemoved;
+            if (n <= 0)
+                return STATUS_OK;
+
+            // Make a snapshot of enabled handlers first: interceptors go before handlers.
+            // Small lists are copied to the stack to avoid heap allocation on each event.
+            item_t stack[EXEC_STACK_ITEMS];
+            item_t *list    = stack;
+            if (n > EXEC_STACK_ITEMS)
+            {
+                list            = static_cast<item_t *>(::malloc(n * sizeof(item_t)));
+                if (list == NULL)
+                    return STATUS_NO_MEM;
+            }
+            lsp_finally {
+                if (list != stack)
+                    ::free(list);
+            };
 
-            // First iteration, iterate all interceptors
-            for (size_t i=0, n=copy.size(); i<n; ++i)
+            size_t count = 0;
+            if (nIntercept > 0)
             {
-                // Execute interceptor in the chain
-                item_t *ptr = copy.uget(i);
-                if ((ptr->nFlags & (BIND_ENABLED | BIND_INTERCEPT)) == (BIND_ENABLED | BIND_INTERCEPT))
+                for (size_t i=0, m=vItems.size(); i<m; ++i)
                 {
-                    status_t result      = ptr->pHandler(sender, ptr->pPtr, data);
-                    if (result != STATUS_OK)
-                        return track_result(result);
+                    const item_t *ptr = vItems.uget(i);
+                    if ((ptr->nFlags & (BIND_ENABLED | BIND_INTERCEPT)) == (BIND_ENABLED | BIND_INTERCEPT))
+                        list[count++]   = *ptr;
                 }
             }
-
-            // Second iteration, iterate all handlers
-            for (size_t i=0, n=copy.size(); i<n; ++i)
+            for (size_t i=0, m=vItems.size(); i<m; ++i)
             {
-                // Execute handler in the chain
-                item_t *ptr = copy.uget(i);
+                const item_t *ptr = vItems.uget(i);
                 if ((ptr->nFlags & (BIND_ENABLED | BIND_INTERCEPT)) == BIND_ENABLED)
-                {
-                    status_t result      = ptr->pHandler(sender, ptr->pPtr, data);
-                    if (result != STATUS_OK)
-                        return track_result(result);
-                }
+                    list[count++]   = *ptr;
+            }
+
+            // Execute handlers in the chain
+            for (size_t i=0; i<count; ++i)
+            {
+                const item_t *ptr   = &list[i];
+                status_t result     = ptr->pHandler(sender, ptr->pPtr, data);
+                if (result != STATUS_OK)
+                    return track_result(result);
             }
 
             return STATUS_OK;
@@ -21,17 +21,29 @@
 
 #include <lsp-plug.in/tk/tk.h>
 
+#include <new>
+
 namespace lsp
 {
     namespace tk
     {
         SlotSet::SlotSet()
         {
+            pPool       = NULL;
+            for (size_t i=0; i<SLOT_TOTAL; ++i)
+                vIndex[i]   = 0;
         }
 
         SlotSet::~SlotSet()
         {
             destroy();
+
+            // Release the pool after all slots have been returned to it
+            if (pPool != NULL)
+            {
+                pPool->release();
+                pPool       = NULL;
+            }
         }
 
         void SlotSet::destroy()
@@ -41,106 +53,120 @@ namespace lsp
             {
                 item_t *ptr     = vSlots.uget(i);
                 if (ptr != NULL)
-                    delete ptr;
+                    destroy_item(ptr);
             }
             vSlots.flush();
+
+            for (size_t i=0; i<SLOT_TOTAL; ++i)
+                vIndex[i]   = 0;
         }
 
-        Slot *SlotSet::slot(slot_t id)
+        size_t SlotSet::item_size()
         {
-            ssize_t first   = 0, last = ssize_t(vSlots.size()) - 1;
+            return sizeof(item_t);
+        }
 
-            while (first <= last)
+        status_t SlotSet::set_pool(BlockPool *pool)
+        {
+            if (pool == pPool)
+                return STATUS_OK;
+            if (vSlots.size() > 0)
+                return STATUS_BAD_STATE;
+            if ((pool != NULL) && (pool->block_size() < sizeof(item_t)))
+                return STATUS_BAD_ARGUMENTS;
+
+            if (pPool != NULL)
+                pPool->release();
+            pPool       = (pool != NULL) ? pool->acquire() : NULL;
+            return STATUS_OK;
+        }
+
+        SlotSet::item_t *SlotSet::create_item(slot_t id)
+        {
+            item_t *ptr;
+            if (pPool != NULL)
             {
-                ssize_t idx     = (first + last) >> 1;
-                item_t *ptr     = vSlots.uget(idx);
-                if (ptr->nType == id)
-                    return &ptr->sSlot;
-                else if (ptr->nType < id)
-                    first       = idx + 1;
-                else
-                    last        = idx - 1;
+                void *buf       = pPool->alloc();
+                if (buf == NULL)
+                    return NULL;
+                ptr             = new (buf) item_t;
             }
+            else if ((ptr = new item_t) == NULL)
+                return NULL;
 
-            return NULL;
+            ptr->nType      = id;
+            return ptr;
         }
 
-        Slot *SlotSet::add(slot_t id)
+        void SlotSet::destroy_item(item_t *item)
         {
-            // Find position to insert slot
-            item_t *ptr;
-            ssize_t first   = 0, last = ssize_t(vSlots.size()) - 1, idx = 0;
+            if (pPool != NULL)
+            {
+                item->~item_t();
+                pPool->free(item);
+            }
+            else
+                delete item;
+        }
+
+        SlotSet::item_t *SlotSet::find_item(slot_t id)
+        {
+            // Standard slots are looked up by the index
+            if (size_t(id) < SLOT_TOTAL)
+            {
+                size_t pos      = vIndex[id];
+                return (pos > 0) ? vSlots.uget(pos - 1) : NULL;
+            }
 
-            while (first <= last)
+            for (size_t i=0, n=vSlots.size(); i<n; ++i)
             {
-                idx             = (first + last) >> 1;
-                ptr             = vSlots.uget(idx);
+                item_t *ptr     = vSlots.uget(i);
                 if (ptr->nType == id)
-                    return &ptr->sSlot;
-                else if (ptr->nType < id)
-                    first       = ++idx;
-                else
-                    last        = --idx;
+                    return ptr;
             }
 
+            return NULL;
+        }
+
+        Slot *SlotSet::slot(slot_t id)
+        {
+            item_t *ptr     = find_item(id);
+            return (ptr != NULL) ? &ptr->sSlot : NULL;
+        }
+
+        Slot *SlotSet::add(slot_t id)
+        {
+            item_t *ptr     = find_item(id);
+            if (ptr != NULL)
+                return &ptr->sSlot;
+
             // Now allocate new slot
-            if ((ptr = new item_t) == NULL)
+            const size_t pos    = vSlots.size();
+            if (pos >= 0xffff)
+                return NULL;
+            if ((ptr = create_item(id)) == NULL)
                 return NULL;
-            ptr->nType          = id;
 
-            // Add slot to sorted list
-            if (!vSlots.insert(first, ptr))
+            // Add slot to the list
+            if (!vSlots.add(ptr))
             {
-                delete ptr;
+                destroy_item(ptr);
                 return NULL;
             }
+            if (size_t(id) < SLOT_TOTAL)
+                vIndex[id]      = uint16_t(pos + 1);
 
             return &ptr->sSlot;
         }
-    
+
         handler_id_t SlotSet::add(slot_t id, event_handler_t handler, void *arg, bool enabled)
         {
             // Check data
             if (handler == NULL)
                 return -STATUS_BAD_ARGUMENTS;
 
-            // Find position to insert slot
-            item_t *ptr;
-            ssize_t first   = 0, last = ssize_t(vSlots.size()) - 1, idx = 0;
-
-            while (first <= last)
-            {
-                idx             = (first + last) >> 1;
-                item_t *ptr     = vSlots.uget(idx);
-                if (ptr->nType == id)
-                    return ptr->sSlot.bind(handler, arg, enabled);
-                else if (ptr->nType < id)
-                    first       = ++idx;
-                else
-                    last        = --idx;
-            }
-
-            // Now allocate new slot
-            if ((ptr = new item_t) == NULL)
-                return -STATUS_NO_MEM;
-            ptr->nType          = id;
-
-            // Bind data to slot
-            handler_id_t hid    = ptr->sSlot.bind(handler, arg, enabled);
-            if (hid < 0)
-            {
-                delete ptr;
-                return hid;
-            }
-
-            // Add slot to sorted list
-            if (!vSlots.insert(first, ptr))
-            {
-                delete ptr;
-                return - STATUS_NO_MEM;
-            }
-
-            return hid;
+            Slot *s         = add(id);
+            return (s != NULL) ? s->bind(handler, arg, enabled) : -STATUS_NO_MEM;
         }
 
         bool SlotSet::contains(slot_t id) const
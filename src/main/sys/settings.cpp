@@ -29,12 +29,24 @@ namespace lsp
         {
             resources       = NULL;
             environment     = NULL;
+            glass_cache_size= 0;
+            shared_schema   = false;
+            pooled_slots    = false;
+            headless        = false;
+            render_threads  = 0;
+            style_threads   = 0;
         }
 
         void display_settings_t::construct()
         {
             resources       = NULL;
             environment     = NULL;
+            glass_cache_size= 0;
+            shared_schema   = false;
+            pooled_slots    = false;
+            headless        = false;
+            render_threads  = 0;
+            style_threads   = 0;
         }
     }
 }
@@ -76,6 +76,20 @@ namespace lsp
             sCanvas.nWidth      = 0;
             sCanvas.nHeight     = 0;
 
+            for (size_t i=0; i<2; ++i)
+            {
+                frame_t *f          = &vFrames[i];
+                f->pData            = NULL;
+                f->nWidth           = 0;
+                f->nHeight          = 0;
+                f->nCapacity        = 0;
+                f->bValid           = false;
+            }
+            nFront              = 0;
+            nA3DFlags           = A3D_SCENE_DIRTY;
+            nIdleHandler        = -1;
+            nFrames             = 0;
+
             pClass              = &metadata;
         }
 
@@ -94,19 +108,24 @@ namespace lsp
 
         void Area3D::do_destroy()
         {
+            // Unbind the idle handler
+            if (nIdleHandler >= 0)
+            {
+                Slot *slot = pDisplay->slot(SLOT_IDLE);
+                if (slot != NULL)
+                    slot->unbind(nIdleHandler);
+                nIdleHandler    = -1;
+            }
+
             // Destroy resources
             drop_glass();
             drop_backend();
+            drop_frames();
         }
 
         void Area3D::drop_glass()
         {
-            if (pGlass != NULL)
-            {
-                pGlass->destroy();
-                delete pGlass;
-                pGlass = NULL;
-            }
+            GlassCache::release(&pGlass);
         }
 
         void Area3D::drop_backend()
@@ -119,6 +138,25 @@ namespace lsp
             }
         }
 
+        void Area3D::drop_frames()
+        {
+            for (size_t i=0; i<2; ++i)
+            {
+                frame_t *f          = &vFrames[i];
+                if (f->pData != NULL)
+                {
+                    free(f->pData);
+                    f->pData            = NULL;
+                }
+                f->nWidth           = 0;
+                f->nHeight          = 0;
+                f->nCapacity        = 0;
+                f->bValid           = false;
+            }
+
+            nA3DFlags          |= A3D_SCENE_DIRTY;
+        }
+
         status_t Area3D::init()
         {
             status_t result = Widget::init();
@@ -148,8 +186,34 @@ namespace lsp
 
             if (prop->one_of(sBorder, sBorderRadius))
                 query_resize();
-            if (prop->one_of(sBorderFlat, sGlass, sColor, sBorderColor, sGlassColor))
-                query_draw();
+            if (sColor.is(prop))
+                query_draw3d();
+            if (prop->one_of(sBorderFlat, sGlass, sBorderColor, sGlassColor))
+                Widget::query_draw();
+        }
+
+        void Area3D::query_draw3d()
+        {
+            nA3DFlags      |= A3D_SCENE_DIRTY;
+            Widget::query_draw(REDRAW_SURFACE);
+        }
+
+        void Area3D::query_draw(size_t flags)
+        {
+            // Surface redraw request also invalidates the scene unless it is retained
+            if ((flags & REDRAW_SURFACE) && (!(nA3DFlags & A3D_RETAINED)))
+                nA3DFlags      |= A3D_SCENE_DIRTY;
+            Widget::query_draw(flags);
+        }
+
+        void Area3D::set_deferred_rendering(bool enable)
+        {
+            nA3DFlags       = lsp_setflag(nA3DFlags, A3D_DEFERRED, enable);
+        }
+
+        void Area3D::set_retained(bool enable)
+        {
+            nA3DFlags       = lsp_setflag(nA3DFlags, A3D_RETAINED, enable);
         }
 
         void Area3D::size_request(ws::size_limit_t *r)
@@ -206,18 +270,11 @@ namespace lsp
             Widget::hide_widget();
             drop_glass();
             drop_backend();
+            drop_frames();
         }
 
-        ws::IR3DBackend *Area3D::get_backend()
+        ws::IR3DBackend *Area3D::create_backend()
         {
-            // Check that we have valid backend
-            if ((pBackend != NULL) && (pBackend->valid()))
-                return pBackend;
-
-            // Drop backend and create new one
-            lsp_trace("Creating 3D backend");
-            drop_backend();
-
             // Obtain the necessary information
             ws::IDisplay *dpy = pDisplay->display();
             if (dpy == NULL)
@@ -229,10 +286,24 @@ namespace lsp
             if (native == NULL)
                 return NULL;
 
+            return dpy->create_r3d_backend(native);
+        }
+
+        ws::IR3DBackend *Area3D::get_backend()
+        {
+            // Check that we have valid backend
+            if ((pBackend != NULL) && (pBackend->valid()))
+                return pBackend;
+
+            // Drop backend and create new one
+            lsp_trace("Creating 3D backend");
+            drop_backend();
+
             // Try to create backend
-            pBackend = dpy->create_r3d_backend(native);
+            pBackend = create_backend();
             if (pBackend == NULL)
                 return NULL;
+            nA3DFlags      |= A3D_SCENE_DIRTY;
 
             // Sync display and return
             pDisplay->sync();
@@ -249,12 +320,49 @@ namespace lsp
             return (_this != NULL) ? _this->on_draw3d(static_cast<ws::IR3DBackend *>(data)) : STATUS_BAD_ARGUMENTS;
         }
 
-        void Area3D::draw(ws::ISurface *s, bool force)
+        status_t Area3D::slot_idle(Widget *sender, void *ptr, void *data)
+        {
+            if (ptr == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            Area3D *_this       = widget_ptrcast<Area3D>(ptr);
+            if (_this != NULL)
+                _this->render_back_frame();
+
+            return STATUS_OK;
+        }
+
+        bool Area3D::reserve_frame(frame_t *f, size_t width, size_t height)
+        {
+            const size_t count  = width * height;
+            if (count <= 0)
+                return false;
+
+            // Reallocate buffer only if it does not fit the new frame
+            if (count > f->nCapacity)
+            {
+                uint8_t *buf        = static_cast<uint8_t *>(realloc(f->pData, count * sizeof(uint32_t)));
+                if (buf == NULL)
+                    return false;
+                f->pData            = buf;
+                f->nCapacity        = count;
+            }
+
+            f->nWidth           = width;
+            f->nHeight          = height;
+            f->bValid           = false;
+
+            return true;
+        }
+
+        bool Area3D::render_frame(frame_t *f)
         {
             // Obtain a 3D backend and draw it if it is valid
             ws::IR3DBackend *r3d    = get_backend();
             if ((r3d == NULL) || (!r3d->valid()))
-                return;
+                return false;
+            if (!reserve_frame(f, sCanvas.nWidth, sCanvas.nHeight))
+                return false;
 
             // Update backend color
             r3d::color_t c;
@@ -265,23 +373,85 @@ namespace lsp
             r3d->set_bg_color(&c);
 
             // Perform a draw call
-            size_t count        = sCanvas.nWidth * sCanvas.nHeight;
-            uint8_t *buf        = static_cast<uint8_t *>(malloc(count * sizeof(uint32_t)));
-            if (buf == NULL)
-                return;
-            lsp_finally{ free(buf); };
-
             r3d->locate(sCanvas.nLeft, sCanvas.nTop, sCanvas.nWidth, sCanvas.nHeight);
             pDisplay->sync();
 
             r3d->begin_draw();
                 sSlots.execute(SLOT_DRAW3D, this, r3d);
                 r3d->sync();
-                r3d->read_pixels(buf, r3d::PIXEL_BGRA);
+                r3d->read_pixels(f->pData, r3d::PIXEL_BGRA);
             r3d->end_draw();
 
-            dsp::pbgra32_set_alpha(buf, buf, 0xff, count);
-            s->draw_raw(buf, sCanvas.nWidth, sCanvas.nHeight, sCanvas.nWidth * 4,
+            dsp::pbgra32_set_alpha(f->pData, f->pData, 0xff, f->nWidth * f->nHeight);
+            f->bValid           = true;
+            ++nFrames;
+
+            return true;
+        }
+
+        bool Area3D::schedule_frame()
+        {
+            if (nA3DFlags & A3D_PENDING)
+                return true;
+
+            // Bind the idle handler on the first demand
+            if (nIdleHandler < 0)
+            {
+                Slot *slot      = pDisplay->slot(SLOT_IDLE);
+                if (slot == NULL)
+                    return false;
+                nIdleHandler    = slot->bind(slot_idle, self());
+                if (nIdleHandler < 0)
+                    return false;
+            }
+
+            nA3DFlags      |= A3D_PENDING;
+            return true;
+        }
+
+        void Area3D::render_back_frame()
+        {
+            if (!(nA3DFlags & A3D_PENDING))
+                return;
+            nA3DFlags      &= ~A3D_PENDING;
+
+            if ((!(nA3DFlags & A3D_SCENE_DIRTY)) || (!valid()) || (!(nFlags & VISIBLE)))
+                return;
+
+            // Render the back frame and swap it with the front one
+            frame_t *back   = &vFrames[nFront ^ 1];
+            if (!render_frame(back))
+                return;
+
+            nFront         ^= 1;
+            nA3DFlags      &= ~A3D_SCENE_DIRTY;
+            Widget::query_draw(REDRAW_SURFACE);
+        }
+
+        void Area3D::draw(ws::ISurface *s, bool force)
+        {
+            frame_t *f      = &vFrames[nFront];
+            const bool resized  =
+                (f->nWidth != size_t(sCanvas.nWidth)) ||
+                (f->nHeight != size_t(sCanvas.nHeight));
+            if ((resized) || (!f->bValid))
+                nA3DFlags      |= A3D_SCENE_DIRTY;
+
+            // Render the scene only if it has been changed
+            if (nA3DFlags & A3D_SCENE_DIRTY)
+            {
+                if ((nA3DFlags & A3D_DEFERRED) && (!resized) && (f->bValid) && (schedule_frame()))
+                {
+                    // The new frame will be rendered later, present the last complete frame
+                }
+                else if (render_frame(f))
+                    nA3DFlags      &= ~(A3D_SCENE_DIRTY | A3D_PENDING);
+            }
+
+            if (!f->bValid)
+                return;
+
+            s->draw_raw(f->pData, f->nWidth, f->nHeight, f->nWidth * 4,
                 sCanvas.nLeft, sCanvas.nTop, 1.0f, 1.0f, 0.0f);
         }
 
@@ -305,7 +475,7 @@ namespace lsp
             lsp::Color color(sColor);
             lsp::Color bg_color;
             get_actual_bg_color(bg_color);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             s->clip_begin(area);
             {
@@ -321,14 +491,14 @@ namespace lsp
                 // Draw the glass and the border
                 color.copy(sGlassColor);
                 bg_color.copy(sBorderColor);
-                color.scale_lch_luminance(bright);
-                bg_color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
+                scale_lch_luminance(bg_color, bright);
 
                 bool flat = sBorderFlat.get();
 
                 if (sGlass.get())
                 {
-                    cv = create_border_glass(&pGlass, s,
+                    cv = pDisplay->glass_cache()->border_glass(&pGlass, s,
                             color, bg_color,
                             SURFMASK_ALL_CORNER, bw, xr,
                             sSize.nWidth, sSize.nHeight, flat
@@ -142,6 +142,10 @@ namespace lsp
             sSize.nWidth            = 0;
             sSize.nHeight           = 0;
             pSurface                = NULL;
+
+            BlockPool *pool         = dpy->slot_pool();
+            if (pool != NULL)
+                sSlots.set_pool(pool);
         }
 
         Widget::~Widget()
@@ -251,6 +255,20 @@ namespace lsp
             if (wnd != NULL)
                 wnd->discard_widget(this);
 
+            // Remove from relayout queue
+            if (nFlags & RELAYOUT_PENDING)
+            {
+                pDisplay->cancel_relayout(this);
+                nFlags     &= ~RELAYOUT_PENDING;
+            }
+
+            // Remove from render pool
+            if (nFlags & CONCURRENT_DRAW)
+            {
+                pDisplay->render_pool()->remove(this);
+                nFlags     &= ~CONCURRENT_DRAW;
+            }
+
             // Set parent widget to NULL
             set_parent(NULL);
             sStyle.destroy();
@@ -278,8 +296,16 @@ namespace lsp
             if (sActive.is(prop))
                 query_draw();
 
-            if (prop->one_of(sScaling, sFontScaling, sPadding, sAllocation))
+            if (prop->one_of(sScaling, sFontScaling))
                 query_resize();
+            if (prop->one_of(sPadding, sAllocation))
+            {
+                // These properties affect the layout of the parent widget even if
+                // the size limits of the widget itself did not change
+                if (pParent != NULL)
+                    pParent->query_resize();
+                query_resize();
+            }
 
             if (sVisibility.is(prop))
             {
@@ -310,6 +336,23 @@ namespace lsp
             return result;
         }
 
+        void Widget::memory_usage(w_memory_t *mem) const
+        {
+            const size_t props  = sStyle.properties_memory_usage();
+            mem->nStyle        += sStyle.memory_usage() - props;
+            mem->nProperties   += props;
+            surface_memory_usage(mem, pSurface);
+        }
+
+        void Widget::surface_memory_usage(w_memory_t *mem, ws::ISurface *s)
+        {
+            if (s == NULL)
+                return;
+
+            ++mem->nSurfaces;
+            mem->nSurfaceBytes += s->width() * s->height() * sizeof(uint32_t);
+        }
+
         const style::WidgetColors *Widget::select_colors() const
         {
             const size_t index  = (sActive.get()) ? WIDGET_0 : WIDGET_1;
@@ -322,6 +365,15 @@ namespace lsp
             return colors->sBrightness.get();
         }
 
+        void Widget::scale_lch_luminance(lsp::Color *color, float k) const
+        {
+            // The palette cache is not shared with worker threads
+            if ((pDisplay != NULL) && (!pDisplay->concurrent_draw()))
+                pDisplay->palette_cache()->scale_lch_luminance(color, k);
+            else
+                color->scale_lch_luminance(k);
+        }
+
         bool Widget::is_visible_child_of(const Widget *parent) const
         {
             if (pParent != parent)
@@ -690,6 +742,14 @@ namespace lsp
             // Query for redraw
             query_draw();
 
+            // Widget is already queued for relayout?
+            if (nFlags & RELAYOUT_PENDING)
+                return;
+
+            // Try to confine the relayout to the widget
+            if (query_relayout())
+                return;
+
             // Update flags
             nFlags     |= (RESIZE_PENDING | SIZE_INVALID);
 
@@ -700,6 +760,58 @@ namespace lsp
                 pParent->query_resize();
         }
 
+        bool Widget::query_relayout()
+        {
+            // Only realized widget with valid size limits can act as a layout boundary
+            if ((nFlags & (REALIZED | SIZE_INVALID | RESIZE_PENDING)) != REALIZED)
+                return false;
+            if ((pParent == NULL) || (pParent->nFlags & RESIZE_PENDING) || (!sVisibility.get()))
+                return false;
+
+            // The relayout queue is processed by the window only
+            if (widget_cast<Window>(toplevel()) == NULL)
+                return false;
+            if (pDisplay->queue_relayout(this, &sLimit) != STATUS_OK)
+                return false;
+
+            nFlags     |= (RESIZE_PENDING | SIZE_INVALID | RELAYOUT_PENDING);
+            return true;
+        }
+
+        bool Widget::commit_relayout(const ws::size_limit_t *limit)
+        {
+            nFlags     &= ~RELAYOUT_PENDING;
+            if (!sVisibility.get())
+                return false;
+
+            // Re-measure the widget
+            ws::size_limit_t sl;
+            get_size_limits(&sl);
+
+            if ((sl.nMinWidth != limit->nMinWidth) ||
+                (sl.nMinHeight != limit->nMinHeight) ||
+                (sl.nMaxWidth != limit->nMaxWidth) ||
+                (sl.nMaxHeight != limit->nMaxHeight) ||
+                (sl.nPreWidth != limit->nPreWidth) ||
+                (sl.nPreHeight != limit->nPreHeight))
+            {
+                // Size limits have changed, the parent needs to be resized
+                if (pParent != NULL)
+                    pParent->query_resize();
+                return false;
+            }
+
+            // Size limits did not change, realize the widget within it's current allocation
+            // if it was not already realized by the parent widget
+            if (nFlags & RESIZE_PENDING)
+            {
+                ws::rectangle_t r = sSize;
+                realize_widget(&r);
+            }
+
+            return true;
+        }
+
         void Widget::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Get surface of widget
@@ -726,17 +838,54 @@ namespace lsp
                 return s;
 
             // Redraw surface if required
-            if ((redraw) || (nFlags & (REDRAW_CHILD | REDRAW_SURFACE)))
-            {
-                pSurface->begin();
-                    draw(pSurface, (redraw) || (nFlags & REDRAW_SURFACE));
-                pSurface->end();
-                nFlags         &= ~(REDRAW_CHILD | REDRAW_SURFACE);
-            }
+            if (redraw)
+                nFlags         |= REDRAW_SURFACE;
+            if (nFlags & (REDRAW_CHILD | REDRAW_SURFACE))
+                draw_surface();
 
             return pSurface;
         }
 
+        void Widget::draw_surface()
+        {
+            pSurface->begin();
+                draw(pSurface, nFlags & REDRAW_SURFACE);
+            pSurface->end();
+            nFlags         &= ~(REDRAW_CHILD | REDRAW_SURFACE);
+        }
+
+        bool Widget::surface_draw_pending()
+        {
+            if ((!(nFlags & CONCURRENT_DRAW)) || (pSurface == NULL))
+                return false;
+            if (!(nFlags & (REDRAW_CHILD | REDRAW_SURFACE)))
+                return false;
+            if (draws_text())
+                return false;
+
+            // Widget and all it's parents should be visible
+            for (const Widget *w = this; w != NULL; w = w->pParent)
+                if (!w->sVisibility.get())
+                    return false;
+
+            return true;
+        }
+
+        void Widget::allow_concurrent_draw()
+        {
+            if (nFlags & CONCURRENT_DRAW)
+                return;
+
+            RenderPool *pool    = pDisplay->render_pool();
+            if ((pool != NULL) && (pool->add(this) == STATUS_OK))
+                nFlags             |= CONCURRENT_DRAW;
+        }
+
+        bool Widget::draws_text()
+        {
+            return false;
+        }
+
         void Widget::draw(ws::ISurface *s, bool force)
         {
         }
@@ -772,6 +921,7 @@ namespace lsp
         bool Widget::realize_widget(const ws::rectangle_t *r)
         {
             nFlags     |= REALIZE_ACTIVE;
+            pDisplay->count_realize();
 
             // Call for realize
             const bool need_redraw = realize(r);
@@ -956,7 +1106,7 @@ namespace lsp
             if ((!sBgInherit.get()) || (pParent == NULL))
             {
                 color->copy(colors->sBgColor.color());
-                color->scale_lch_luminance(brightness);
+                scale_lch_luminance(color, brightness);
                 return;
             }
 
@@ -964,12 +1114,12 @@ namespace lsp
             if (pw == NULL)
             {
                 color->copy(colors->sBgColor.color());
-                color->scale_lch_luminance(brightness);
+                scale_lch_luminance(color, brightness);
                 return;
             }
 
             pw->get_child_bg_color(color);
-            color->scale_lch_luminance(brightness);
+            scale_lch_luminance(color, brightness);
         }
 
         void Widget::get_actual_bg_color(lsp::Color &color, float brightness) const
@@ -507,7 +507,7 @@ namespace lsp
             if (a.border > 0)
             {
                 c.copy(colors->sBorderColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->set_antialiasing(true);
                 s->fill_rect(c, SURFMASK_ALL_CORNER, a.radius, 0, 0, sSize.nWidth, sSize.nHeight);
 
@@ -535,7 +535,7 @@ namespace lsp
                 if (a.bgap > 0)
                 {
                     c.copy(colors->sBorderGapColor);
-                    c.scale_lch_luminance(bright);
+                    scale_lch_luminance(c, bright);
                     s->fill_rect(c, SURFMASK_L_CORNER, radius, &ta);
 
                     ta.nLeft       += a.bgap;
@@ -547,7 +547,7 @@ namespace lsp
 
                 // Draw the prime color
                 c.copy(colors->sColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_rect(c, SURFMASK_L_CORNER, radius, &ta);
 
                 // Now reset parameters of ta before rendering the text
@@ -588,7 +588,7 @@ namespace lsp
                 s->clip_begin(&ta);
                 {
                     c.copy(colors->sTextColor);
-                    c.scale_lch_luminance(bright);
+                    scale_lch_luminance(c, bright);
                     sFont.draw(s, c, x, y, fscaling, &text);
                 }
                 s->clip_end();
@@ -604,7 +604,7 @@ namespace lsp
                 if (a.bgap > 0)
                 {
                     c.copy(colors->sBorderGapColor);
-                    c.scale_lch_luminance(bright);
+                    scale_lch_luminance(c, bright);
                     s->fill_rect(c, SURFMASK_R_CORNER, radius, &sa);
 
                     sa.nTop        += a.bgap;
@@ -615,12 +615,12 @@ namespace lsp
 
                 // Draw the prime color
                 c.copy(colors->sSpinColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_rect(c, SURFMASK_R_CORNER, radius, &sa);
 
                 // Draw arrows
                 c.copy(colors->sSpinTextColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_triangle(
                     c,
                     sa.nLeft + sa.nWidth/6.0f, sa.nTop + (sa.nHeight*3.0f)/7.0f,
@@ -642,7 +642,7 @@ namespace lsp
                 if (a.sgap > 0)
                 {
                     c.copy(colors->sBorderGapColor);
-                    c.scale_lch_luminance(bright);
+                    scale_lch_luminance(c, bright);
                     s->fill_rect(c, SURFMASK_NONE, 0.0f, &va);
 
                     va.nLeft       += a.sgap;
@@ -652,7 +652,7 @@ namespace lsp
                 if (va.nWidth > 0)
                 {
                     c.copy(colors->sBorderColor);
-                    c.scale_lch_luminance(bright);
+                    scale_lch_luminance(c, bright);
                     s->fill_rect(c, SURFMASK_NONE, 0.0f, &va);
                 }
             }
@@ -577,7 +577,7 @@ namespace lsp
 
                     // Draw frame
                     color.copy(sColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
 
                     s->set_antialiasing(true);
                     s->wire_rect(color, SURFMASK_ALL_CORNER ^ SURFMASK_LT_CORNER, radius, &sSize, border);
@@ -593,7 +593,7 @@ namespace lsp
 
                     // Draw text background
                     color.copy(sColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
 
                     s->set_antialiasing(true);
                     s->fill_rect(color, SURFMASK_RB_CORNER, ir, &sLabel);
@@ -603,7 +603,7 @@ namespace lsp
                     ws::text_parameters_t tp;
                     ws::font_parameters_t fp;
                     color.copy(sTextColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
 
                     if (it != NULL)
                         it->text()->format(&text);
@@ -624,7 +624,7 @@ namespace lsp
                     if (spin > 0)
                     {
                         color.copy(sSpinColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
 
                         s->fill_triangle(
                             color,
@@ -885,7 +885,7 @@ namespace lsp
                 if (mi->type()->separator())
                 {
                     color.copy(colors->sTextColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &pi->text);
                     continue;
                 }
@@ -894,7 +894,7 @@ namespace lsp
                 if (nSelected == i)
                 {
                     color.copy(colors->sBgSelectedColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &pi->area);
                 }
 
@@ -902,7 +902,7 @@ namespace lsp
                 mi->text()->format(&text);
                 mi->text_adjust()->apply(&text);
                 color.copy((nSelected == i) ? colors->sTextSelectedColor : colors->sTextColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 sFont.draw(s, color, pi->text.nLeft, pi->text.nTop + fp.Ascent, fscaling, &text);
 
                 // Draw shortcut
@@ -935,7 +935,7 @@ namespace lsp
                     if (bw > 0)
                     {
                         color.copy(colors->sCheckBorderColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_rect(color, SURFMASK_ALL_CORNER, br, &r);
                         r.nLeft            += bw;
                         r.nTop             += bw;
@@ -944,7 +944,7 @@ namespace lsp
                         br                  = lsp_max(0, br - bw);
 
                         color.copy(colors->sCheckBgColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_rect(color, SURFMASK_ALL_CORNER, br, &r);
 
                         r.nLeft            += bgap;
@@ -956,14 +956,14 @@ namespace lsp
                         if (mi->checked()->get())
                         {
                             color.copy(colors->sCheckColor);
-                            color.scale_lch_luminance(bright);
+                            scale_lch_luminance(color, bright);
                             s->fill_rect(color, SURFMASK_ALL_CORNER, br, &r);
                         }
                     }
                     else
                     {
                         color.copy((mi->checked()->get()) ? colors->sCheckColor : colors->sCheckBgColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_rect(color, SURFMASK_ALL_CORNER, br, &r);
                     }
                 }
@@ -978,26 +978,26 @@ namespace lsp
                     if (bw > 0)
                     {
                         color.copy(colors->sCheckBorderColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_circle(color, xc, yc, br);
                         br                  = lsp_max(0.0f, br - bw);
 
                         color.copy(colors->sCheckBgColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_circle(color, xc, yc, br);
                         br                  = lsp_max(0, br - bgap);
 
                         if (mi->checked()->get())
                         {
                             color.copy(colors->sCheckColor);
-                            color.scale_lch_luminance(bright);
+                            scale_lch_luminance(color, bright);
                             s->fill_circle(color, xc, yc, br);
                         }
                     }
                     else
                     {
                         color.copy((mi->checked()->get()) ? colors->sCheckColor : colors->sCheckBgColor);
-                        color.scale_lch_luminance(bright);
+                        scale_lch_luminance(color, bright);
                         s->fill_circle(color, xc, yc, br);
                     }
                 }
@@ -1008,14 +1008,14 @@ namespace lsp
             if (sUp.visibility()->get())
             {
                 color.copy((sUp.active())   ? sScrollSelectedColor.color() : sScrollColor.color());
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 sUp.get_rectangle(&xr);
                 s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
             }
             if (sDown.visibility()->get())
             {
                 color.copy((sDown.active()) ? sScrollSelectedColor.color() : sScrollColor.color());
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 sDown.get_rectangle(&xr);
                 s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
             }
@@ -1027,7 +1027,7 @@ namespace lsp
             if (sUp.visibility()->get())
             {
                 color.copy((sUp.active())   ? sScrollTextSelectedColor.color() : sScrollTextColor.color());
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 sUp.get_rectangle(&xr);
 
                 float x = xr.nLeft + xr.nWidth * 0.5f;
@@ -1042,7 +1042,7 @@ namespace lsp
             if (sDown.visibility()->get())
             {
                 color.copy((sDown.active()) ? sScrollTextSelectedColor.color() : sScrollTextColor.color());
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 sDown.get_rectangle(&xr);
 
                 float x = xr.nLeft + xr.nWidth * 0.5f;
@@ -1059,7 +1059,7 @@ namespace lsp
             {
                 s->set_antialiasing(true);
                 color.copy(sBorderColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->wire_rect(
                     color, ws::CORNERS_ALL, border_r,
                     0, 0, sSize.nWidth, sSize.nHeight,
@@ -244,7 +244,7 @@ namespace lsp
                     if (border > 0)
                     {
                         border_color.copy(sBorderColor);
-                        border_color.scale_lch_luminance(bright);
+                        scale_lch_luminance(border_color, bright);
                         Rectangle::enter_border(&xr, &sSize, border);
                         s->fill_frame(border_color, SURFMASK_NONE, 0.0f, &sSize, &xr);
                     }
@@ -295,7 +295,7 @@ namespace lsp
                         if (border > 0)
                         {
                             border_color.copy(sBorderColor);
-                            border_color.scale_lch_luminance(bright);
+                            scale_lch_luminance(border_color, bright);
                             Rectangle::enter_border(&xr, &sSize, border);
                             s->fill_frame(border_color, SURFMASK_NONE, 0.0f, &sSize, &xr);
                         }
@@ -922,5 +922,14 @@ namespace lsp
             Box *_this = widget_ptrcast<Box>(ptr);
             return (_this != NULL) ? _this->on_submit() : STATUS_BAD_ARGUMENTS;
         }
+
+        void Box::memory_usage(w_memory_t *mem) const
+        {
+            WidgetContainer::memory_usage(mem);
+
+            mem->nData         += vVisible.capacity() * sizeof(cell_t);
+            mem->nData         += vItems.size() * sizeof(Widget *);
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
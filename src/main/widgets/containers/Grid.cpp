@@ -64,6 +64,8 @@ namespace lsp
             pClass          = &metadata;
             sAlloc.nRows    = 0;
             sAlloc.nCols    = 0;
+            sAlloc.nTag     = 0;
+            sAlloc.bValid   = false;
         }
         
         Grid::~Grid()
@@ -101,13 +103,18 @@ namespace lsp
             WidgetContainer::destroy();
         }
 
-        Grid::cell_t *Grid::alloc_cell(lltl::parray<cell_t> *list)
+        Grid::cell_t *Grid::alloc_cell(alloc_t *a)
         {
-            cell_t *cell = static_cast<cell_t *>(malloc(sizeof(cell_t)));
+            // Try to reuse previously allocated cell first
+            cell_t *cell = a->vSpare.pop();
             if (cell == NULL)
-                return NULL;
+            {
+                cell = static_cast<cell_t *>(malloc(sizeof(cell_t)));
+                if (cell == NULL)
+                    return NULL;
+            }
 
-            if (!list->add(cell))
+            if (!a->vCells.add(cell))
             {
                 free(cell);
                 return NULL;
@@ -142,13 +149,43 @@ namespace lsp
             free(cell);
         }
 
+        void Grid::release_cells(alloc_t *a)
+        {
+            // Move all cells to the spare list, they will be reused by next allocation
+            for (size_t i=0, n=a->vCells.size(); i<n; ++i)
+            {
+                cell_t *cell    = a->vCells.uget(i);
+                cell->pWidget   = NULL;
+                if (!a->vSpare.add(cell))
+                    free_cell(cell);
+            }
+
+            // Clear the allocation but keep the memory
+            a->vCells.clear();
+            a->vTable.clear();
+            a->vRows.clear();
+            a->vCols.clear();
+            a->nRows        = 0;
+            a->nCols        = 0;
+            a->bValid       = false;
+        }
+
         void Grid::free_cells(alloc_t *alloc)
         {
             for (size_t i=0, n=alloc->vCells.size(); i<n; ++i)
                 free_cell(alloc->vCells.uget(i));
+            for (size_t i=0, n=alloc->vSpare.size(); i<n; ++i)
+                free_cell(alloc->vSpare.uget(i));
 
             alloc->vCells.flush();
             alloc->vTable.flush();
+            alloc->vRows.flush();
+            alloc->vCols.flush();
+            alloc->vSpare.flush();
+            alloc->vDistr.flush();
+            alloc->nRows    = 0;
+            alloc->nCols    = 0;
+            alloc->bValid   = false;
         }
 
         status_t Grid::init()
@@ -171,6 +208,8 @@ namespace lsp
         {
             WidgetContainer::property_changed(prop);
 
+            if (prop->one_of(sRows, sColumns, sHSpacing, sVSpacing, sOrientation, sScaling))
+                sAlloc.bValid   = false;
             if (prop->one_of(sRows, sColumns, sHSpacing, sVSpacing, sOrientation, sConstraints))
                 query_resize();
         }
@@ -182,6 +221,25 @@ namespace lsp
             return !w->pWidget->visibility()->get();
         }
 
+        size_t Grid::widget_state(const widget_t *w)
+        {
+            if (hidden_widget(w))
+                return 0;
+
+            tk::Allocation *alloc = w->pWidget->allocation();
+            size_t state    = S_VISIBLE;
+            if (alloc->hexpand())
+                state          |= S_HEXPAND;
+            if (alloc->vexpand())
+                state          |= S_VEXPAND;
+            if (alloc->hreduce())
+                state          |= S_HREDUCE;
+            if (alloc->vreduce())
+                state          |= S_VREDUCE;
+
+            return state;
+        }
+
         Widget *Grid::find_widget(ssize_t x, ssize_t y)
         {
             for (size_t i=0, n=sAlloc.vCells.size(); i<n; ++i)
@@ -364,6 +422,8 @@ namespace lsp
             item->nTop      = top;
             item->nRows     = rows;
             item->nCols     = cols;
+            item->nState    = 0;
+            sAlloc.bValid   = false;
 
             if (widget != NULL)
                 widget->set_parent(this);
@@ -382,7 +442,7 @@ namespace lsp
                     if (!vItems.remove(i))
                         return STATUS_NO_MEM;
 
-                    free_cells(&sAlloc);
+                    release_cells(&sAlloc);
                     unlink_widget(widget);
                     return STATUS_OK;
                 }
@@ -400,7 +460,7 @@ namespace lsp
                     unlink_widget(cell->pWidget);
             }
 
-            free_cells(&sAlloc);
+            release_cells(&sAlloc);
             vItems.flush();
 
             return STATUS_OK;
@@ -408,59 +468,45 @@ namespace lsp
 
         bool Grid::realize(const ws::rectangle_t *r)
         {
-            free_cells(&sAlloc);
-
 //            lsp_trace("this=%p, size={%d, %d, %d, %d}",
 //                    this, int(r->nLeft), int(r->nTop), int(r->nWidth), int(r->nHeight)
 //                );
 //
-            alloc_t a;
-            status_t res = allocate_cells(&a);
+            status_t res = update_cells(&sAlloc);
             if (res != STATUS_OK)
             {
-                free_cells(&a);
+                release_cells(&sAlloc);
                 return false;
             }
 
             // Distribute the size between rows and columns
-            distribute_size(&a.vCols, 0, a.nCols, r->nWidth);
-            distribute_size(&a.vRows, 0, a.nRows, r->nHeight);
+            distribute_size(&sAlloc.vCols, 0, sAlloc.nCols, r->nWidth, &sAlloc.vDistr);
+            distribute_size(&sAlloc.vRows, 0, sAlloc.nRows, r->nHeight, &sAlloc.vDistr);
 
             // Assign coordinates to cells
-            assign_coords(&a, r);
+            assign_coords(&sAlloc, r);
 
             // Realize widgets
-            bool needs_redraw = realize_children(&a);
-
-            // Swap the actual data
-            sAlloc.vCells.swap(&a.vCells);
-            sAlloc.vTable.swap(&a.vTable);
-            sAlloc.vRows.swap(&a.vRows);
-            sAlloc.vCols.swap(&a.vCols);
-            sAlloc.nRows    = a.nRows;
-            sAlloc.nCols    = a.nCols;
+            bool needs_redraw = realize_children(&sAlloc);
 
             // Call parent method to realize
             if (WidgetContainer::realize(r))
                 needs_redraw = true;
 
-            // Destroy the previously used data
-            free_cells(&a);
-
             return needs_redraw;
         }
 
         void Grid::size_request(ws::size_limit_t *r)
         {
-            alloc_t a;
             float scaling       = lsp_max(0.0f, sScaling.get());
 
-            // Allocate cells
-            allocate_cells(&a);
+            // Update cell allocation
+            if (update_cells(&sAlloc) != STATUS_OK)
+                release_cells(&sAlloc);
 
             // Estimate size
-            r->nMinWidth        = estimate_size(&a.vCols, 0, a.nCols);
-            r->nMinHeight       = estimate_size(&a.vRows, 0, a.nRows);
+            r->nMinWidth        = estimate_size(&sAlloc.vCols, 0, sAlloc.nCols);
+            r->nMinHeight       = estimate_size(&sAlloc.vRows, 0, sAlloc.nRows);
             r->nMaxWidth        = -1;
             r->nMaxHeight       = -1;
             r->nPreWidth        = -1;
@@ -469,9 +515,6 @@ namespace lsp
             // Apply size constraints
             sConstraints.apply(r, scaling);
 
-            free_cells(&a);
-
-
 //            lsp_trace("w={%d, %d}, h={%d, %d}",
 //                    int(r->nMinWidth), int(r->nMaxWidth), int(r->nMinHeight), int(r->nMaxHeight)
 //            );
@@ -496,7 +539,7 @@ namespace lsp
             }
 
             // Allocate cell
-            cell_t *cell = alloc_cell(&a->vCells);
+            cell_t *cell = alloc_cell(a);
             if (cell == NULL)
                 return false;
 
@@ -760,17 +803,19 @@ namespace lsp
             {
                 h               = a->vRows.uget(i);
                 h->nSize        = 0;
+                h->nMinSize     = 0;
                 h->nWeight      = 1;
                 h->nSpacing     = vspacing;
-                h->nFlags       = 0;
+                h->nFlags       = F_DIRTY;
             }
             for (size_t i=0; i<a->nCols; ++i)
             {
                 h               = a->vCols.uget(i);
                 h->nSize        = 0;
+                h->nMinSize     = 0;
                 h->nWeight      = 1;
                 h->nSpacing     = hspacing;
-                h->nFlags       = 0;
+                h->nFlags       = F_DIRTY;
             }
 
             // Remove empty rows and columns
@@ -816,7 +861,7 @@ namespace lsp
                         if (prev == NULL)
                         {
                             // Allocate cell
-                            if ((prev = alloc_cell(&a->vCells)) == NULL)
+                            if ((prev = alloc_cell(a)) == NULL)
                                 return STATUS_NO_MEM;
 
                             prev->pWidget   = NULL;
@@ -913,7 +958,7 @@ namespace lsp
             return res;
         }
 
-        void Grid::distribute_size(lltl::darray<header_t> *vh, size_t first, size_t count, size_t size)
+        void Grid::distribute_size(lltl::darray<header_t> *vh, size_t first, size_t count, size_t size, lltl::parray<header_t> *vl)
         {
             // Check number of elements
             if (count <= 0)
@@ -940,21 +985,21 @@ namespace lsp
             size_t left = size - width;
 
             // Form list of items for size distribution excluding reduced (if possible)
-            lltl::parray<header_t> vl;
+            vl->clear();
             for (size_t k=0; k<count; ++k)
             {
                 header_t *h     = vh->uget(first + k);
                 if (expanded > 0)
                 {
                     if ((!(h->nFlags & F_REDUCE)) && (h->nFlags & F_EXPAND))
-                        vl.add(h);
+                        vl->add(h);
                 }
                 else if (reduced >= count)
-                    vl.add(h);
+                    vl->add(h);
                 else if (!(h->nFlags & F_REDUCE))
-                    vl.add(h);
+                    vl->add(h);
             }
-            count   = vl.size();
+            count   = vl->size();
 
             // Distribute size between selected items
             if (weight > 0)
@@ -963,7 +1008,7 @@ namespace lsp
                 ssize_t total = 0;
                 for (size_t k=0; k<count; ++k)
                 {
-                    header_t *h     = vl.uget(k);
+                    header_t *h     = vl->uget(k);
                     size_t delta    = (h->nSize * h->nWeight * left) / weight;
                     h->nSize       += delta;
                     total          += delta;
@@ -979,7 +1024,7 @@ namespace lsp
                 {
                     for (size_t k=0; k<count; ++k)
                     {
-                        header_t *h     = vl.uget(k);
+                        header_t *h     = vl->uget(k);
                         h->nSize       += delta;
                         left           -= delta;
                     }
@@ -989,39 +1034,87 @@ namespace lsp
             // Distribute the non-distributed size
             for (size_t k=0; left > 0; k = (k+1) % count)
             {
-                header_t *h     = vl.uget(k);
+                header_t *h     = vl->uget(k);
                 h->nSize ++;
                 left --;
             }
         }
 
-        status_t Grid::estimate_sizes(alloc_t *a)
+        void Grid::mark_dirty_headers(alloc_t *a)
         {
-            ws::size_limit_t sr;
             header_t *h;
 
-            // Estimate minimum row/column size for 1xN and Mx1 cells
+            // Mark rows and columns that contain widgets with changed size limits
             for (size_t i=0, n=a->vCells.size(); i<n; ++i)
             {
                 cell_t *w       = a->vCells.uget(i);
-                if ((w->pWidget == NULL) || (!w->pWidget->visibility()->get()))
+                if ((w->pWidget == NULL) || (!w->pWidget->resize_pending()))
                     continue;
-                else if ((w->nRows != 1) && (w->nCols != 1))
+                if ((w->nRows < 1) || (w->nCols < 1)) // The cell has been eliminated
                     continue;
 
-                // Get size limits of the widget
-                w->pWidget->get_padded_size_limits(&sr);
+                if ((w->nRows == 1) && ((h = a->vRows.get(w->nTop)) != NULL))
+                    h->nFlags      |= F_DIRTY;
+                if ((w->nCols == 1) && ((h = a->vCols.get(w->nLeft)) != NULL))
+                    h->nFlags      |= F_DIRTY;
+            }
+        }
+
+        status_t Grid::estimate_sizes(alloc_t *a)
+        {
+            ws::size_limit_t sr;
+            header_t *h;
 
-                if (w->nRows == 1)
+            // Re-estimate minimum size of dirty rows for 1xN cells
+            for (size_t y=0; y < a->nRows; ++y)
+            {
+                h               = a->vRows.uget(y);
+                if (!(h->nFlags & F_DIRTY))
+                    continue;
+
+                h->nMinSize     = 0;
+                for (size_t x=0, off=y*a->nCols; x < a->nCols; ++x, ++off)
                 {
-                    h               = a->vRows.uget(w->nTop);
-                    h->nSize        = lsp_max(h->nSize, sr.nMinHeight);
+                    cell_t *w       = a->vTable.uget(off);
+                    if ((w->pWidget == NULL) || (w->nRows != 1) || (!w->pWidget->visibility()->get()))
+                        continue;
+
+                    w->pWidget->get_padded_size_limits(&sr);
+                    h->nMinSize     = lsp_max(h->nMinSize, sr.nMinHeight);
                 }
-                if (w->nCols == 1)
+                h->nFlags      &= ~F_DIRTY;
+            }
+
+            // Re-estimate minimum size of dirty columns for Mx1 cells
+            for (size_t x=0; x < a->nCols; ++x)
+            {
+                h               = a->vCols.uget(x);
+                if (!(h->nFlags & F_DIRTY))
+                    continue;
+
+                h->nMinSize     = 0;
+                for (size_t y=0, off=x; y < a->nRows; ++y, off += a->nCols)
                 {
-                    h               = a->vCols.uget(w->nLeft);
-                    h->nSize        = lsp_max(h->nSize, sr.nMinWidth);
+                    cell_t *w       = a->vTable.uget(off);
+                    if ((w->pWidget == NULL) || (w->nCols != 1) || (!w->pWidget->visibility()->get()))
+                        continue;
+
+                    w->pWidget->get_padded_size_limits(&sr);
+                    h->nMinSize     = lsp_max(h->nMinSize, sr.nMinWidth);
                 }
+                h->nFlags      &= ~F_DIRTY;
+            }
+
+            // Reset sizes of rows and columns to the cached minimum sizes
+            for (size_t i=0; i < a->nRows; ++i)
+            {
+                h               = a->vRows.uget(i);
+                h->nSize        = h->nMinSize;
+            }
+            for (size_t i=0; i < a->nCols; ++i)
+            {
+                h               = a->vCols.uget(i);
+                h->nSize        = h->nMinSize;
             }
 
             // Estimate minimum row/column size for N x M cells
@@ -1037,10 +1130,10 @@ namespace lsp
                 w->pWidget->get_padded_size_limits(&sr);
 
                 if ((w->nRows > 1) && (sr.nMinHeight > 0))
-                    distribute_size(&a->vRows, w->nTop,  w->nRows, sr.nMinHeight);
+                    distribute_size(&a->vRows, w->nTop,  w->nRows, sr.nMinHeight, &a->vDistr);
 
                 if ((w->nCols > 1) && (sr.nMinWidth > 0))
-                    distribute_size(&a->vCols, w->nLeft, w->nCols, sr.nMinWidth);
+                    distribute_size(&a->vCols, w->nLeft, w->nCols, sr.nMinWidth, &a->vDistr);
             }
 
             return STATUS_OK;
@@ -1048,22 +1141,65 @@ namespace lsp
 
         status_t Grid::allocate_cells(alloc_t *a)
         {
+            // Drop previous allocation and remember the state of widgets
+            release_cells(a);
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                widget_t *w     = vItems.uget(i);
+                w->nState       = widget_state(w);
+            }
+
             // Attach cells
             status_t res    = attach_cells(a);
-            if ((res != STATUS_OK) || (a->nRows < 1) || (a->nCols < 1))
+            if (res != STATUS_OK)
                 return res;
+            if ((a->nRows < 1) || (a->nCols < 1))
+            {
+                a->nRows        = 0;
+                a->nCols        = 0;
+                a->bValid       = true;
+                return STATUS_OK;
+            }
 
             // Estimate row and column parameters
             if ((res = create_row_col_descriptors(a)) != STATUS_OK)
                 return res;
 
-            // Estimate cell sizes
-            if ((res = estimate_sizes(a)) != STATUS_OK)
-                return res;
-
+            a->bValid       = true;
             return STATUS_OK;
         }
 
+        status_t Grid::update_cells(alloc_t *a)
+        {
+            // Check that the state of widgets has not changed since last allocation
+            if (a->bValid)
+            {
+                for (size_t i=0, n=vItems.size(); i<n; ++i)
+                {
+                    widget_t *w     = vItems.uget(i);
+                    if (w->nState != widget_state(w))
+                    {
+                        a->bValid       = false;
+                        break;
+                    }
+                }
+            }
+
+            // Rebuild the structure of cells if it is not valid, otherwise
+            // re-estimate only rows and columns affected by the size change
+            if (!a->bValid)
+            {
+                status_t res    = allocate_cells(a);
+                if (res != STATUS_OK)
+                    return res;
+            }
+            else
+                mark_dirty_headers(a);
+
+            // Estimate cell sizes
+            return estimate_sizes(a);
+        }
+
         void Grid::assign_coords(alloc_t *a, const ws::rectangle_t *r)
         {
             ssize_t y       = r->nTop;
@@ -1154,6 +1290,17 @@ namespace lsp
 
             return needs_redraw;
         }
-    
+
+        void Grid::memory_usage(w_memory_t *mem) const
+        {
+            WidgetContainer::memory_usage(mem);
+
+            mem->nData         += vItems.capacity() * sizeof(widget_t);
+            mem->nData         += (sAlloc.vCells.capacity() + sAlloc.vTable.capacity() + sAlloc.vSpare.capacity()) * sizeof(cell_t *);
+            mem->nData         += (sAlloc.vCells.size() + sAlloc.vSpare.size()) * sizeof(cell_t);
+            mem->nData         += (sAlloc.vRows.capacity() + sAlloc.vCols.capacity()) * sizeof(header_t);
+            mem->nData         += sAlloc.vDistr.capacity() * sizeof(header_t *);
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
@@ -314,7 +314,7 @@ namespace lsp
             }
 
             color->copy(sIBGColor);
-            color->scale_lch_luminance(ibg_bright);
+            scale_lch_luminance(color, ibg_bright);
         }
 
         void Group::get_child_bg_color(lsp::Color &color) const
@@ -410,7 +410,7 @@ namespace lsp
 
                 // Draw frame
                 color.copy(sColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->set_antialiasing(true);
                 s->wire_rect(color, SURFMASK_ALL_CORNER ^ SURFMASK_LT_CORNER, radius, &sSize, border);
@@ -429,7 +429,7 @@ namespace lsp
 
                 // Draw text background
                 color.copy(sColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->set_antialiasing(true);
                 s->fill_rect(color, mask, ir, &sLabel);
@@ -439,7 +439,7 @@ namespace lsp
                 ws::text_parameters_t tp;
                 ws::font_parameters_t fp;
                 color.copy(sTextColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 sText.format(&text);
                 sTextAdjust.apply(&text);
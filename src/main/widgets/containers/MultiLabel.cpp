@@ -232,7 +232,7 @@ namespace lsp
                         // Copy color preferencies
                         const style::LabelColors *lc = l->select_colors(sActive.get(), hover);
                         color.copy(lc->sColor);
-                        color.scale_lch_luminance(select_brightness());
+                        scale_lch_luminance(color, select_brightness());
 
                         float halign    = lsp_limit(l->sTextLayout.halign() + 1.0f, 0.0f, 2.0f);
                         float valign    = lsp_limit(l->sTextLayout.valign() + 1.0f, 0.0f, 2.0f);
@@ -313,7 +313,7 @@ namespace lsp
                         // Copy color preferencies
                         const style::LabelColors *lc = l->select_colors(sActive.get(), hover);
                         color.copy(lc->sColor);
-                        color.scale_lch_luminance(select_brightness());
+                        scale_lch_luminance(color, select_brightness());
 
                         float halign    = lsp_limit(l->sTextLayout.halign() + 1.0f, 0.0f, 2.0f);
                         float valign    = lsp_limit(l->sTextLayout.valign() + 1.0f, 0.0f, 2.0f);
@@ -519,7 +519,7 @@ namespace lsp
 
                 // Draw frame
                 color.copy(sBorderColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->set_antialiasing(true);
                 s->wire_rect(color, surfmask, radius, &sBounds, border);
@@ -544,7 +544,7 @@ namespace lsp
                 lsp_finally { s->clip_end(); };
 
                 color.copy(sHeadingSpacingColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->set_antialiasing(false);
                 s->fill_rect(color, SURFMASK_NO_CORNER, radius, &sHeadSpacing);
             }
@@ -554,7 +554,7 @@ namespace lsp
             {
                 float bright2 = sHeadingGapBrightness.get();
                 color.copy(sHeadingGapColor);
-                color.scale_lch_luminance(bright * bright2);
+                scale_lch_luminance(color, bright * bright2);
 
                 s->clip_begin(area);
                 lsp_finally { s->clip_end(); };
@@ -569,7 +569,7 @@ namespace lsp
                 lsp_finally { s->clip_end(); };
 
                 color.copy(sHeadingColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->set_antialiasing(false);
                 for (size_t i=0; i<2; ++i)
                     if (sHead[i].nWidth > 0)
@@ -624,12 +624,12 @@ namespace lsp
                 {
                     // Draw the tab background
                     color.copy(colors->sColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, mask, tab_radius, &tab->bounds);
 
                     // Draw the tab border
                     color.copy(colors->sBorderColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->wire_rect(color, mask, tab_radius, &tab->bounds, tab->border);
                 }
             }
@@ -643,7 +643,7 @@ namespace lsp
 
                 // Erase the border
                 color.copy(colors->sColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 if (top_align)
                     s->fill_rect(color, SURFMASK_NO_CORNER, 0,
                         tab->bounds.nLeft + tab->border, sBounds.nTop,
@@ -709,7 +709,7 @@ namespace lsp
 
                 // Initialize palette
                 color.copy(colors->sTextColor);
-                color.scale_lch_luminance(select_brightness());
+                scale_lch_luminance(color, select_brightness());
 
                 // Draw background
                 float halign    = lsp_limit(w->text_layout()->halign() + 1.0f, 0.0f, 2.0f);
@@ -407,8 +407,14 @@ namespace lsp
             if ((pWindow == NULL) || (!bMapped))
                 return STATUS_OK;
 
-            if (resize_pending())
+            // Perform relayout of widgets confined to their allocation first,
+            // then the full layout pass if the window still needs to be resized
+            pDisplay->begin_layout();
+            pDisplay->process_relayout(this);
+            const bool full_layout  = resize_pending();
+            if (full_layout)
                 sync_size();
+            pDisplay->end_layout(!full_layout);
 
             update_pointer();
 
@@ -426,6 +432,11 @@ namespace lsp
             if (!s->ready())
                 return STATUS_OK;
 
+            // Draw private surfaces of widgets concurrently, the render pass composites them
+            RenderPool *pool = pDisplay->render_pool();
+            if (pool != NULL)
+                pool->execute(this);
+
 //        #ifdef LSP_TRACE
 //            const system::time_millis_t start = system::get_time_millis();
 //        #endif /* LSP_TRACE */
@@ -617,7 +628,7 @@ namespace lsp
                 float bw = border * 0.5f;
 
                 lsp::Color bc(sBorderColor);
-                bc.scale_lch_luminance(select_brightness());
+                scale_lch_luminance(bc, select_brightness());
 
                 s->wire_rect(
                     bc, SURFMASK_ALL_CORNER, radius,
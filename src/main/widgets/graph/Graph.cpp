@@ -123,12 +123,7 @@ namespace lsp
 
         void Graph::drop_glass()
         {
-            if (pGlass != NULL)
-            {
-                pGlass->destroy();
-                delete pGlass;
-                pGlass = NULL;
-            }
+            GlassCache::release(&pGlass);
         }
 
         status_t Graph::init()
@@ -151,6 +146,8 @@ namespace lsp
             sGlassColor.bind("glass.color", &sStyle);
             sIPadding.bind("ipadding", &sStyle);
 
+            allow_concurrent_draw();
+
             return STATUS_OK;
         }
 
@@ -246,6 +243,18 @@ namespace lsp
             drop_glass();
         }
 
+        bool Graph::draws_text()
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                GraphText *gt = widget_cast<GraphText>(vItems.get(i));
+                if ((gt != NULL) && (gt->visibility()->get()))
+                    return true;
+            }
+
+            return false;
+        }
+
         void Graph::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             if (nFlags & REDRAW_SURFACE)
@@ -262,7 +271,7 @@ namespace lsp
             lsp::Color bg_color;
 
             get_actual_bg_color(bg_color);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             s->clip_begin(area);
             {
@@ -280,14 +289,14 @@ namespace lsp
                 // Draw the glass and the border
                 color.copy(sGlassColor);
                 bg_color.copy(sBorderColor);
-                color.scale_lch_luminance(bright);
-                bg_color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
+                scale_lch_luminance(bg_color, bright);
 
                 bool flat = sBorderFlat.get();
 
                 if (sGlass.get())
                 {
-                    cv = create_border_glass(&pGlass, s,
+                    cv = pDisplay->glass_cache()->border_glass(&pGlass, s,
                             color, bg_color,
                             SURFMASK_ALL_CORNER, bw, xr,
                             sSize.nWidth, sSize.nHeight, flat
@@ -330,7 +339,7 @@ namespace lsp
             // Clear canvas
             lsp::Color c(sColor);
             // c.set_rgb24(0x888888);
-            c.scale_lch_luminance(select_brightness());
+            scale_lch_luminance(c, select_brightness());
             s->clear(c);
 
             // Sync internal lists of axes and origins
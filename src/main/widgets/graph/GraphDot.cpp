@@ -290,7 +290,7 @@ namespace lsp
             {
                 float radius    = fdot + fpad + fborder;
                 lsp::Color gcol((nXFlags & F_HIGHLIGHT) ? sHoverBorderColor : sBorderColor);
-                gcol.scale_lch_luminance(bright);
+                scale_lch_luminance(gcol, bright);
 
                 // Draw border
                 ws::IGradient *gr   = s->radial_gradient(x, y, x, y, radius);
@@ -307,7 +307,7 @@ namespace lsp
                 {
                     s->set_antialiasing(sSmooth.get());
                     lsp::Color hole((nXFlags & F_HIGHLIGHT) ? sHoverGapColor : sGapColor);
-                    hole.scale_lch_luminance(bright);
+                    scale_lch_luminance(hole, bright);
                     s->set_antialiasing(sSmooth.get());
                     s->fill_circle(hole, x, y, fpad + fdot);
                 }
@@ -315,7 +315,7 @@ namespace lsp
 
             // Draw the inner contents
             lsp::Color color((nXFlags & F_HIGHLIGHT) ? sHoverColor : sColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
             s->set_antialiasing(sSmooth.get());
             s->fill_circle(color, x, y, fdot);
             s->set_antialiasing(aa);
@@ -41,6 +41,7 @@ namespace lsp
                 sVScale.bind("vscale", this);
                 sColor.bind("color", this);
                 sFunction.bind("function", this);
+                sPalette.bind("palette", this);
                 // Configure
                 sData.set_size(0, 0);
                 sData.set_range(0.0f, 1.0f, 0.0f);
@@ -52,6 +53,7 @@ namespace lsp
                 sVScale.set(1.0f);
                 sColor.set("#ff0000");
                 sFunction.set(GFF_DEFAULT);
+                sPalette.set(false);
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphFrameBuffer, "GraphFrameBuffer", "root");
         }
@@ -68,7 +70,8 @@ namespace lsp
             sHScale(&sProperties),
             sVScale(&sProperties),
             sColor(&sProperties),
-            sFunction(&sProperties)
+            sFunction(&sProperties),
+            sPalette(&sProperties)
         {
             bClear              = true;
             nRows               = 0;
@@ -79,6 +82,10 @@ namespace lsp
             pfRGBA              = NULL;
             nCapacity           = 0;
             nPixels             = 0;
+            nHead               = 0;
+            vPalette            = NULL;
+            fPalMin             = 0.0f;
+            fPalMax             = 0.0f;
 
             pClass              = &metadata;
         }
@@ -105,6 +112,18 @@ namespace lsp
             vRGBA               = NULL;
             pfRGBA              = NULL;
             nCapacity           = 0;
+            nHead               = 0;
+
+            drop_palette();
+        }
+
+        void GraphFrameBuffer::drop_palette()
+        {
+            if (vPalette != NULL)
+            {
+                free(vPalette);
+                vPalette            = NULL;
+            }
         }
 
         status_t GraphFrameBuffer::init()
@@ -123,6 +142,7 @@ namespace lsp
             sVScale.bind("vscale", &sStyle);
             sColor.bind("color", &sStyle);
             sFunction.bind("function", &sStyle);
+            sPalette.bind("palette", &sStyle);
 
             return STATUS_OK;
         }
@@ -160,6 +180,7 @@ namespace lsp
                 query_draw();
             if (sColor.is(prop))
             {
+                drop_palette();
                 bClear      = true;
                 query_draw();
             }
@@ -178,11 +199,19 @@ namespace lsp
 
                 if (pCalcColor != func)
                 {
+                    drop_palette();
                     pCalcColor  = func;
                     bClear      = true;
                     query_draw();
                 }
             }
+            if (sPalette.is(prop))
+            {
+                if (!sPalette.get())
+                    drop_palette();
+                bClear      = true;
+                query_draw();
+            }
         }
 
         void GraphFrameBuffer::draw(ws::ISurface *s, bool force)
@@ -217,37 +246,107 @@ namespace lsp
             }
 
             // Need to deploy new changes?
-            size_t changes = (bClear) ? nRows : sData.changes();
+            size_t changes = (bClear) ? nRows : lsp_min(sData.changes(), nRows);
             if (changes <= 0)
                 return;
 
-            // Process the pixel data
+            // Prepare palette if it is required
+            bool palette        = (sPalette.get()) && (build_palette());
+
+            // The image is a circular buffer of rows: nHead points to the most recent row,
+            // older rows follow it and wrap around. New rows are placed in front of the head,
+            // so only the changed rows need to be converted
             size_t vstride      = nCols * sizeof(uint32_t);
-            uint8_t *xp         = vRGBA;
-            if (changes < nRows)
-                ::memmove(&xp[vstride * changes], xp, (nRows - changes) * vstride);
+            if (bClear)
+                nHead               = 0;
 
             uint32_t row        = sData.last();
-            for (size_t i=1; i<=changes; ++i, xp += vstride)
+            for (size_t i=1; i<=changes; ++i)
             {
-                const float *p = sData.row(row - i);
+                nHead               = (nHead > 0) ? nHead - 1 : nRows - 1;
+                const float *p      = sData.row(row + i - changes - 1);
                 if (p == NULL)
                     continue;
 
-                (this->*pCalcColor)(fRGBA, p, nCols);
-                dsp::rgba_to_bgra32(xp, fRGBA, nCols);
+                uint8_t *xp         = &vRGBA[nHead * vstride];
+                if (palette)
+                    apply_palette(xp, p, nCols);
+                else
+                {
+                    (this->*pCalcColor)(fRGBA, p, nCols);
+                    dsp::rgba_to_bgra32(xp, fRGBA, nCols);
+                }
             }
 
+            // Draw the image as two slices of the circular buffer
             lsp::Color c(0.0f, 0.0f, 0.0f, 1.0f);
+            size_t tail         = nRows - nHead;
             s->clear(c);
-            s->draw_raw(vRGBA, nCols, nRows, vstride,
+            s->draw_raw(&vRGBA[nHead * vstride], nCols, tail, vstride,
                 0.0f, 0.0f, 1.0f, 1.0f, 0.0f);
+            if (nHead > 0)
+                s->draw_raw(vRGBA, nCols, nHead, vstride,
+                    0.0f, float(tail), 1.0f, 1.0f, 0.0f);
 
             // Commit pending changes
             bClear      = false;
             sData.advance();
         }
 
+        bool GraphFrameBuffer::build_palette()
+        {
+            // The palette covers the whole range of values stored in the frame data
+            const float min     = lsp_min(sData.min(), sData.max());
+            const float max     = lsp_max(sData.min(), sData.max());
+
+            uint32_t *palette   = vPalette;
+            if (palette != NULL)
+            {
+                if ((fPalMin == min) && (fPalMax == max))
+                    return true;
+            }
+            else
+            {
+                palette             = static_cast<uint32_t *>(malloc(PALETTE_SIZE * sizeof(uint32_t)));
+                if (palette == NULL)
+                    return false;
+            }
+
+            // Compute the palette by chunks
+            float v[PALETTE_CHUNK];
+            float rgba[PALETTE_CHUNK * 4];
+            const float k       = (max - min) / (PALETTE_SIZE - 1);
+
+            for (size_t i=0; i<PALETTE_SIZE; i += PALETTE_CHUNK)
+            {
+                for (size_t j=0; j<PALETTE_CHUNK; ++j)
+                    v[j]                = min + (i + j) * k;
+
+                (this->*pCalcColor)(rgba, v, PALETTE_CHUNK);
+                dsp::rgba_to_bgra32(&palette[i], rgba, PALETTE_CHUNK);
+            }
+
+            vPalette            = palette;
+            fPalMin             = min;
+            fPalMax             = max;
+
+            return true;
+        }
+
+        void GraphFrameBuffer::apply_palette(uint8_t *dst, const float *v, size_t n)
+        {
+            uint32_t *xp        = reinterpret_cast<uint32_t *>(dst);
+            const float range   = fPalMax - fPalMin;
+            const float k       = (range > 0.0f) ? (PALETTE_SIZE - 1) / range : 0.0f;
+
+            for (size_t i=0; i<n; ++i)
+            {
+                float x             = (v[i] - fPalMin) * k + 0.5f;
+                ssize_t idx         = (x > 0.0f) ? ssize_t(x) : 0;
+                xp[i]               = vPalette[lsp_min(idx, ssize_t(PALETTE_SIZE - 1))];
+            }
+        }
+
         void GraphFrameBuffer::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Check size
@@ -381,6 +480,17 @@ namespace lsp
             dsp::hsla_to_rgba(rgba, rgba, n);
         }
 
+        void GraphFrameBuffer::memory_usage(w_memory_t *mem) const
+        {
+            GraphItem::memory_usage(mem);
+
+            mem->nData         += sData.memory_usage();
+            if (pfRGBA != NULL)
+                mem->nData         += nCapacity * sizeof(float) * 4 + nPixels * sizeof(uint32_t);
+            if (vPalette != NULL)
+                mem->nData         += PALETTE_SIZE * sizeof(uint32_t);
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
 
@@ -233,9 +233,9 @@ namespace lsp
                 bcol_r.copy(sRBorderColor);
             }
 
-            bcol_l.scale_lch_luminance(brightness);
-            bcol_r.scale_lch_luminance(brightness);
-            color.scale_lch_luminance(brightness);
+            scale_lch_luminance(bcol_l, brightness);
+            scale_lch_luminance(bcol_r, brightness);
+            scale_lch_luminance(color, brightness);
 
             // Get basis
             GraphAxis *basis    = cv->axis(sBasis.get());
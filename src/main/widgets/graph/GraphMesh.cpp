@@ -194,7 +194,8 @@ namespace lsp
             if (cv == NULL)
                 return;
 
-            // Check that data is valid
+            // Take the most recent frame and check that data is valid
+            sData.fetch();
             if ((!sData.valid()) || (sData.size() < 0))
                 return;
 
@@ -209,8 +210,8 @@ namespace lsp
             float width     = (sWidth.get() > 0) ? lsp_max(1.0f, sWidth.get() * scaling) : 0.0f;
             float bright    = select_brightness();
             lsp::Color line(sColor), fill(sFillColor);
-            line.scale_lch_luminance(bright);
-            fill.scale_lch_luminance(bright);
+            scale_lch_luminance(line, bright);
+            scale_lch_luminance(fill, bright);
 
             float cx = 0.0f, cy = 0.0f;
             cv->origin(sOrigin.get(), &cx, &cy);
@@ -335,6 +336,13 @@ namespace lsp
 
             s->set_antialiasing(aa);
         }
+
+        void GraphMesh::memory_usage(w_memory_t *mem) const
+        {
+            GraphItem::memory_usage(mem);
+            mem->nData         += sData.memory_usage();
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
 
@@ -147,7 +147,7 @@ namespace lsp
             float bright    = select_brightness();
 
             lsp::Color font_color(sColor);
-            font_color.scale_lch_luminance(bright);
+            scale_lch_luminance(font_color, bright);
 
             // Get center
             float x = 0.0f, y = 0.0f;
@@ -212,7 +212,7 @@ namespace lsp
             float bright    = select_brightness();
 
             lsp::Color font_color(sColor);
-            font_color.scale_lch_luminance(bright);
+            scale_lch_luminance(font_color, bright);
 
             // Get center
             float x = 0.0f, y = 0.0f;
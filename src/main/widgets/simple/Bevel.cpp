@@ -202,8 +202,8 @@ namespace lsp
 
             lsp::Color col(sColor), bcol(sBorderColor);
             float brightness    = select_brightness();
-            col.scale_lch_luminance(brightness);
-            bcol.scale_lch_luminance(brightness);
+            scale_lch_luminance(col, brightness);
+            scale_lch_luminance(bcol, brightness);
 
             // Find across all corner points the points which lay 'below' the split boundary
             // This can be done by computing the scalar multiplication between normal and a
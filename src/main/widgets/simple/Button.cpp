@@ -500,9 +500,9 @@ namespace lsp
 
             get_actual_bg_color(bg_color);
 
-            color.scale_lch_luminance(brightness);
-            tcolor.scale_lch_luminance(brightness);
-            border_color.scale_lch_luminance(brightness);
+            scale_lch_luminance(color, brightness);
+            scale_lch_luminance(tcolor, brightness);
+            scale_lch_luminance(border_color, brightness);
 
             // Draw background
             bool aa     = s->set_antialiasing(false);
@@ -294,7 +294,7 @@ namespace lsp
             if (border > 0)
             {
                 c.copy(colors->sBorderColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_rect(c, SURFMASK_ALL_CORNER, brad, &xr);
 
                 xr.nLeft           += border;
@@ -310,7 +310,7 @@ namespace lsp
             if (bgap > 0)
             {
                 c.copy(colors->sBorderGapColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_rect(c, SURFMASK_ALL_CORNER, frad, &fr);
 
                 fr.nLeft           += bgap;
@@ -322,7 +322,7 @@ namespace lsp
 
             // Draw fill
             c.copy(colors->sFillColor);
-            c.scale_lch_luminance(bright);
+            scale_lch_luminance(c, bright);
             s->fill_rect(c, SURFMASK_ALL_CORNER, frad, &fr);
 
             // Draw check
@@ -335,7 +335,7 @@ namespace lsp
                 brad                = lsp_max(irad, brad - ckgap);
 
                 c.copy(colors->sColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_rect(c, SURFMASK_ALL_CORNER, brad, &xr);
             }
 
@@ -544,7 +544,7 @@ namespace lsp
             if (border > 0)
             {
                 color.copy(colors->sBorderColor);
-                color.scale_lch_luminance(lightness);
+                scale_lch_luminance(color, lightness);
                 s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
 
                 xr.nLeft       += border;
@@ -557,7 +557,7 @@ namespace lsp
                 if (gap > 0)
                 {
                     color.copy(colors->sBorderGapColor);
-                    color.scale_lch_luminance(lightness);
+                    scale_lch_luminance(color, lightness);
                     s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
 
                     xr.nLeft       += gap;
@@ -570,7 +570,7 @@ namespace lsp
 
             // Draw main background
             color.copy(colors->sColor);
-            color.scale_lch_luminance(lightness);
+            scale_lch_luminance(color, lightness);
             s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
 
             // Draw text
@@ -631,7 +631,7 @@ namespace lsp
             if (use_empty_text)
             {
                 color.copy(colors->sEmptyTextColor);
-                color.scale_lch_luminance(lightness);
+                scale_lch_luminance(color, lightness);
 
                 sFont.draw(s, color, xr.nLeft, xr.nTop + fp.Ascent, fscaling, text);
             }
@@ -644,9 +644,9 @@ namespace lsp
                 lsp::Color scolor(colors->sSelectionColor);
                 lsp::Color stcolor(colors->sTextSelectedColor);
                 color.copy(colors->sTextColor);
-                color.scale_lch_luminance(lightness);
-                scolor.scale_lch_luminance(lightness);
-                stcolor.scale_lch_luminance(lightness);
+                scale_lch_luminance(color, lightness);
+                scale_lch_luminance(scolor, lightness);
+                scale_lch_luminance(stcolor, lightness);
 
                 ssize_t xshift  = (sSelection.reverted() && sCursor.inserting()) ? cursize : 0;
 
@@ -672,7 +672,7 @@ namespace lsp
             else
             {
                 color.copy(colors->sTextColor);
-                color.scale_lch_luminance(lightness);
+                scale_lch_luminance(color, lightness);
 
                 sFont.draw(s, color, xr.nLeft + sTextPos, xr.nTop + fp.Ascent, fscaling, text);
             }
@@ -683,7 +683,7 @@ namespace lsp
             if (sCursor.visible() && sCursor.shining())
             {
                 color.copy(colors->sCursorColor);
-                color.scale_lch_luminance(lightness);
+                scale_lch_luminance(color, lightness);
 
                 if (sCursor.inserting())
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, xr.nLeft, xr.nTop, cursize, xr.nHeight);
@@ -698,7 +698,7 @@ namespace lsp
                     {
                         // Draw background
                         lsp::Color bcolor(colors->sColor);
-                        bcolor.scale_lch_luminance(lightness);
+                        scale_lch_luminance(bcolor, lightness);
 
                         sFont.get_text_parameters(s, &tp, fscaling, text, sCursor.position(), sCursor.position() + 1);
                         ssize_t xw = (tp.XAdvance > tp.Width) ? tp.XAdvance : tp.Width + 1;
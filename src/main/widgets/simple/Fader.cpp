@@ -580,9 +580,9 @@ namespace lsp
             }
 
             get_actual_bg_color(bg_color);
-            button.scale_lch_luminance(bright);
-            scol.scale_lch_luminance(bright);
-            sdcol.scale_lch_luminance(bright);
+            scale_lch_luminance(button, bright);
+            scale_lch_luminance(scol, bright);
+            scale_lch_luminance(sdcol, bright);
 
             // Clear surface
             s->clear(bg_color);
@@ -602,7 +602,7 @@ namespace lsp
                     // Compute button
                     float l = float(schamfer - i) / schamfer;
                     sborder.lightness(l);
-                    sborder.scale_lch_luminance(bright);
+                    scale_lch_luminance(sborder, bright);
 
                     g = s->radial_gradient(0, sSize.nHeight, scaling, sSize.nHeight, delta);
                     g->set_start(sborder);
@@ -620,7 +620,7 @@ namespace lsp
             else
             {
                 // Just draw simple border
-                sborder.scale_lch_luminance(bright);
+                scale_lch_luminance(sborder, bright);
                 s->fill_rect(sborder, SURFMASK_ALL_CORNER, sradius, &h);
                 sradius         = lsp_max(0, sradius - schamfer);
                 h.nLeft        += schamfer;
@@ -707,7 +707,7 @@ namespace lsp
             else
             {
                 // Just draw simple border
-                bborder.scale_lch_luminance(bright);
+                scale_lch_luminance(bborder, bright);
                 s->fill_rect(bborder, SURFMASK_ALL_CORNER, bradius, &h);
                 bradius         = lsp_max(0, bradius - bchamfer);
                 h.nLeft        += bchamfer;
@@ -150,6 +150,7 @@ namespace lsp
             c->sBorderColor.bind("inactive.border.hover.color", &sStyle);
 
             sBitmap.bind("bitmap", &sStyle);
+            sBitmap.set_cache(pDisplay->bitmap_cache());
             sConstraints.bind("size.constraints", &sStyle);
             sLayout.bind("layout", &sStyle);
             sFitting.bind("fitting", &sStyle);
@@ -271,7 +272,7 @@ namespace lsp
 
             style::ImageColors * const colors = select_colors();
             c.copy(colors->sColor);
-            c.scale_lch_luminance(bright);
+            scale_lch_luminance(c, bright);
 
             ws::rectangle_t a_in = sArea, a_out = sBorder;
 
@@ -346,15 +347,31 @@ namespace lsp
                 img.nLeft      += floorf((a_in.nWidth -  img.nWidth ) * (halign + 1.0f) * 0.5f);
                 img.nTop       += floorf((a_in.nHeight - img.nHeight) * (valign + 1.0f) * 0.5f);
 
+                // Use pre-scaled bitmap if possible to perform 1:1 drawing
+                const mm::Bitmap *bmp   = sBitmap.bitmap();
+                float sx                = float(img.nWidth) / (bmp->width() * scaling);
+                float sy                = float(img.nHeight) / (bmp->height() * scaling);
+                const ssize_t sw        = roundf(bmp->width() * sx);
+                const ssize_t sh        = roundf(bmp->height() * sy);
+                if ((sw > 0) && (sh > 0) && ((size_t(sw) != bmp->width()) || (size_t(sh) != bmp->height())))
+                {
+                    const mm::Bitmap *sbmp  = sBitmap.scaled(sw, sh);
+                    if (sbmp != NULL)
+                    {
+                        bmp                     = sbmp;
+                        sx                      = 1.0f;
+                        sy                      = 1.0f;
+                    }
+                }
+
                 // Draw clipped image
                 s->fill_rect(c, SURFMASK_NO_CORNER, 0.0f, &a_in);
                 s->clip_begin(&a_in);
                 lsp_finally { s->clip_end(); };
                 s->draw_raw(
-                    sBitmap.data(), sBitmap.width(), sBitmap.height(), sBitmap.stride(),
+                    bmp->data(), bmp->width(), bmp->height(), bmp->stride(),
                     img.nLeft, img.nTop,
-                    float(img.nWidth) / (sBitmap.width() * scaling),
-                    float(img.nHeight) / (sBitmap.height() * scaling),
+                    sx, sy,
                     sTransparency.get());
             }
             else
@@ -365,7 +382,7 @@ namespace lsp
             if (border_size > 0)
             {
                 c.copy(colors->sBorderColor.color());
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_frame(c, SURFMASK_NO_CORNER, 0.0f, &a_out, &a_in);
             }
         }
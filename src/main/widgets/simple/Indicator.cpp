@@ -575,9 +575,9 @@ namespace lsp
             lsp::Color off(colors->sTextColor);
 
             off.blend(color, 0.05f);
-            on.scale_lch_luminance(bright);
-            off.scale_lch_luminance(bright);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(on, bright);
+            scale_lch_luminance(off, bright);
+            scale_lch_luminance(color, bright);
 
             // Draw glass
             s->clear(color);
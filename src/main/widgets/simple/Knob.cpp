@@ -532,9 +532,9 @@ namespace lsp
             lsp::Color bg_color;
 
             get_actual_bg_color(bg_color);
-            hcol.scale_lch_luminance(bright);
-            scol.scale_lch_luminance(bright);
-            sdcol.scale_lch_luminance(bright);
+            scale_lch_luminance(hcol, bright);
+            scale_lch_luminance(scol, bright);
+            scale_lch_luminance(sdcol, bright);
 
             // Draw background
             s->clear(bg_color);
@@ -587,7 +587,7 @@ namespace lsp
                     if (sBalanceTipColorCustom.get())
                     {
                         scol.copy(colors->sBalanceTipColor);
-                        scol.scale_lch_luminance(bright);
+                        scale_lch_luminance(scol, bright);
                     }
 
                     float tdelta = btsz / (xr - scale * 0.5f);
@@ -642,8 +642,8 @@ namespace lsp
             {
                 lsp::Color cap(colors->sColor);
                 lsp::Color tip(colors->sTipColor);
-                cap.scale_lch_luminance(bright);
-                tip.scale_lch_luminance(bright);
+                scale_lch_luminance(cap, bright);
+                scale_lch_luminance(tip, bright);
 
                 // Draw cap
                 s->fill_circle(cap, c_x, c_y, xr);
@@ -677,7 +677,7 @@ namespace lsp
                     // Draw tip
                     scol.copy(tip);
                     scol.blend(hcol, xb);
-                    scol.scale_lch_luminance(bright);
+                    scale_lch_luminance(scol, bright);
                     s->line(scol,
                         c_x + (xr * 0.25f) * f_cos, c_y + (xr * 0.25f) * f_sin,
                         c_x + xr * f_cos, c_y + xr * f_sin, 3.0f * scaling);
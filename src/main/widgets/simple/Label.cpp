@@ -238,7 +238,7 @@ namespace lsp
             lsp::Color f_color(colors->sColor);
 
             get_actual_bg_color(bg_color);
-            f_color.scale_lch_luminance(select_brightness());
+            scale_lch_luminance(f_color, select_brightness());
 
             // Draw background
             s->clear(bg_color);
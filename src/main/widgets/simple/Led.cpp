@@ -227,7 +227,7 @@ namespace lsp
             lsp::Color border_color((on) ? colors->sLedBorderColor : colors->sBorderColor);
 
             get_actual_bg_color(bg_color);
-            col.scale_lch_luminance(brightness);
+            scale_lch_luminance(col, brightness);
 
             // Draw background
             s->fill_rect(bg_color, SURFMASK_NONE, 0.0f, 0, 0, sSize.nWidth, sSize.nHeight);
@@ -277,7 +277,7 @@ namespace lsp
                 else
                 {
                     lsp::Color c(col);
-                    c.scale_lch_luminance(0.4f);
+                    scale_lch_luminance(c, 0.4f);
 
                     // Draw led glass
                     g = s->radial_gradient(cx, cy, cx, cy, r);
@@ -332,8 +332,8 @@ namespace lsp
 
             get_actual_bg_color(bg_color);
 
-            color.scale_lch_luminance(brightness);
-            border_color.scale_lch_luminance(brightness);
+            scale_lch_luminance(color, brightness);
+            scale_lch_luminance(border_color, brightness);
 
             // Draw background
             bool aa     = s->set_antialiasing(false);
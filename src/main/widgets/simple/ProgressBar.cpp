@@ -337,7 +337,7 @@ namespace lsp
             if (border > 0)
             {
                 lsp::Color bcolor(colors->sBorderColor);
-                bcolor.scale_lch_luminance(bright);
+                scale_lch_luminance(bcolor, bright);
 
                 s->fill_rect(bcolor, SURFMASK_ALL_CORNER, radius, &xr);
                 radius      = lsp_max(0, radius - border);
@@ -350,7 +350,7 @@ namespace lsp
                 if (gap > 0)
                 {
                     bcolor.copy(colors->sBorderGapColor);
-                    bcolor.scale_lch_luminance(bright);
+                    scale_lch_luminance(bcolor, bright);
 
                     s->fill_rect(bcolor, SURFMASK_ALL_CORNER, radius, &xr);
                     radius      = lsp_max(0, radius - gap);
@@ -369,7 +369,7 @@ namespace lsp
             if (split > 0)
             {
                 lsp::Color color(colors->sColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->clip_begin(xr.nLeft, xr.nTop, split, xr.nHeight);
                 s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
@@ -378,7 +378,7 @@ namespace lsp
             if (split < xr.nWidth)
             {
                 lsp::Color color(colors->sInvColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->clip_begin(xr.nLeft + split, xr.nTop, xr.nWidth - split, xr.nHeight);
                 s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
@@ -399,7 +399,7 @@ namespace lsp
                 if (split > 0)
                 {
                     lsp::Color color(colors->sTextColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
 
                     s->clip_begin(xr.nLeft, xr.nTop, split, xr.nHeight);
                     out_text(s, &text, color);
@@ -409,7 +409,7 @@ namespace lsp
                 if (split < sTextArea.nWidth)
                 {
                     lsp::Color color(colors->sInvTextColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
 
                     s->clip_begin(xr.nLeft + split, xr.nTop, xr.nWidth - split, xr.nHeight);
                     out_text(s, &text, color);
@@ -283,7 +283,7 @@ namespace lsp
             if (border > 0)
             {
                 c.copy(colors->sBorderColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_circle(c, cx, cy, r);
                 r                  -= border;
             }
@@ -293,14 +293,14 @@ namespace lsp
             if (bgap > 0)
             {
                 c.copy(colors->sBorderGapColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_circle(c, cx, cy, frad);
                 frad               -= bgap;
             }
 
             // Draw fill
             c.copy(colors->sFillColor);
-            c.scale_lch_luminance(bright);
+            scale_lch_luminance(c, bright);
             s->fill_circle(c, cx, cy, frad);
 
             // Draw check
@@ -308,7 +308,7 @@ namespace lsp
             {
                 r                  -= ckgap;
                 c.copy(colors->sColor);
-                c.scale_lch_luminance(bright);
+                scale_lch_luminance(c, bright);
                 s->fill_circle(c, cx, cy, r);
             }
 
@@ -953,7 +953,7 @@ namespace lsp
             if (border > 0)
             {
                 color.copy(colors->sBorderColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
 
                 s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
                 xr.nLeft       += border;
@@ -967,7 +967,7 @@ namespace lsp
             if (gap > 0)
             {
                 color.copy(colors->sBorderGapColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_ALL_CORNER, radius, &xr);
             }
 
@@ -978,7 +978,7 @@ namespace lsp
                 xr.nLeft       -= sSize.nLeft;
                 xr.nTop        -= sSize.nTop;
                 color.copy((nXFlags & F_BTN_DOWN_ACTIVE) ? colors->sButtonActiveColor : colors->sButtonColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_L_CORNER, radius, &xr);
 
                 color.copy((nXFlags & F_BTN_DOWN_ACTIVE) ? colors->sTextActiveColor : colors->sTextColor);
@@ -993,7 +993,7 @@ namespace lsp
                 xr.nLeft       -= sSize.nLeft;
                 xr.nTop        -= sSize.nTop;
                 color.copy((nXFlags & F_BTN_UP_ACTIVE) ? colors->sButtonActiveColor : colors->sButtonColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_R_CORNER, radius, &xr);
 
                 color.copy((nXFlags & F_BTN_UP_ACTIVE) ? colors->sTextActiveColor : colors->sTextColor);
@@ -1012,7 +1012,7 @@ namespace lsp
                 if (xr.nWidth > 0)
                 {
                     color.copy((nXFlags & F_SPARE_DOWN_ACTIVE) ? colors->sIncActiveColor : colors->sIncColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
                 }
 
@@ -1025,7 +1025,7 @@ namespace lsp
                 if (xr.nWidth > 0)
                 {
                     color.copy((nXFlags & F_SPARE_UP_ACTIVE) ? colors->sDecActiveColor : colors->sDecColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
                 }
             }
@@ -1036,7 +1036,7 @@ namespace lsp
                 xr.nLeft       -= sSize.nLeft;
                 xr.nTop        -= sSize.nTop;
                 color.copy((nXFlags & F_BTN_DOWN_ACTIVE) ? colors->sButtonActiveColor : colors->sButtonColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_T_CORNER, radius, &xr);
 
                 color.copy((nXFlags & F_BTN_DOWN_ACTIVE) ? colors->sTextActiveColor : colors->sTextColor);
@@ -1051,7 +1051,7 @@ namespace lsp
                 xr.nLeft       -= sSize.nLeft;
                 xr.nTop        -= sSize.nTop;
                 color.copy((nXFlags & F_BTN_UP_ACTIVE) ? colors->sButtonActiveColor : colors->sButtonColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_B_CORNER, radius, &xr);
 
                 color.copy((nXFlags & F_BTN_UP_ACTIVE) ? colors->sTextActiveColor : colors->sTextColor);
@@ -1070,7 +1070,7 @@ namespace lsp
                 if (xr.nHeight > 0)
                 {
                     color.copy((nXFlags & F_SPARE_DOWN_ACTIVE) ? colors->sIncActiveColor : colors->sIncColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
                 }
 
@@ -1083,7 +1083,7 @@ namespace lsp
                 if (xr.nHeight > 0)
                 {
                     color.copy((nXFlags & F_SPARE_UP_ACTIVE) ? colors->sDecActiveColor : colors->sDecColor);
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
                 }
             }
@@ -1097,7 +1097,7 @@ namespace lsp
             if (sborder > 0)
             {
                 color.copy(colors->sSliderBorderColor);
-                color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
                 s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
 
                 xr.nLeft       += sborder;
@@ -1107,7 +1107,7 @@ namespace lsp
             }
 
             color.copy((nXFlags & F_SLIDER_ACTIVE) ? colors->sSliderActiveColor : colors->sSliderColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
             s->fill_rect(color, SURFMASK_NONE, 0.0f, &xr);
 
             s->set_antialiasing(aa);
@@ -142,12 +142,43 @@ namespace lsp
             sLoopBorderColor(&sProperties),
             sConstraints(&sProperties)
         {
+            nPeakBlock      = 1;
+            nPeakSamples    = 0;
+            bAppend         = false;
+            pDrawData       = NULL;
+            vDrawBuf        = NULL;
+            nDrawCap        = 0;
+
             pClass          = &metadata;
         }
 
         AudioChannel::~AudioChannel()
         {
             nFlags     |= FINALIZED;
+            do_destroy();
+        }
+
+        void AudioChannel::destroy()
+        {
+            nFlags     |= FINALIZED;
+            do_destroy();
+
+            Widget::destroy();
+        }
+
+        void AudioChannel::do_destroy()
+        {
+            vPeaks.flush();
+            nPeakBlock      = 1;
+            nPeakSamples    = 0;
+
+            if (pDrawData != NULL)
+            {
+                lsp::free_aligned(pDrawData);
+                pDrawData       = NULL;
+            }
+            vDrawBuf        = NULL;
+            nDrawCap        = 0;
         }
 
         status_t AudioChannel::init()
@@ -198,7 +229,12 @@ namespace lsp
             Widget::property_changed(prop);
 
             if (vSamples.is(prop))
+            {
+                // Samples have been modified in arbitrary way, the summary is not valid anymore
+                if (!bAppend)
+                    reset_peaks();
                 query_draw();
+            }
             if (prop->one_of(sHeadCut, sTailCut, sFadeIn, sFadeOut, sStretchBegin, sStretchEnd, sLoopBegin, sLoopEnd, sPlayPosition))
                 query_draw();
             if (prop->one_of(sWaveBorder, sFadeInBorder, sFadeOutBorder, sStretchBorder, sLoopBorder, sPlayBorder, sLineWidth, sMaxAmplitude))
@@ -223,6 +259,133 @@ namespace lsp
             sConstraints.apply(r, scaling);
         }
 
+        status_t AudioChannel::append(const float *v, size_t count)
+        {
+            if (count <= 0)
+                return STATUS_OK;
+
+            bAppend         = true;
+            lsp_finally { bAppend = false; };
+
+            return vSamples.append(v, count);
+        }
+
+        void AudioChannel::reset_peaks()
+        {
+            vPeaks.clear();
+            nPeakBlock      = 1;
+            nPeakSamples    = 0;
+        }
+
+        void AudioChannel::decimate_peaks()
+        {
+            // Merge each pair of blocks into one block
+            const size_t n  = vPeaks.size();
+            peak_t *v       = vPeaks.array();
+            for (size_t i=0, j=0; j<n; ++i, j += 2)
+            {
+                peak_t *dst     = &v[i];
+                const peak_t *a = &v[j];
+                if ((j + 1) < n)
+                {
+                    const peak_t *b = &v[j + 1];
+                    dst->fMin       = lsp_min(a->fMin, b->fMin);
+                    dst->fMax       = lsp_max(a->fMax, b->fMax);
+                }
+                else
+                    *dst            = *a;
+            }
+
+            vPeaks.truncate((n + 1) >> 1);
+            nPeakBlock    <<= 1;
+        }
+
+        void AudioChannel::update_peaks()
+        {
+            const size_t samples    = vSamples.size();
+            if (nPeakSamples > samples)
+                reset_peaks();
+
+            // Process only samples that have not been summarized yet
+            const float *v          = vSamples.values();
+            while (nPeakSamples < samples)
+            {
+                const size_t off        = nPeakSamples & (nPeakBlock - 1);
+                peak_t *p               = NULL;
+                if (off == 0)
+                {
+                    if (vPeaks.size() >= PEAKS_MAX)
+                    {
+                        decimate_peaks();
+                        continue;
+                    }
+                    if ((p = vPeaks.add()) == NULL)
+                        return;
+                    p->fMin                 = v[nPeakSamples];
+                    p->fMax                 = p->fMin;
+                }
+                else
+                    p                       = vPeaks.uget(vPeaks.size() - 1);
+
+                // Update the block
+                const size_t count      = lsp_min(nPeakBlock - off, samples - nPeakSamples);
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float s           = v[nPeakSamples + i];
+                    p->fMin                 = lsp_min(p->fMin, s);
+                    p->fMax                 = lsp_max(p->fMax, s);
+                }
+                nPeakSamples           += count;
+            }
+        }
+
+        void AudioChannel::peaks(float *vmin, float *vmax, size_t samples, size_t count)
+        {
+            update_peaks();
+
+            // Each output point covers range of samples, take peaks of all blocks within the range
+            const size_t blocks     = vPeaks.size();
+            const peak_t *v         = vPeaks.array();
+            const float kx          = float(samples) / float(count);
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t first            = size_t(i * kx) / nPeakBlock;
+                size_t last             = lsp_max(size_t((i + 1) * kx), size_t(i * kx) + 1);
+                last                    = lsp_min((last + nPeakBlock - 1) / nPeakBlock, blocks);
+
+                // The range always includes zero level since the wave is filled relative to it
+                float min               = 0.0f;
+                float max               = 0.0f;
+                for (size_t j=first; j<last; ++j)
+                {
+                    min                     = lsp_min(min, v[j].fMin);
+                    max                     = lsp_max(max, v[j].fMax);
+                }
+                vmin[i]                 = min;
+                vmax[i]                 = max;
+            }
+        }
+
+        float *AudioChannel::draw_buffer(size_t count)
+        {
+            if (count > nDrawCap)
+            {
+                size_t cap          = lsp::align_size(count, 0x100);
+                uint8_t *data       = NULL;
+                float *buf          = lsp::alloc_aligned<float>(data, cap);
+                if (buf == NULL)
+                    return NULL;
+
+                if (pDrawData != NULL)
+                    lsp::free_aligned(pDrawData);
+                pDrawData           = data;
+                vDrawBuf            = buf;
+                nDrawCap            = cap;
+            }
+
+            return vDrawBuf;
+        }
+
         void AudioChannel::draw_samples(const ws::rectangle_t *r, ws::ISurface *s, size_t samples, float scaling, float bright, float max_amplitude)
         {
             // Check limits
@@ -231,47 +394,48 @@ namespace lsp
 
             // Init decimation buffer
             ssize_t n_draw      = lsp_min(ssize_t(samples), r->nWidth);
-            size_t n_points     = n_draw + 2;
-            size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
+            size_t n_points     = n_draw * 2 + 2; // 2 additional points at start and end
+            size_t n_decim      = lsp::align_size(n_points, 16);
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Get drawing buffer
+            float *x            = draw_buffer(n_decim * 3);
             if (x == NULL)
                 return;
+            float *y            = &x[n_decim];
+            float *vmin         = &y[n_decim];
+            float *vmax         = &vmin[n_draw];
 
-            // Form the x and y values
+            // Form the x and y values: upper peaks go forward, lower peaks go backward
             float border        = (sWaveBorder.get() > 0) ? lsp_max(1.0f, sWaveBorder.get() * scaling) : 0.0f;
             float dx            = lsp_max(1.0f, float(r->nWidth) / float(samples));
-            float kx            = lsp_max(1.0f, float(samples) / float(r->nWidth));
             float ky            = -0.5f * (r->nHeight - border) / max_amplitude;
             float sy            = r->nTop + r->nHeight * 0.5f;
 
+            peaks(vmin, vmax, samples, n_draw);
+
             x[0]                = -1.0f;
             y[0]                = sy;
-            x[n_points-1]       = r->nWidth;
-            y[n_points-1]       = sy;
+            x[n_draw+1]         = r->nWidth;
+            y[n_draw+1]         = sy;
 
-            for (ssize_t i=1; i <= n_draw; ++i)
+            for (ssize_t i=0; i < n_draw; ++i)
             {
-                ssize_t xx          = i - 1;
-                x[i]                = xx * dx;
-                y[i]                = sy + ky * vSamples.get(ssize_t(xx * kx));
+                float xx            = i * dx;
+                x[i+1]              = xx;
+                y[i+1]              = sy + ky * vmax[i];
+                x[n_points-i-1]     = xx;
+                y[n_points-i-1]     = sy + ky * vmin[i];
             }
 
             // Draw the poly
             lsp::Color fill(sColor);
             lsp::Color wire(sWaveBorderColor);
-            fill.scale_lch_luminance(bright);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(fill, bright);
+            scale_lch_luminance(wire, bright);
 
             bool aa             = s->set_antialiasing(true);
             s->draw_poly(fill, wire, border, x, y, n_points);
             s->set_antialiasing(aa);
-
-            // Free allocated data
-            lsp::free_aligned(data);
         }
 
         void AudioChannel::draw_fades(const ws::rectangle_t *r, ws::ISurface *s, size_t samples, float scaling, float bright)
@@ -312,7 +476,7 @@ namespace lsp
                 if (sHeadCut.get() > 0)
                 {
                     lsp::Color cut(sHeadCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(sHeadCut.get() * r->nWidth) / float(samples);
                     s->fill_rect(cut, SURFMASK_NONE, 0.0f, r->nLeft, r->nTop, dx, r->nHeight);
@@ -323,8 +487,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(sFadeInColor);
                 lsp::Color wire(sFadeInBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fi_border, x, y, 6);
             }
@@ -353,7 +517,7 @@ namespace lsp
                 if (sTailCut.get() > 0)
                 {
                     lsp::Color cut(sTailCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(sTailCut.get() * r->nWidth) / float(samples);
                     s->fill_rect(cut, SURFMASK_NONE, 0.0f, r->nLeft + r->nWidth - dx, r->nTop, dx, r->nHeight);
@@ -364,8 +528,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(sFadeOutColor);
                 lsp::Color wire(sFadeOutBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fo_border, x, y, 6);
             }
@@ -392,8 +556,8 @@ namespace lsp
             // Draw the range
             lsp::Color fill(*range->color);
             lsp::Color wire(*range->border_color);
-            fill.scale_lch_luminance(bright);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(fill, bright);
+            scale_lch_luminance(wire, bright);
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
@@ -420,7 +584,7 @@ namespace lsp
             float border        = lsp_max(1.0f, pborder * scaling);
 
             lsp::Color wire(sPlayColor);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(wire, bright);
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
@@ -441,7 +605,7 @@ namespace lsp
             // Clear the surface
             lsp::Color bg;
             get_actual_bg_color(bg);
-            bg.scale_lch_luminance(bright);
+            scale_lch_luminance(bg, bright);
             s->clear(bg);
 
             size_t samples      = vSamples.size();
@@ -474,7 +638,7 @@ namespace lsp
                 if (line_w > 0)
                 {
                     lsp::Color line(sLineColor);
-                    line.scale_lch_luminance(bright);
+                    scale_lch_luminance(line, bright);
 
                     float sy            = r.nHeight * 0.5f;
                     bool aa             = s->set_antialiasing(false);
@@ -487,6 +651,15 @@ namespace lsp
             }
             s->clip_end();
         }
+
+        void AudioChannel::memory_usage(w_memory_t *mem) const
+        {
+            Widget::memory_usage(mem);
+
+            mem->nData         += vSamples.capacity() * sizeof(float);
+            mem->nData         += vPeaks.capacity() * sizeof(peak_t);
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
 
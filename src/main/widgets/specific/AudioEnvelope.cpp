@@ -237,12 +237,7 @@ namespace lsp
 
         void AudioEnvelope::drop_glass()
         {
-            if (pGlass != NULL)
-            {
-                pGlass->destroy();
-                delete pGlass;
-                pGlass      = NULL;
-            }
+            GlassCache::release(&pGlass);
         }
 
         status_t AudioEnvelope::init()
@@ -296,6 +291,8 @@ namespace lsp
             if (id >= 0) id = sSlots.add(SLOT_BEGIN_EDIT, slot_begin_edit, self());
             if (id >= 0) id = sSlots.add(SLOT_END_EDIT, slot_end_edit, self());
 
+            allow_concurrent_draw();
+
             return (id >= 0) ? STATUS_OK : -id;
         }
 
@@ -573,7 +570,7 @@ namespace lsp
                     const float l_width     = lsp_max(1.0f, sLineWidth.get() * scaling);
                     lsp::Color fill(sFillColor);
                     lsp::Color wire(sLineColor);
-                    fill.scale_lch_luminance(bright);
+                    scale_lch_luminance(fill, bright);
                     wire.scale_hsl_lightness(bright);
 
                     dsp::mul_k2(x, dx, points);
@@ -591,7 +588,7 @@ namespace lsp
             // Draw points
             lsp::Color pcolor(sPointColor);
             lsp::Color ph_color(sPointHoverColor);
-            pcolor.scale_lch_luminance(bright);
+            scale_lch_luminance(pcolor, bright);
             ph_color.scale_hsl_lightness(bright);
 
             for (size_t i=0; i<PR_TOTAL; ++i)
@@ -612,7 +609,7 @@ namespace lsp
 
             // Draw background
             lsp::Color color(sColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
             s->clear(color);
 
             // Draw curve and points
@@ -637,7 +634,7 @@ namespace lsp
             lsp::Color color(sColor);
             lsp::Color bg_color;
             get_actual_bg_color(bg_color);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             s->clip_begin(area);
             {
@@ -657,13 +654,13 @@ namespace lsp
                 // Draw the glass and the border
                 color.copy(sGlassColor);
                 bg_color.copy(sColor);
-                color.scale_lch_luminance(bright);
-                bg_color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
+                scale_lch_luminance(bg_color, bright);
 
                 const bool flat         = sBorderFlat.get();
                 if (sGlass.get())
                 {
-                    cv = create_border_glass(&pGlass, s,
+                    cv = pDisplay->glass_cache()->border_glass(&pGlass, s,
                             color, bg_color,
                             SURFMASK_ALL_CORNER, bw, xr,
                             sSize.nWidth, sSize.nHeight, flat
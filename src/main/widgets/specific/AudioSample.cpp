@@ -254,12 +254,7 @@ namespace lsp
 
         void AudioSample::drop_glass()
         {
-            if (pGlass != NULL)
-            {
-                pGlass->destroy();
-                delete pGlass;
-                pGlass      = NULL;
-            }
+            GlassCache::release(&pGlass);
         }
 
         void AudioSample::do_destroy()
@@ -347,6 +342,8 @@ namespace lsp
             // Add slots
             handler_id_t id = sSlots.add(SLOT_SUBMIT, slot_on_submit, self());
 
+            allow_concurrent_draw();
+
             return (id >= 0) ? STATUS_OK : -id;
         }
 
@@ -510,45 +507,47 @@ namespace lsp
 
             // Init decimation buffer
             ssize_t n_draw      = lsp_min(ssize_t(samples), r->nWidth);
-            size_t n_points     = n_draw + 2;
-            size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
+            size_t n_points     = n_draw * 2 + 2; // 2 additional points at start and end
+            size_t n_decim      = lsp::align_size(n_points, 16);
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Get drawing buffer
+            float *x            = c->draw_buffer(n_decim * 3);
             if (x == NULL)
                 return;
-            lsp_finally { lsp::free_aligned(data); };
+            float *y            = &x[n_decim];
+            float *vmin         = &y[n_decim];
+            float *vmax         = &vmin[n_draw];
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
 
-            // Form the x and y values
-            FloatArray *vsamp   = &c->vSamples;
+            // Form the x and y values: upper peaks go forward, lower peaks go backward
             float border        = (sWaveBorder.get() > 0) ? lsp_max(1.0f, sWaveBorder.get() * scaling) : 0.0f;
             float dx            = lsp_max(1.0f, float(r->nWidth) / float(samples));
-            float kx            = lsp_max(1.0f, float(samples) / float(r->nWidth));
             float ky            = -0.5f * (r->nHeight - border) / max_amplitude;
             float sy            = r->nTop + r->nHeight * 0.5f;
 
+            c->peaks(vmin, vmax, samples, n_draw);
+
             x[0]                = -1.0f;
             y[0]                = sy;
-            x[n_points-1]       = r->nWidth;
-            y[n_points-1]       = sy;
+            x[n_draw+1]         = r->nWidth;
+            y[n_draw+1]         = sy;
 
-            for (ssize_t i=1; i <= n_draw; ++i)
+            for (ssize_t i=0; i < n_draw; ++i)
             {
-                ssize_t xx          = i - 1;
-                x[i]                = xx * dx;
-                y[i]                = sy + ky * vsamp->get(ssize_t(xx * kx));
+                float xx            = i * dx;
+                x[i+1]              = xx;
+                y[i+1]              = sy + ky * vmax[i];
+                x[n_points-i-1]     = xx;
+                y[n_points-i-1]     = sy + ky * vmin[i];
             }
 
             // Draw the poly
             lsp::Color fill(c->sColor);
             lsp::Color wire(c->sWaveBorderColor);
-            fill.scale_lch_luminance(bright);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(fill, bright);
+            scale_lch_luminance(wire, bright);
 
             s->draw_poly(fill, wire, border, x, y, n_points);
         }
@@ -594,7 +593,7 @@ namespace lsp
                 if (c->sHeadCut.get() > 0)
                 {
                     lsp::Color cut(c->sHeadCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(c->sHeadCut.get() * r->nWidth) / float(samples);
                     *head_cut           = lsp_max(*head_cut, ssize_t(dx));
@@ -606,8 +605,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(c->sFadeInColor);
                 lsp::Color wire(c->sFadeInBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fi_border, x, y, 6);
             }
@@ -636,7 +635,7 @@ namespace lsp
                 if (c->sTailCut.get() > 0)
                 {
                     lsp::Color cut(c->sTailCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(c->sTailCut.get() * r->nWidth) / float(samples);
                     *tail_cut           = lsp_max(*tail_cut, ssize_t(dx));
@@ -648,8 +647,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(c->sFadeOutColor);
                 lsp::Color wire(c->sFadeOutBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fo_border, x, y, 6);
             }
@@ -678,8 +677,8 @@ namespace lsp
             // Draw the range
             lsp::Color fill(*range->color);
             lsp::Color wire(*range->border_color);
-            fill.scale_lch_luminance(bright);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(fill, bright);
+            scale_lch_luminance(wire, bright);
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
@@ -708,7 +707,7 @@ namespace lsp
             float border        = lsp_max(1.0f, pborder * scaling);
 
             lsp::Color wire(sPlayColor);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(wire, bright);
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
@@ -729,26 +728,27 @@ namespace lsp
             ssize_t n_draw      = lsp_min(ssize_t(samples), r->nWidth);
             size_t n_points     = n_draw + 2;
             size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
+            size_t n_peaks      = lsp::align_size(n_draw, 16);
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Get drawing buffer: coordinates of the poly followed by minimum and maximum peaks
+            float *x            = c->draw_buffer((n_decim + n_peaks) * 2);
             if (x == NULL)
                 return;
-            lsp_finally { lsp::free_aligned(data); };
+            float *y            = &x[n_decim];
+            float *vmin         = &y[n_decim];
+            float *vmax         = &vmin[n_peaks];
 
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
 
             // Form the x and y values for sample 1
-            FloatArray *vsamp   = &c->vSamples;
             float border        = (sWaveBorder.get() > 0) ? lsp_max(1.0f, sWaveBorder.get() * scaling) : 0.0f;
             float dx            = lsp_max(1.0f, float(r->nWidth) / float(samples));
-            float kx            = lsp_max(1.0f, float(samples) / float(r->nWidth));
             float ky            = ((down) ? 1.0f : -1.0f) * (r->nHeight - border) / max_amplitude;
             float sy            = (down) ? r->nTop : r->nTop + r->nHeight;
 
+            c->peaks(vmin, vmax, samples, n_draw);
+
             x[0]                = -1.0f;
             y[0]                = sy;
             x[n_points-1]       = r->nWidth;
@@ -758,14 +758,14 @@ namespace lsp
             {
                 ssize_t xx          = i - 1;
                 x[i]                = xx * dx;
-                y[i]                = sy + ky * fabs(vsamp->get(ssize_t(xx * kx)));
+                y[i]                = sy + ky * lsp_max(-vmin[xx], vmax[xx]);
             }
 
             // Draw the poly
             lsp::Color fill(c->sColor);
             lsp::Color wire(c->sWaveBorderColor);
-            fill.scale_lch_luminance(bright);
-            wire.scale_lch_luminance(bright);
+            scale_lch_luminance(fill, bright);
+            scale_lch_luminance(wire, bright);
             s->draw_poly(fill, wire, border, x, y, n_points);
         }
 
@@ -806,7 +806,7 @@ namespace lsp
                 if (c->sHeadCut.get() > 0)
                 {
                     lsp::Color cut(c->sHeadCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(c->sHeadCut.get() * r->nWidth) / float(samples);
                     *head_cut           = lsp_max(*head_cut, ssize_t(dx));
@@ -818,8 +818,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(c->sFadeInColor);
                 lsp::Color wire(c->sFadeInBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fi_border, x, y, 4);
             }
@@ -844,7 +844,7 @@ namespace lsp
                 if (c->sTailCut.get() > 0)
                 {
                     lsp::Color cut(c->sTailCutColor);
-                    cut.scale_lch_luminance(bright);
+                    scale_lch_luminance(cut, bright);
 
                     float dx            = float(c->sTailCut.get() * r->nWidth) / float(samples);
                     *tail_cut           = lsp_max(*tail_cut, ssize_t(dx));
@@ -856,8 +856,8 @@ namespace lsp
                 // Draw fade
                 lsp::Color fill(c->sFadeOutColor);
                 lsp::Color wire(c->sFadeOutBorderColor);
-                fill.scale_lch_luminance(bright);
-                wire.scale_lch_luminance(bright);
+                scale_lch_luminance(fill, bright);
+                scale_lch_luminance(wire, bright);
 
                 s->draw_poly(fill, wire, fo_border, x, y, 4);
             }
@@ -887,7 +887,7 @@ namespace lsp
 
             // Draw main text
             lsp::Color color(sMainColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             draw_multiline_text(
                 s, &sMainFont, &xr, color, &fp, &tp,
@@ -936,7 +936,7 @@ namespace lsp
 
             // Draw label background
             lsp::Color color(sLabelBgColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
             s->fill_rect(color, SURFMASK_ALL_CORNER, rad, &xr);
 
             // Draw label text
@@ -946,7 +946,7 @@ namespace lsp
             xr.nHeight         -= padding * 2;
 
             color.copy(sLabelColor[idx]);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             draw_multiline_text(
                 s, &sLabelFont, &xr, color, &fp, &tp,
@@ -1043,7 +1043,7 @@ namespace lsp
                     // Draw lines
                     color.copy(sLineColor);
                     xr.nTop             = y + xr.nHeight;
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     bool aa             = s->set_antialiasing(false);
                     for (size_t i=0; i<items; i += 2)
                     {
@@ -1111,7 +1111,7 @@ namespace lsp
                     // Draw lines
                     color.copy(sLineColor);
                     xr.nTop             = y;
-                    color.scale_lch_luminance(bright);
+                    scale_lch_luminance(color, bright);
                     float sy            = xr.nHeight * 0.5f;
                     bool aa             = s->set_antialiasing(false);
                     for (size_t i=0; i<items; ++i)
@@ -1171,7 +1171,7 @@ namespace lsp
             // Draw background
             const float bright        = select_brightness();
             lsp::Color color(sColor);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
             s->clear(color);
 
             // Draw main mesh
@@ -1199,7 +1199,7 @@ namespace lsp
             lsp::Color color(sColor);
             lsp::Color bg_color;
             get_actual_bg_color(bg_color);
-            color.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
 
             s->clip_begin(area);
             {
@@ -1238,8 +1238,8 @@ namespace lsp
                 // Draw the glass and the border
                 color.copy(sGlassColor);
                 bg_color.copy(sColor);
-                color.scale_lch_luminance(bright);
-                bg_color.scale_lch_luminance(bright);
+                scale_lch_luminance(color, bright);
+                scale_lch_luminance(bg_color, bright);
 
                 // Update border width if widget is in pressed state
                 if (pressed)
@@ -1248,7 +1248,7 @@ namespace lsp
                 bool flat   = sBorderFlat.get();
                 if (sGlass.get())
                 {
-                    cv = create_border_glass(&pGlass, s,
+                    cv = pDisplay->glass_cache()->border_glass(&pGlass, s,
                             color, bg_color,
                             SURFMASK_ALL_CORNER, bw, xr,
                             sSize.nWidth, sSize.nHeight, flat
@@ -1271,6 +1271,20 @@ namespace lsp
             drop_glass();
         }
 
+        bool AudioSample::draws_text()
+        {
+            if (sMainVisibility.get())
+                return true;
+            if (!sChannelVisibility.get())
+                return false;
+
+            for (size_t i=0; i<LABELS; ++i)
+                if (sLabelVisibility[i].get())
+                    return true;
+
+            return false;
+        }
+
         void AudioSample::get_visible_channels(lltl::parray<AudioChannel> *dst)
         {
             for (size_t i=0, n=vChannels.size(); i<n; ++i)
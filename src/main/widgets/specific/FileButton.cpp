@@ -314,10 +314,10 @@ namespace lsp
                 lsp::Color text(colors->sInvTextColor);
                 lsp::Color line(colors->sInvLineColor);
                 lsp::Color border(colors->sBorderColor);
-                col.scale_lch_luminance(bright);
-                text.scale_lch_luminance(bright);
-                line.scale_lch_luminance(bright);
-                border.scale_lch_luminance(bright);
+                scale_lch_luminance(col, bright);
+                scale_lch_luminance(text, bright);
+                scale_lch_luminance(line, bright);
+                scale_lch_luminance(border, bright);
 
                 s->clip_begin(&clip);
                     draw_button(s, col, text, line, border);
@@ -332,10 +332,10 @@ namespace lsp
                 lsp::Color text(colors->sTextColor);
                 lsp::Color line(colors->sLineColor);
                 lsp::Color border(colors->sInvBorderColor);
-                col.scale_lch_luminance(bright);
-                text.scale_lch_luminance(bright);
-                line.scale_lch_luminance(bright);
-                border.scale_lch_luminance(bright);
+                scale_lch_luminance(col, bright);
+                scale_lch_luminance(text, bright);
+                scale_lch_luminance(line, bright);
+                scale_lch_luminance(border, bright);
 
                 s->clip_begin(&clip);
                     draw_button(s, col, text, line, border);
@@ -538,9 +538,9 @@ namespace lsp
             lsp::Color bc(colors->sDenColor);
 
             get_actual_bg_color(bg_color);
-            color.scale_lch_luminance(bright);
-            tc.scale_lch_luminance(bright);
-            bc.scale_lch_luminance(bright);
+            scale_lch_luminance(color, bright);
+            scale_lch_luminance(tc, bright);
+            scale_lch_luminance(bc, bright);
 
             // Clear
             s->clear(bg_color);
@@ -625,7 +625,7 @@ namespace lsp
             get_actual_bg_color(col);
             s->clear(col);
             col.copy(sColor);
-            col.scale_lch_luminance(bright);
+            scale_lch_luminance(col, bright);
             s->fill_rect(col, SURFMASK_NONE, 0.0f, &sAAll);
 
             // Pass 1: Draw meter body
@@ -659,8 +659,8 @@ namespace lsp
                     // Compute color of the segment
                     fc.copy(lc);
                     bc.copy(lc);
-                    fc.scale_lch_luminance(bright);
-                    bc.scale_lch_luminance(bright);
+                    scale_lch_luminance(fc, bright);
+                    scale_lch_luminance(bc, bright);
 
                     if (matched)
                         bc.alpha(0.5f);
@@ -716,7 +716,7 @@ namespace lsp
             style::LedMeterChannelColors *lmc = select_colors();
             const lsp::Color *col   = get_color(value, &lmc->sTextRanges, &lmc->sTextColor);
             lsp::Color xcol(*col);
-            xcol.scale_lch_luminance(bright);
+            scale_lch_luminance(xcol, bright);
 
             s->clip_begin(&sAText);
                 sFont.draw(s, xcol, fx, fy, fscaling, &text);
@@ -743,7 +743,7 @@ namespace lsp
             style::LedMeterChannelColors *lmc = select_colors();
             const lsp::Color *col   = get_color(value, &lmc->sHeaderRanges, &lmc->sHeaderColor);
             lsp::Color xcol(*col);
-            xcol.scale_lch_luminance(bright);
+            scale_lch_luminance(xcol, bright);
 
             s->clip_begin(&sAHeader);
                 sFont.draw(s, xcol, fx, fy, fscaling, &text);
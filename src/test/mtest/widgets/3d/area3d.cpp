@@ -199,7 +199,7 @@ MTEST_BEGIN("tk.widgets.3d", area3d)
                 dsp::init_matrix3d_rotate_z(&sWorld.dspm, -yaw);
 
                 // Query area for redraw
-                pArea->query_draw();
+                pArea->query_draw3d();
 
                 return STATUS_OK;
             }
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/ptest/tk/common.h>
+#include <lsp-plug.in/runtime/system.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        Benchmark::Benchmark(const char *test, const char *key)
+        {
+            pTest       = test;
+            pKey        = key;
+            nCount      = 0;
+            nStart      = system::get_time_millis();
+        }
+
+        Benchmark::~Benchmark()
+        {
+            const wssize_t time = system::get_time_millis() - nStart;
+            const char *path    = getenv(LSP_TK_PTEST_REPORT);
+            if ((path == NULL) || (*path == '\0'))
+                return;
+
+            FILE *fd = fopen(path, "a");
+            if (fd == NULL)
+                return;
+
+            const double seconds    = time * 1e-3;
+            const double rate       = (time > 0) ? nCount / seconds : 0.0;
+            fprintf(fd, "{\"test\": \"%s\", \"key\": \"%s\", \"iterations\": %lu, \"time\": %.3f, \"rate\": %.3f}\n",
+                pTest, pKey, (unsigned long)nCount, seconds, rate);
+            fclose(fd);
+        }
+
+        tk::Display *create_display(tk::display_settings_t *settings)
+        {
+            tk::display_settings_t defaults;
+            if (settings == NULL)
+                settings            = &defaults;
+            settings->headless  = true;
+
+            tk::Display *dpy    = new tk::Display(settings);
+            if (dpy == NULL)
+                return NULL;
+            if (dpy->init(0, NULL) != STATUS_OK)
+            {
+                delete dpy;
+                return NULL;
+            }
+
+            return dpy;
+        }
+
+        void destroy_display(tk::Display *dpy)
+        {
+            if (dpy == NULL)
+                return;
+            dpy->destroy();
+            delete dpy;
+        }
+
+        status_t add_widget(tk::Widget *w, lltl::parray<tk::Widget> *list)
+        {
+            if (w == NULL)
+                return STATUS_NO_MEM;
+
+            status_t res = w->init();
+            if ((res == STATUS_OK) && (!list->add(w)))
+                res = STATUS_NO_MEM;
+            if (res != STATUS_OK)
+            {
+                w->destroy();
+                delete w;
+            }
+
+            return res;
+        }
+
+        void destroy_widgets(lltl::parray<tk::Widget> *list)
+        {
+            for (size_t i=list->size(); i > 0; --i)
+            {
+                tk::Widget *w = list->uget(i - 1);
+                w->destroy();
+                delete w;
+            }
+            list->flush();
+        }
+
+        void realize_widget(tk::Widget *w, ssize_t width, ssize_t height)
+        {
+            ws::size_limit_t sr;
+            ws::rectangle_t r;
+
+            w->get_size_limits(&sr);
+
+            r.nLeft     = 0;
+            r.nTop      = 0;
+            r.nWidth    = lsp_max(width, sr.nMinWidth);
+            r.nHeight   = lsp_max(height, sr.nMinHeight);
+            w->realize_widget(&r);
+        }
+    } /* namespace test */
+} /* namespace lsp */
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+#include <lsp-plug.in/io/Path.h>
+
+#define WIDGETS         1000
+
+PTEST_BEGIN("tk.style", schema_apply, 5, 100)
+
+    void apply(tk::Schema *schema, const tk::StyleSheet *ss)
+    {
+        PTEST_ASSERT(schema->apply(ss) == STATUS_OK);
+    }
+
+    PTEST_MAIN
+    {
+        io::Path path;
+        tk::StyleSheet ss;
+
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        // Load the bundled theme
+        PTEST_ASSERT(path.fmt("%s/schema/lsp.xml", resources()) > 0);
+        PTEST_ASSERT(ss.parse_file(&path) == STATUS_OK);
+
+        TK_PTEST_LOOP("no widgets", apply(dpy->schema(), &ss); );
+
+        // Create widgets which will receive the style updates
+        tk::Window *wnd = new tk::Window(dpy);
+        PTEST_ASSERT(test::add_widget(wnd, &widgets) == STATUS_OK);
+        tk::Box *box = new tk::Box(dpy);
+        PTEST_ASSERT(test::add_widget(box, &widgets) == STATUS_OK);
+        PTEST_ASSERT(wnd->add(box) == STATUS_OK);
+
+        for (size_t i=0; i<WIDGETS; ++i)
+        {
+            tk::Widget *w = ((i % 2) == 0) ? static_cast<tk::Widget *>(new tk::Label(dpy)) : new tk::Button(dpy);
+            PTEST_ASSERT(test::add_widget(w, &widgets) == STATUS_OK);
+            PTEST_ASSERT(box->add(w) == STATUS_OK);
+        }
+
+        TK_PTEST_LOOP("1k widgets", apply(dpy->schema(), &ss); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
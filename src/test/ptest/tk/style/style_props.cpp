@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+
+#define PROPERTIES      64
+#define CHILDREN        32
+
+PTEST_BEGIN("tk.style", style_props, 5, 1000)
+
+    class Listener: public tk::IStyleListener
+    {
+        public:
+            size_t          nCount;
+
+        public:
+            explicit Listener()
+            {
+                nCount      = 0;
+            }
+
+            virtual void notify(tk::atom_t property) override
+            {
+                ++nCount;
+            }
+    };
+
+    void get(tk::Style *s, const tk::atom_t *atoms)
+    {
+        ssize_t value;
+        for (size_t i=0; i<PROPERTIES; ++i)
+            PTEST_ASSERT(s->get_int(atoms[i], &value) == STATUS_OK);
+    }
+
+    void set(tk::Style *s, const tk::atom_t *atoms, size_t iteration)
+    {
+        for (size_t i=0; i<PROPERTIES; ++i)
+            PTEST_ASSERT(s->set_int(atoms[i], iteration + i) == STATUS_OK);
+    }
+
+    void set_batch(tk::Style *s, const tk::atom_t *atoms, size_t iteration)
+    {
+        s->begin();
+        for (size_t i=0; i<PROPERTIES; ++i)
+            PTEST_ASSERT(s->set_int(atoms[i], iteration + i) == STATUS_OK);
+        s->end();
+    }
+
+    PTEST_MAIN
+    {
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        tk::Style root(&schema, NULL, NULL);
+        tk::Style *children[CHILDREN];
+        Listener listeners[CHILDREN];
+        tk::atom_t ids[PROPERTIES];
+        LSPString name;
+
+        // Initialize root style
+        PTEST_ASSERT(root.init() == STATUS_OK);
+        for (size_t i=0; i<PROPERTIES; ++i)
+        {
+            PTEST_ASSERT(name.fmt_ascii("property.%d", int(i)));
+            ids[i] = atoms.atom_id(&name);
+            PTEST_ASSERT(ids[i] >= 0);
+            PTEST_ASSERT(root.set_int(ids[i], i) == STATUS_OK);
+        }
+
+        // Create children which inherit properties and listen for changes
+        for (size_t i=0; i<CHILDREN; ++i)
+        {
+            children[i] = new tk::Style(&schema, NULL, NULL);
+            PTEST_ASSERT(children[i] != NULL);
+            PTEST_ASSERT(children[i]->init() == STATUS_OK);
+            PTEST_ASSERT(children[i]->add_parent(&root) == STATUS_OK);
+            for (size_t j=0; j<PROPERTIES; ++j)
+                PTEST_ASSERT(children[i]->bind_int(ids[j], &listeners[i]) == STATUS_OK);
+        }
+        lsp_finally {
+            for (size_t i=0; i<CHILDREN; ++i)
+            {
+                for (size_t j=0; j<PROPERTIES; ++j)
+                    children[i]->unbind(ids[j], &listeners[i]);
+                delete children[i];
+            }
+        };
+
+        size_t iteration = 0;
+        TK_PTEST_LOOP("get own", get(&root, ids); );
+        TK_PTEST_LOOP("get inherited", get(children[0], ids); );
+        TK_PTEST_LOOP("set and notify", set(&root, ids, iteration++); );
+        TK_PTEST_LOOP("batch set and notify", set_batch(&root, ids, iteration++); );
+        PTEST_SEPARATOR;
+
+        size_t notifications = 0;
+        for (size_t i=0; i<CHILDREN; ++i)
+            notifications += listeners[i].nCount;
+        printf("Properties: %d, children: %d, notifications: %ld\n",
+            int(PROPERTIES), int(CHILDREN), long(notifications));
+    }
+
+PTEST_END
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/io/Path.h>
+#include <lsp-plug.in/io/InFileStream.h>
+#include <lsp-plug.in/io/OutMemoryStream.h>
+
+PTEST_BEGIN("tk.style", stylesheet_cache, 5, 100)
+
+    void load_xml(const LSPString *text)
+    {
+        tk::Atoms atoms;
+        tk::StyleSheet ss;
+        tk::Schema schema(&atoms, NULL);
+
+        PTEST_ASSERT(ss.parse_data(text) == STATUS_OK);
+        PTEST_ASSERT(schema.init(NULL, 0) == STATUS_OK);
+        PTEST_ASSERT(schema.apply(&ss) == STATUS_OK);
+    }
+
+    void load_binary(const io::OutMemoryStream *data, const tk::digest_t *stamp)
+    {
+        tk::Atoms atoms;
+        tk::StyleSheet ss;
+        tk::Schema schema(&atoms, NULL);
+
+        PTEST_ASSERT(ss.load_binary(data->data(), data->size(), stamp) == STATUS_OK);
+        PTEST_ASSERT(schema.init(NULL, 0) == STATUS_OK);
+        PTEST_ASSERT(schema.apply(&ss) == STATUS_OK);
+    }
+
+    PTEST_MAIN
+    {
+        io::Path path;
+        io::InFileStream is;
+        io::OutMemoryStream xml, bin;
+        LSPString text;
+        tk::StyleSheet ss;
+        tk::digest_t stamp;
+        lsp_finally {
+            xml.drop();
+            bin.drop();
+        };
+
+        // Read the schema text
+        PTEST_ASSERT(path.fmt("%s/schema/lsp.xml", resources()) > 0);
+        PTEST_ASSERT(is.open(&path) == STATUS_OK);
+        PTEST_ASSERT(is.sink(&xml) >= 0);
+        PTEST_ASSERT(is.close() == STATUS_OK);
+        PTEST_ASSERT(text.set_utf8(reinterpret_cast<const char *>(xml.data()), xml.size()));
+
+        // Prepare the binary representation
+        PTEST_ASSERT(ss.parse_data(&text) == STATUS_OK);
+        tk::sha256(&stamp, xml.data(), xml.size());
+        PTEST_ASSERT(ss.save_binary(&bin, &stamp) == STATUS_OK);
+        printf("XML size: %d bytes, binary size: %d bytes\n", int(xml.size()), int(bin.size()));
+
+        TK_PTEST_LOOP("xml", load_xml(&text); );
+        TK_PTEST_LOOP("binary", load_binary(&bin, &stamp); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+#include <lsp-plug.in/io/Path.h>
+#include <lsp-plug.in/io/InFileStream.h>
+#include <lsp-plug.in/io/OutMemoryStream.h>
+
+namespace
+{
+    using namespace lsp;
+
+    /**
+     * Style sheet which drops values resolved while parsing, so the schema
+     * has to convert each value from the text
+     */
+    class RawStyleSheet: public tk::StyleSheet
+    {
+        protected:
+            static void drop_resolved(style_t *s)
+            {
+                if (s == NULL)
+                    return;
+                for (lltl::iterator<lltl::pair<LSPString, property_t>> it = s->properties.items(); it; ++it)
+                    it->value->type     = tk::PT_UNKNOWN;
+            }
+
+        public:
+            void drop_resolved()
+            {
+                drop_resolved(pRoot);
+
+                lltl::parray<style_t> vs;
+                if (!vStyles.values(&vs))
+                    return;
+                for (size_t i=0, n=vs.size(); i<n; ++i)
+                    drop_resolved(vs.uget(i));
+            }
+    };
+}
+
+PTEST_BEGIN("tk.style", stylesheet_resolve, 5, 100)
+
+    void parse(const LSPString *text, tk::StylePool *pool)
+    {
+        tk::StyleSheet ss;
+        ss.set_pool(pool);
+        PTEST_ASSERT(ss.parse_data(text) == STATUS_OK);
+    }
+
+    void make_large_sheet(LSPString *text, size_t styles, size_t props)
+    {
+        static const char * const values[] =
+        {
+            "true", "false", "123", "-45", "0x1f", "123.45", "-1e-3", ".5",
+            "some text", "12 34", "#1b1c22", "1.0 2.0"
+        };
+        const size_t nvalues = sizeof(values) / sizeof(values[0]);
+
+        PTEST_ASSERT(text->set_ascii("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<schema>\n"));
+        PTEST_ASSERT(text->append_ascii("\t<root>\n\t\t<i.value value=\"1\" />\n\t</root>\n"));
+        for (size_t i=0; i<styles; ++i)
+        {
+            PTEST_ASSERT(text->fmt_append_utf8("\t<style class=\"style%d\" parents=\"root\">\n", int(i)) > 0);
+            for (size_t j=0; j<props; ++j)
+            {
+                const char *v = values[(i * props + j) % nvalues];
+                PTEST_ASSERT(text->fmt_append_utf8("\t\t<p%d.value value=\"%s\" />\n", int(j), v) > 0);
+            }
+            PTEST_ASSERT(text->append_ascii("\t</style>\n"));
+        }
+        PTEST_ASSERT(text->append_ascii("</schema>\n"));
+    }
+
+    void apply(tk::Schema *schema, const tk::StyleSheet *ss)
+    {
+        PTEST_ASSERT(schema->apply(ss) == STATUS_OK);
+    }
+
+    PTEST_MAIN
+    {
+        io::Path path;
+        io::InFileStream is;
+        io::OutMemoryStream xml;
+        LSPString text;
+        lsp_finally { xml.drop(); };
+
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        // Read the bundled theme
+        PTEST_ASSERT(path.fmt("%s/schema/lsp.xml", resources()) > 0);
+        PTEST_ASSERT(is.open(&path) == STATUS_OK);
+        PTEST_ASSERT(is.sink(&xml) >= 0);
+        PTEST_ASSERT(is.close() == STATUS_OK);
+        PTEST_ASSERT(text.set_utf8(reinterpret_cast<const char *>(xml.data()), xml.size()));
+
+        // The same sheet with values resolved while parsing and with values
+        // converted by the schema from the text
+        tk::StyleSheet resolved;
+        RawStyleSheet raw;
+        PTEST_ASSERT(resolved.parse_data(&text) == STATUS_OK);
+        PTEST_ASSERT(raw.parse_data(&text) == STATUS_OK);
+        raw.drop_resolved();
+
+        // Resolution of values by the parsing thread and by the pool of workers
+        tk::StylePool pool;
+        pool.set_threads(4);
+        LSPString large;
+        make_large_sheet(&large, 500, 24);
+
+        TK_PTEST_LOOP("parse", parse(&text, NULL); );
+        TK_PTEST_LOOP("parse x4", parse(&text, &pool); );
+        TK_PTEST_LOOP("parse large", parse(&large, NULL); );
+        TK_PTEST_LOOP("parse large x4", parse(&large, &pool); );
+        PTEST_SEPARATOR;
+
+        TK_PTEST_LOOP("apply unresolved", apply(dpy->schema(), &raw); );
+        TK_PTEST_LOOP("apply resolved", apply(dpy->schema(), &resolved); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+
+#define SETS        0x400
+#define SLOTS       22
+#define WIDGETS     0x400
+
+PTEST_BEGIN("tk.sys", slotset_pool, 5, 100)
+
+    static status_t slot_handler(tk::Widget *sender, void *ptr, void *data)
+    {
+        return STATUS_OK;
+    }
+
+    void build(tk::SlotSet *sets, tk::BlockPool *pool)
+    {
+        for (size_t i=0; i<SETS; ++i)
+        {
+            tk::SlotSet *s = &sets[i];
+            PTEST_ASSERT(s->set_pool(pool) == STATUS_OK);
+            for (size_t j=0; j<SLOTS; ++j)
+                PTEST_ASSERT(s->add(tk::slot_t(j), slot_handler, NULL) >= 0);
+        }
+
+        for (size_t i=0; i<SETS; ++i)
+            sets[i].destroy();
+    }
+
+    void build_widgets(tk::Display *dpy)
+    {
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        for (size_t i=0; i<WIDGETS; ++i)
+            PTEST_ASSERT(test::add_widget(new tk::Button(dpy), &widgets) == STATUS_OK);
+    }
+
+    PTEST_MAIN
+    {
+        tk::SlotSet *sets = new tk::SlotSet[SETS];
+        PTEST_ASSERT(sets != NULL);
+        lsp_finally { delete [] sets; };
+
+        tk::BlockPool pool(tk::SlotSet::item_size());
+
+        TK_PTEST_LOOP("malloc", build(sets, NULL); );
+        TK_PTEST_LOOP("pool", build(sets, &pool); );
+        PTEST_SEPARATOR;
+
+        printf("Slots: %d, pool block size: %d bytes, chunks: %d, memory: %d bytes\n",
+            int(SETS * SLOTS), int(pool.block_size()), int(pool.chunks()), int(pool.memory()));
+
+        for (size_t i=0; i<SETS; ++i)
+            PTEST_ASSERT(sets[i].set_pool(NULL) == STATUS_OK);
+
+        // Measure construction of widgets which also initializes styles and properties
+        tk::display_settings_t settings;
+        tk::Display *dpy = test::create_display(&settings);
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        settings.pooled_slots   = true;
+        tk::Display *pdpy = test::create_display(&settings);
+        PTEST_ASSERT(pdpy != NULL);
+        lsp_finally { test::destroy_display(pdpy); };
+
+        TK_PTEST_LOOP("widgets malloc", build_widgets(dpy); );
+        TK_PTEST_LOOP("widgets pool", build_widgets(pdpy); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
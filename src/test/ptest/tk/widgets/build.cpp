@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+
+#define GROUP_SIZE          10
+
+PTEST_BEGIN("tk.widgets", build, 5, 10)
+
+    tk::Widget *create_widget(tk::Display *dpy, size_t index)
+    {
+        switch (index % 5)
+        {
+            case 0: return new tk::Label(dpy);
+            case 1: return new tk::Button(dpy);
+            case 2: return new tk::Knob(dpy);
+            case 3: return new tk::Led(dpy);
+            default: break;
+        }
+        return new tk::Void(dpy);
+    }
+
+    void build(tk::Display *dpy, size_t count)
+    {
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        // Create window with the root box
+        tk::Window *wnd = new tk::Window(dpy);
+        PTEST_ASSERT(test::add_widget(wnd, &widgets) == STATUS_OK);
+        tk::Box *root = new tk::Box(dpy);
+        PTEST_ASSERT(test::add_widget(root, &widgets) == STATUS_OK);
+        root->orientation()->set_vertical();
+        PTEST_ASSERT(wnd->add(root) == STATUS_OK);
+
+        // Create groups of widgets
+        tk::Box *group = NULL;
+        for (size_t i=0; i<count; ++i)
+        {
+            if ((i % GROUP_SIZE) == 0)
+            {
+                group = new tk::Box(dpy);
+                PTEST_ASSERT(test::add_widget(group, &widgets) == STATUS_OK);
+                PTEST_ASSERT(root->add(group) == STATUS_OK);
+            }
+
+            tk::Widget *w = create_widget(dpy, i);
+            PTEST_ASSERT(test::add_widget(w, &widgets) == STATUS_OK);
+            PTEST_ASSERT(group->add(w) == STATUS_OK);
+        }
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        TK_PTEST_LOOP("1k widgets", build(dpy, 1000); );
+        TK_PTEST_LOOP("10k widgets", build(dpy, 10000); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
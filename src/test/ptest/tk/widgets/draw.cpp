@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define MESH_POINTS         1024
+#define FRAME_ROWS          256
+#define FRAME_COLS          512
+#define SAMPLES             8192
+
+PTEST_BEGIN("tk.widgets", draw, 5, 1000)
+
+    typedef struct surface_t
+    {
+        ws::ISurface   *s;
+
+        explicit surface_t(tk::Display *dpy, size_t width, size_t height)
+        {
+            s   = dpy->display()->create_surface(width, height);
+        }
+
+        ~surface_t()
+        {
+            if (s == NULL)
+                return;
+            s->destroy();
+            delete s;
+        }
+    } surface_t;
+
+    void draw(tk::Widget *w, ws::ISurface *s, size_t width, size_t height)
+    {
+        test::realize_widget(w, width, height);
+        w->draw(s, true);
+    }
+
+    void check_drawn(const surface_t *s, const char *key)
+    {
+        // Ensure that the benchmark measured the real rasterization
+        const tk::HeadlessSurface *hs = static_cast<const tk::HeadlessSurface *>(s->s);
+        const size_t width  = hs->width();
+        const size_t height = hs->height();
+        size_t drawn = 0;
+        for (size_t y=0; y<height; ++y)
+            for (size_t x=0; x<width; ++x)
+                if (hs->pixel(x, y) != 0)
+                    ++drawn;
+
+        printf("%s: %d of %d pixels drawn\n", key, int(drawn), int(width * height));
+        PTEST_ASSERT(drawn > 0);
+    }
+
+    void bench_knob(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        static const size_t sizes[] = { 32, 64, 128 };
+        static const char *keys[] = { "knob 32px", "knob 64px", "knob 128px" };
+
+        for (size_t i=0; i<sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            const size_t size = sizes[i];
+            tk::Knob *kn = new tk::Knob(dpy);
+            PTEST_ASSERT(test::add_widget(kn, widgets) == STATUS_OK);
+            kn->size()->set(size, size);
+            kn->value()->set(0.3f);
+
+            surface_t s(dpy, size * 2, size * 2);
+            PTEST_ASSERT(s.s != NULL);
+            TK_PTEST_LOOP(keys[i], draw(kn, s.s, size, size); );
+            check_drawn(&s, keys[i]);
+        }
+    }
+
+    void bench_led_meter(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        static const size_t sizes[] = { 128, 256, 512 };
+        static const char *keys[] = { "led meter 128px", "led meter 256px", "led meter 512px" };
+
+        for (size_t i=0; i<sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            const size_t size = sizes[i];
+            tk::LedMeterChannel *lm = new tk::LedMeterChannel(dpy);
+            PTEST_ASSERT(test::add_widget(lm, widgets) == STATUS_OK);
+            lm->value()->set_all(-6.0f, -72.0f, 24.0f);
+            lm->peak()->set(0.0f);
+            lm->peak_visible()->set(true);
+            lm->text_visible()->set(true);
+            lm->angle()->set(1);
+            lm->min_segments()->set(size / 4);
+
+            surface_t s(dpy, 32, size);
+            PTEST_ASSERT(s.s != NULL);
+            TK_PTEST_LOOP(keys[i], draw(lm, s.s, 24, size); );
+            check_drawn(&s, keys[i]);
+        }
+    }
+
+    tk::Graph *create_graph(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        tk::Graph *gr = new tk::Graph(dpy);
+        PTEST_ASSERT(test::add_widget(gr, widgets) == STATUS_OK);
+
+        tk::GraphOrigin *go = new tk::GraphOrigin(dpy);
+        PTEST_ASSERT(test::add_widget(go, widgets) == STATUS_OK);
+        PTEST_ASSERT(gr->add(go) == STATUS_OK);
+        go->left()->set(-1.0f);
+        go->top()->set(1.0f);
+
+        tk::GraphAxis *ga = new tk::GraphAxis(dpy);
+        PTEST_ASSERT(test::add_widget(ga, widgets) == STATUS_OK);
+        PTEST_ASSERT(gr->add(ga) == STATUS_OK);
+        ga->min()->set(10.0f);
+        ga->max()->set(24000.0f);
+        ga->log_scale()->set(true);
+        ga->direction()->set_dangle(0.0f);
+        ga->origin()->set(0);
+
+        ga = new tk::GraphAxis(dpy);
+        PTEST_ASSERT(test::add_widget(ga, widgets) == STATUS_OK);
+        PTEST_ASSERT(gr->add(ga) == STATUS_OK);
+        ga->min()->set(-1.0f);
+        ga->max()->set(1.0f);
+        ga->direction()->set_dangle(90.0f);
+        ga->origin()->set(0);
+
+        return gr;
+    }
+
+    void bench_graph_mesh(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        tk::Graph *gr = create_graph(dpy, widgets);
+        tk::GraphMesh *gm = new tk::GraphMesh(dpy);
+        PTEST_ASSERT(test::add_widget(gm, widgets) == STATUS_OK);
+        PTEST_ASSERT(gr->add(gm) == STATUS_OK);
+
+        float *x = static_cast<float *>(malloc(MESH_POINTS * 2 * sizeof(float)));
+        PTEST_ASSERT(x != NULL);
+        lsp_finally { free(x); };
+        float *y = &x[MESH_POINTS];
+        for (size_t i=0; i<MESH_POINTS; ++i)
+        {
+            x[i]    = 10.0f * expf(i * logf(2400.0f) / MESH_POINTS);
+            y[i]    = sinf(i * 16.0f * M_PI / MESH_POINTS);
+        }
+
+        gm->origin()->set(0);
+        gm->haxis()->set(0);
+        gm->vaxis()->set(1);
+        gm->fill()->set(true);
+        gm->smooth()->set(true);
+        PTEST_ASSERT(gm->data()->set_x(x, MESH_POINTS));
+        PTEST_ASSERT(gm->data()->set_y(y, MESH_POINTS));
+
+        surface_t s(dpy, 640, 320);
+        PTEST_ASSERT(s.s != NULL);
+        TK_PTEST_LOOP("graph mesh 1024 points", draw(gr, s.s, 640, 320); );
+        check_drawn(&s, "graph mesh 1024 points");
+    }
+
+    void bench_graph_frame_buffer(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        tk::Graph *gr = create_graph(dpy, widgets);
+        tk::GraphFrameBuffer *fb = new tk::GraphFrameBuffer(dpy);
+        PTEST_ASSERT(test::add_widget(fb, widgets) == STATUS_OK);
+        PTEST_ASSERT(gr->add(fb) == STATUS_OK);
+
+        fb->data()->set_size(FRAME_ROWS, FRAME_COLS);
+        fb->hpos()->set(-1.0f);
+        fb->vpos()->set(1.0f);
+        fb->hscale()->set(1.0f);
+        fb->vscale()->set(1.0f);
+
+        float row[FRAME_COLS];
+        for (size_t i=0; i<FRAME_ROWS; ++i)
+        {
+            for (size_t j=0; j<FRAME_COLS; ++j)
+                row[j]  = 0.5f + 0.5f * sinf((i + j) * 4.0f * M_PI / FRAME_COLS);
+            fb->data()->set_row(fb->data()->top(), row);
+        }
+
+        surface_t s(dpy, 640, 320);
+        PTEST_ASSERT(s.s != NULL);
+        TK_PTEST_LOOP("graph frame buffer 256x512", draw(gr, s.s, 640, 320); );
+        check_drawn(&s, "graph frame buffer 256x512");
+
+        // Push a new row on each iteration to make the frame buffer re-render
+        size_t iteration = 0;
+        TK_PTEST_LOOP("graph frame buffer 256x512 scroll",
+            row[(iteration++) % FRAME_COLS] = 1.0f;
+            fb->data()->set_row(fb->data()->top(), row);
+            draw(gr, s.s, 640, 320);
+        );
+        check_drawn(&s, "graph frame buffer 256x512 scroll");
+    }
+
+    void bench_audio_sample(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+    {
+        tk::AudioSample *as = new tk::AudioSample(dpy);
+        PTEST_ASSERT(test::add_widget(as, widgets) == STATUS_OK);
+        as->main_visibility()->set(false);
+
+        for (size_t i=0; i<2; ++i)
+        {
+            tk::AudioChannel *ac = new tk::AudioChannel(dpy);
+            PTEST_ASSERT(test::add_widget(ac, widgets) == STATUS_OK);
+            PTEST_ASSERT(as->add(ac) == STATUS_OK);
+
+            tk::FloatArray *fa = ac->samples();
+            PTEST_ASSERT(fa->resize(SAMPLES) == STATUS_OK);
+            const float kf = (64.0f + i * 16.0f) * M_PI / SAMPLES;
+            for (size_t j=0; j<SAMPLES; ++j)
+                fa->set(j, sinf(j * kf) * (1.0f - float(j) / SAMPLES));
+            ac->fade_in()->set(SAMPLES / 8);
+            ac->fade_out()->set(SAMPLES / 8);
+        }
+
+        surface_t s(dpy, 640, 240);
+        PTEST_ASSERT(s.s != NULL);
+        TK_PTEST_LOOP("audio sample 2x8192", draw(as, s.s, 640, 240); );
+        check_drawn(&s, "audio sample 2x8192");
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        bench_knob(dpy, &widgets);
+        PTEST_SEPARATOR;
+        bench_led_meter(dpy, &widgets);
+        PTEST_SEPARATOR;
+        bench_graph_mesh(dpy, &widgets);
+        bench_graph_frame_buffer(dpy, &widgets);
+        PTEST_SEPARATOR;
+        bench_audio_sample(dpy, &widgets);
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
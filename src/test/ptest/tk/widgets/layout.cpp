@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+
+#define GRID_SIZE           100
+#define BOX_SIZE            10000
+
+PTEST_BEGIN("tk.widgets", layout, 5, 100)
+
+    void fill(tk::Display *dpy, tk::WidgetContainer *c, size_t count, lltl::parray<tk::Widget> *widgets)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            tk::Void *v = new tk::Void(dpy);
+            PTEST_ASSERT(test::add_widget(v, widgets) == STATUS_OK);
+            v->constraints()->set(8 + (i % 7), 8 + (i % 5), -1, -1);
+            v->allocation()->set_fill(i & 1);
+            PTEST_ASSERT(c->add(v) == STATUS_OK);
+        }
+    }
+
+    void realize(tk::Widget *w, size_t iteration)
+    {
+        // Alternate sizes to make the container re-allocate children
+        w->query_resize();
+        test::realize_widget(w, 1600 + (iteration & 1) * 16, 1200 + (iteration & 1) * 16);
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        // Create grid
+        tk::Grid *grid = new tk::Grid(dpy);
+        PTEST_ASSERT(test::add_widget(grid, &widgets) == STATUS_OK);
+        grid->rows()->set(GRID_SIZE);
+        grid->columns()->set(GRID_SIZE);
+        fill(dpy, grid, GRID_SIZE * GRID_SIZE, &widgets);
+
+        // Create box
+        tk::Box *box = new tk::Box(dpy);
+        PTEST_ASSERT(test::add_widget(box, &widgets) == STATUS_OK);
+        box->orientation()->set_vertical();
+        fill(dpy, box, BOX_SIZE, &widgets);
+
+        size_t iteration = 0;
+        TK_PTEST_LOOP("grid 100x100", realize(grid, iteration++); );
+        TK_PTEST_LOOP("box 10k", realize(box, iteration++); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <private/ptest/tk/common.h>
+
+#define ITEMS               100000
+#define WIDTH               320
+#define HEIGHT              480
+
+PTEST_BEGIN("tk.widgets", listbox, 5, 100)
+
+    void realize(tk::ListBox *lb, size_t iteration)
+    {
+        lb->query_resize();
+        test::realize_widget(lb, WIDTH + (iteration & 1), HEIGHT);
+    }
+
+    void scroll(tk::ListBox *lb, ws::ISurface *s, size_t iteration)
+    {
+        const float max = lb->vscroll()->max();
+        lb->vscroll()->set(((iteration * 97) % 1000) * max * 1e-3f);
+        lb->draw(s, true);
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_display();
+        PTEST_ASSERT(dpy != NULL);
+        lsp_finally { test::destroy_display(dpy); };
+
+        lltl::parray<tk::Widget> widgets;
+        lsp_finally { test::destroy_widgets(&widgets); };
+
+        tk::ListBox *lb = new tk::ListBox(dpy);
+        PTEST_ASSERT(test::add_widget(lb, &widgets) == STATUS_OK);
+
+        // Fill the list with items owned by the list box
+        LSPString text;
+        for (size_t i=0; i<ITEMS; ++i)
+        {
+            tk::ListBoxItem *li = new tk::ListBoxItem(dpy);
+            PTEST_ASSERT(li != NULL);
+            PTEST_ASSERT(li->init() == STATUS_OK);
+            PTEST_ASSERT(lb->items()->madd(li) == STATUS_OK);
+            PTEST_ASSERT(text.fmt_ascii("List item #%d", int(i)));
+            PTEST_ASSERT(li->text()->set_raw(&text) == STATUS_OK);
+        }
+
+        ws::ISurface *s = dpy->display()->create_surface(WIDTH + 1, HEIGHT);
+        PTEST_ASSERT(s != NULL);
+        lsp_finally {
+            s->destroy();
+            delete s;
+        };
+
+        size_t iteration = 0;
+        realize(lb, iteration++);
+
+        TK_PTEST_LOOP("realize 100k", realize(lb, iteration++); );
+        TK_PTEST_LOOP("draw 100k", lb->draw(s, true); );
+        TK_PTEST_LOOP("scroll 100k", scroll(lb, s, iteration++); );
+        PTEST_SEPARATOR;
+    }
+
+PTEST_END
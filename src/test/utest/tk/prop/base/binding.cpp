@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.prop.base", binding)
+
+    class TestPadding: public tk::prop::Padding
+    {
+        public:
+            explicit TestPadding(): tk::prop::Padding(NULL) {}
+
+        public:
+            inline const tk::atom_t        *atoms() const      { return vAtoms;        }
+            inline size_t               count() const      { return P_COUNT;       }
+            inline tk::Style           *style()            { return pStyle;        }
+            inline tk::IStyleListener  *listener()         { return &sListener;    }
+            inline const tk::prop::desc_t *desc() const    { return DESC;          }
+    };
+
+    class TestAllocation: public tk::prop::Allocation
+    {
+        public:
+            explicit TestAllocation(): tk::prop::Allocation(NULL) {}
+
+        public:
+            inline const tk::atom_t        *atoms() const      { return tk::Allocation::vAtoms; }
+            inline size_t               count() const      { return F_TOTAL;       }
+            inline tk::Style           *style()            { return pStyle;        }
+            inline tk::IStyleListener  *listener()         { return &sListener;    }
+            inline const char * const  *flags() const      { return FLAGS;         }
+    };
+
+    template <class P>
+        void check_bound(P *p, tk::Style *style, bool bound)
+        {
+            UTEST_ASSERT(p->style() == ((bound) ? style : NULL));
+            for (size_t i=0; i<p->count(); ++i)
+            {
+                UTEST_ASSERT((p->atoms()[i] >= 0) == bound);
+            }
+        }
+
+    void test_multi_property(tk::Atoms *atoms, tk::Schema *schema)
+    {
+        tk::Style s1(schema, NULL, NULL), s2(schema, NULL, NULL);
+        TestPadding p1, p2, p3;
+        tk::atom_t id = atoms->atom_id("padding");
+
+        printf("Testing binding of multi-property...\n");
+        UTEST_ASSERT(s1.init() == STATUS_OK);
+        UTEST_ASSERT(s2.init() == STATUS_OK);
+
+        // The list of atoms is resolved by the first binding only
+        const size_t composites = atoms->composites();
+        UTEST_ASSERT(p1.bind("padding", &s1) == STATUS_OK);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+        const tk::atom_t *list = atoms->composite_atoms(id, p1.desc());
+        UTEST_ASSERT(list != NULL);
+
+        UTEST_ASSERT(p2.bind("padding", &s2) == STATUS_OK);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+        UTEST_ASSERT(atoms->composite_atoms(id, p2.desc()) == list);
+
+        check_bound(&p1, &s1, true);
+        check_bound(&p2, &s2, true);
+        for (size_t i=0; i<p1.count(); ++i)
+        {
+            UTEST_ASSERT(p1.atoms()[i] == list[i]);
+            UTEST_ASSERT(p2.atoms()[i] == list[i]);
+        }
+        UTEST_ASSERT(s1.listeners() == p1.count());
+        UTEST_ASSERT(s2.listeners() == p2.count());
+
+        // Failed binding should leave no atoms bound
+        UTEST_ASSERT(s1.bind(list[2], p1.desc()[2].type, p3.listener()) == STATUS_OK);
+        UTEST_ASSERT(p3.bind("padding", &s1) != STATUS_OK);
+        check_bound(&p3, &s1, false);
+        UTEST_ASSERT(s1.listeners() == p1.count() + 1);
+        UTEST_ASSERT(s1.unbind(list[2], p3.listener()) == STATUS_OK);
+
+        // The property can be bound again after failure
+        UTEST_ASSERT(p3.bind("padding", &s1) == STATUS_OK);
+        check_bound(&p3, &s1, true);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+
+        UTEST_ASSERT(p1.unbind() == STATUS_OK);
+        UTEST_ASSERT(p2.unbind() == STATUS_OK);
+        UTEST_ASSERT(p3.unbind() == STATUS_OK);
+        check_bound(&p1, &s1, false);
+        UTEST_ASSERT(s1.listeners() == 0);
+        UTEST_ASSERT(s2.listeners() == 0);
+    }
+
+    void test_flags(tk::Atoms *atoms, tk::Schema *schema)
+    {
+        tk::Style s1(schema, NULL, NULL), s2(schema, NULL, NULL);
+        TestAllocation a1, a2, a3;
+        tk::atom_t id = atoms->atom_id("allocation");
+
+        printf("Testing binding of flags...\n");
+        UTEST_ASSERT(s1.init() == STATUS_OK);
+        UTEST_ASSERT(s2.init() == STATUS_OK);
+
+        // The list of atoms is resolved by the first binding only
+        const size_t composites = atoms->composites();
+        UTEST_ASSERT(a1.bind("allocation", &s1) == STATUS_OK);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+        const tk::atom_t *list = atoms->composite_atoms(id, a1.flags());
+        UTEST_ASSERT(list != NULL);
+
+        UTEST_ASSERT(a2.bind("allocation", &s2) == STATUS_OK);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+        UTEST_ASSERT(atoms->composite_atoms(id, a2.flags()) == list);
+
+        check_bound(&a1, &s1, true);
+        check_bound(&a2, &s2, true);
+        for (size_t i=0; i<a1.count(); ++i)
+        {
+            UTEST_ASSERT(a1.atoms()[i] == list[i]);
+            UTEST_ASSERT(a2.atoms()[i] == list[i]);
+        }
+
+        // Failed binding should leave no atoms bound
+        UTEST_ASSERT(s1.bind_bool(list[3], a3.listener()) == STATUS_OK);
+        UTEST_ASSERT(a3.bind("allocation", &s1) != STATUS_OK);
+        check_bound(&a3, &s1, false);
+        UTEST_ASSERT(s1.listeners() == a1.count() + 1);
+        UTEST_ASSERT(s1.unbind(list[3], a3.listener()) == STATUS_OK);
+
+        UTEST_ASSERT(a3.bind("allocation", &s1) == STATUS_OK);
+        check_bound(&a3, &s1, true);
+        UTEST_ASSERT(atoms->composites() == composites + 1);
+
+        UTEST_ASSERT(a1.unbind() == STATUS_OK);
+        UTEST_ASSERT(a2.unbind() == STATUS_OK);
+        UTEST_ASSERT(a3.unbind() == STATUS_OK);
+        UTEST_ASSERT(s1.listeners() == 0);
+        UTEST_ASSERT(s2.listeners() == 0);
+    }
+
+    UTEST_MAIN
+    {
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        UTEST_ASSERT(schema.init(static_cast<tk::IStyleFactory **>(NULL), 0) == STATUS_OK);
+
+        test_multi_property(&atoms, &schema);
+        test_flags(&atoms, &schema);
+    }
+
+UTEST_END
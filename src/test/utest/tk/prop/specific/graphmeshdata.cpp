@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#include <atomic>
+
+#define FRAMES          0x10000
+#define CAPACITY        64
+
+UTEST_BEGIN("tk.prop.specific", graphmeshdata)
+
+    typedef struct context_t
+    {
+        tk::prop::GraphMeshData    *data;
+        std::atomic<size_t>         published;
+        std::atomic<bool>           done;
+        status_t                    result;
+    } context_t;
+
+    static inline size_t frame_size(size_t index)
+    {
+        return 1 + index % CAPACITY;
+    }
+
+    static status_t produce(context_t *ctx)
+    {
+        tk::GraphMeshData::frame_t f;
+
+        for (size_t n=1; n<=FRAMES; ++n)
+        {
+            if (!ctx->data->back_frame(&f))
+                return STATUS_BAD_STATE;
+
+            const size_t size = frame_size(n);
+            for (size_t i=0; i<size; ++i)
+            {
+                f.x[i]      = n;
+                f.y[i]      = n + i;
+                f.s[i]      = (i & 1) ? 1.0f : 0.0f;
+            }
+            if (!ctx->data->publish(size))
+                return STATUS_BAD_STATE;
+
+            ctx->published.store(n, std::memory_order_release);
+        }
+
+        return STATUS_OK;
+    }
+
+    static status_t producer(void *arg)
+    {
+        context_t *ctx  = static_cast<context_t *>(arg);
+        ctx->result     = produce(ctx);
+        ctx->done.store(true, std::memory_order_release);
+        return ctx->result;
+    }
+
+    void check_frame(const tk::GraphMeshData *md, size_t *index)
+    {
+        const size_t n = md->x()[0];
+        UTEST_ASSERT_MSG(md->size() == frame_size(n),
+            "Frame %d has size %d, expected %d", int(n), int(md->size()), int(frame_size(n)));
+
+        // All elements should belong to the same frame
+        for (size_t i=0; i<md->size(); ++i)
+        {
+            UTEST_ASSERT_MSG(md->x()[i] == n, "Torn frame %d: x[%d] = %f", int(n), int(i), md->x()[i]);
+            UTEST_ASSERT_MSG(md->y()[i] == n + i, "Torn frame %d: y[%d] = %f", int(n), int(i), md->y()[i]);
+            UTEST_ASSERT_MSG(md->s()[i] == ((i & 1) ? 1.0f : 0.0f), "Torn frame %d: s[%d] = %f", int(n), int(i), md->s()[i]);
+        }
+
+        *index  = n;
+    }
+
+    UTEST_MAIN
+    {
+        tk::prop::GraphMeshData md;
+        UTEST_ASSERT(md.set_strobe(true));
+        UTEST_ASSERT(md.set_triple_buffer(CAPACITY));
+        UTEST_ASSERT(md.triple_buffer());
+        UTEST_ASSERT(!md.fetch());
+
+        context_t ctx;
+        ctx.data        = &md;
+        ctx.published.store(0, std::memory_order_relaxed);
+        ctx.done.store(false, std::memory_order_relaxed);
+        ctx.result      = STATUS_OK;
+
+        ipc::Thread *thread = new ipc::Thread(producer, &ctx);
+        UTEST_ASSERT(thread != NULL);
+        lsp_finally { delete thread; };
+        UTEST_ASSERT(thread->start() == STATUS_OK);
+
+        // Render frames while the producer is publishing them
+        size_t last = 0, fetched = 0;
+        while (last < FRAMES)
+        {
+            // The frame published before fetch() or any newer one should be rendered
+            const size_t latest = ctx.published.load(std::memory_order_acquire);
+            if (md.fetch())
+            {
+                size_t n = 0;
+                check_frame(&md, &n);
+                UTEST_ASSERT_MSG(n > last, "Frame %d rendered after frame %d", int(n), int(last));
+                last    = n;
+                ++fetched;
+            }
+            UTEST_ASSERT_MSG(last >= latest, "Rendered frame %d while frame %d is published", int(last), int(latest));
+
+            if ((last < FRAMES) && (ctx.done.load(std::memory_order_acquire)) &&
+                (ctx.published.load(std::memory_order_acquire) < FRAMES))
+                break;
+            ipc::Thread::yield();
+        }
+
+        UTEST_ASSERT(thread->join() == STATUS_OK);
+        UTEST_ASSERT(ctx.result == STATUS_OK);
+
+        // The last published frame is always delivered
+        UTEST_ASSERT(last == FRAMES);
+        UTEST_ASSERT(!md.fetch());
+        printf("Rendered %d of %d published frames\n", int(fetched), int(FRAMES));
+    }
+
+UTEST_END
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+namespace
+{
+    static const char *sheet_v1 =
+        "<schema>"
+            "<colors>"
+                "<accent value=\"#ff0000\" />"
+                "<accent_dark value=\"#800000\" />"
+            "</colors>"
+            "<root />"
+            "<style class=\"Base\" parents=\"root\">"
+                "<ref value=\"accent\" />"
+                "<other value=\"accent_dark\" />"
+                "<count value=\"1\" />"
+            "</style>"
+            "<style class=\"Left\" parents=\"Base\" />"
+            "<style class=\"Right\" parents=\"Base\" />"
+            "<style class=\"Bottom\" parents=\"Left,Right\" />"
+        "</schema>";
+
+    static const char *sheet_v2 =
+        "<schema>"
+            "<colors>"
+                "<accent value=\"#00ff00\" />"
+                "<accent_dark value=\"#800000\" />"
+            "</colors>"
+            "<root />"
+            "<style class=\"Base\" parents=\"root\">"
+                "<ref value=\"accent\" />"
+                "<other value=\"accent_dark\" />"
+                "<count value=\"1\" />"
+            "</style>"
+            "<style class=\"Left\" parents=\"Base\" />"
+            "<style class=\"Right\" parents=\"Base\" />"
+            "<style class=\"Bottom\" parents=\"Left,Right\">"
+                "<count value=\"2\" />"
+            "</style>"
+        "</schema>";
+}
+
+UTEST_BEGIN("tk.style", schema)
+
+    class CountingFactory: public tk::IStyleFactory
+    {
+        public:
+            size_t          nCreated;
+            bool            bFail;
+
+        public:
+            explicit CountingFactory(const char *name, const char *parents): IStyleFactory(name, parents)
+            {
+                nCreated    = 0;
+                bFail       = false;
+            }
+
+        public:
+            virtual tk::Style *create(tk::Schema *schema)
+            {
+                ++nCreated;
+                return (bFail) ? NULL : init(new tk::Style(schema, sName, sParents));
+            }
+    };
+
+    class CountingListener: public tk::IStyleListener
+    {
+        public:
+            tk::atom_t      vIds[3];
+            size_t          vCounts[3];
+
+        public:
+            explicit CountingListener(tk::atom_t ref, tk::atom_t other, tk::atom_t count)
+            {
+                vIds[0]     = ref;
+                vIds[1]     = other;
+                vIds[2]     = count;
+                reset();
+            }
+
+        public:
+            virtual void notify(tk::atom_t property)
+            {
+                for (size_t i=0; i<3; ++i)
+                    if (vIds[i] == property)
+                        ++vCounts[i];
+            }
+
+            void reset()
+            {
+                for (size_t i=0; i<3; ++i)
+                    vCounts[i]  = 0;
+            }
+    };
+
+    void test_incremental_apply()
+    {
+        static const char *names[] = { "Base", "Left", "Right", "Bottom" };
+
+        printf("Testing incremental apply of the style sheet...\n");
+
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        tk::StyleSheet sv1, sv2;
+
+        UTEST_ASSERT(schema.init(static_cast<tk::IStyleFactory **>(NULL), 0) == STATUS_OK);
+        UTEST_ASSERT(sv1.parse_data(sheet_v1) == STATUS_OK);
+        UTEST_ASSERT(sv2.parse_data(sheet_v2) == STATUS_OK);
+        UTEST_ASSERT(schema.apply(&sv1) == STATUS_OK);
+
+        tk::atom_t ref      = atoms.atom_id("ref");
+        tk::atom_t other    = atoms.atom_id("other");
+        tk::atom_t count    = atoms.atom_id("count");
+        UTEST_ASSERT((ref >= 0) && (other >= 0) && (count >= 0));
+
+        // Bind listeners to all properties of all styles
+        CountingListener l0(ref, other, count), l1(ref, other, count), l2(ref, other, count), l3(ref, other, count);
+        CountingListener *vl[4] = { &l0, &l1, &l2, &l3 };
+        tk::Style *vs[4];
+
+        for (size_t i=0; i<4; ++i)
+        {
+            vs[i] = schema.get(names[i]);
+            UTEST_ASSERT(vs[i] != NULL);
+            UTEST_ASSERT(vs[i]->bind_string(ref, vl[i]) == STATUS_OK);
+            UTEST_ASSERT(vs[i]->bind_string(other, vl[i]) == STATUS_OK);
+            UTEST_ASSERT(vs[i]->bind_int(count, vl[i]) == STATUS_OK);
+            vl[i]->reset();
+        }
+
+        // Apply the same sheet: nothing should be notified
+        UTEST_ASSERT(schema.apply(&sv1) == STATUS_OK);
+        for (size_t i=0; i<4; ++i)
+        {
+            printf("  %s: ref=%d, other=%d, count=%d\n", names[i],
+                int(vl[i]->vCounts[0]), int(vl[i]->vCounts[1]), int(vl[i]->vCounts[2]));
+            UTEST_ASSERT(vl[i]->vCounts[0] == 0);
+            UTEST_ASSERT(vl[i]->vCounts[1] == 0);
+            UTEST_ASSERT(vl[i]->vCounts[2] == 0);
+        }
+
+        // Change the color and the property of one style
+        UTEST_ASSERT(schema.apply(&sv2) == STATUS_OK);
+        for (size_t i=0; i<4; ++i)
+        {
+            printf("  %s: ref=%d, other=%d, count=%d\n", names[i],
+                int(vl[i]->vCounts[0]), int(vl[i]->vCounts[1]), int(vl[i]->vCounts[2]));
+
+            // The property referring the changed color is refreshed once for each style,
+            // the diamond inheritance of 'Bottom' does not cause extra notifications
+            UTEST_ASSERT(vl[i]->vCounts[0] == 1);
+
+            // The name of the changed color is the part of the other color name
+            UTEST_ASSERT(vl[i]->vCounts[1] == 0);
+
+            // Only the overridden value has changed
+            UTEST_ASSERT(vl[i]->vCounts[2] == ((i == 3) ? 1 : 0));
+        }
+
+        for (size_t i=0; i<4; ++i)
+        {
+            vs[i]->unbind(ref, vl[i]);
+            vs[i]->unbind(other, vl[i]);
+            vs[i]->unbind(count, vl[i]);
+        }
+    }
+
+    void test_builtin_styles()
+    {
+        static const char *sheet =
+            "<schema>"
+                "<root />"
+                "<style class=\"Custom\" parents=\"BuiltinBase\">"
+                    "<count value=\"1\" />"
+                "</style>"
+            "</schema>";
+
+        printf("Testing lazy instantiation of builtin styles...\n");
+
+        CountingFactory fbase("BuiltinBase", "root");
+        CountingFactory fchild("BuiltinChild", "BuiltinBase");
+        CountingFactory funused("BuiltinUnused", "root");
+        CountingFactory ffail("BuiltinFailing", "root");
+        tk::IStyleFactory *list[] = { &fbase, &fchild, &funused, &ffail };
+
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        tk::StyleSheet ss;
+
+        // Registration of builtin styles does not instantiate them
+        UTEST_ASSERT(schema.init(list, sizeof(list)/sizeof(tk::IStyleFactory *)) == STATUS_OK);
+        UTEST_ASSERT(fbase.nCreated == 0);
+        UTEST_ASSERT(fchild.nCreated == 0);
+        UTEST_ASSERT(funused.nCreated == 0);
+        UTEST_ASSERT(ffail.nCreated == 0);
+
+        // Applying the sheet instantiates only styles referred by the sheet
+        UTEST_ASSERT(ss.parse_data(sheet) == STATUS_OK);
+        UTEST_ASSERT(schema.apply(&ss) == STATUS_OK);
+        UTEST_ASSERT(fbase.nCreated == 1);
+        UTEST_ASSERT(fchild.nCreated == 0);
+        UTEST_ASSERT(funused.nCreated == 0);
+        UTEST_ASSERT(ffail.nCreated == 0);
+
+        // The first lookup instantiates the style and binds it to default parents
+        tk::Style *base     = schema.get("BuiltinBase");
+        UTEST_ASSERT(base != NULL);
+        UTEST_ASSERT(fbase.nCreated == 1);
+
+        tk::Style *child    = schema.get("BuiltinChild");
+        UTEST_ASSERT(child != NULL);
+        UTEST_ASSERT(fchild.nCreated == 1);
+        UTEST_ASSERT(child->has_parent(base));
+        UTEST_ASSERT(schema.get("BuiltinChild") == child);
+        UTEST_ASSERT(fchild.nCreated == 1);
+        UTEST_ASSERT(funused.nCreated == 0);
+
+        // Failed instantiation does not register the style and can be retried
+        ffail.bFail         = true;
+        UTEST_ASSERT(schema.get("BuiltinFailing") == NULL);
+        UTEST_ASSERT(ffail.nCreated == 1);
+        ffail.bFail         = false;
+        tk::Style *failing  = schema.get("BuiltinFailing");
+        UTEST_ASSERT(failing != NULL);
+        UTEST_ASSERT(ffail.nCreated == 2);
+        UTEST_ASSERT(schema.get("BuiltinFailing") == failing);
+        UTEST_ASSERT(ffail.nCreated == 2);
+    }
+
+    UTEST_MAIN
+    {
+        test_incremental_apply();
+        test_builtin_styles();
+    }
+
+UTEST_END
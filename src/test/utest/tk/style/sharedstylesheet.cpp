@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <private/tk/style/SharedStyleSheet.h>
+
+namespace
+{
+    static const char *sheet_text =
+        "<schema>"
+            "<root>"
+                "<shared.value value=\"42\" />"
+            "</root>"
+        "</schema>";
+
+    typedef struct loader_state_t
+    {
+        size_t      calls;
+    } loader_state_t;
+
+    static status_t load_sheet(lsp::tk::StyleSheet *sheet, void *arg)
+    {
+        loader_state_t *state = static_cast<loader_state_t *>(arg);
+        ++state->calls;
+        return sheet->parse_data(sheet_text);
+    }
+}
+
+UTEST_BEGIN("tk.style", sharedstylesheet)
+
+    void apply_sheet(const tk::StyleSheet *sheet)
+    {
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        ssize_t v = 0;
+
+        UTEST_ASSERT(schema.init(static_cast<tk::IStyleFactory **>(NULL), 0) == STATUS_OK);
+        UTEST_ASSERT(schema.apply(sheet) == STATUS_OK);
+        UTEST_ASSERT(schema.root()->get_int("shared.value", &v) == STATUS_OK);
+        UTEST_ASSERT(v == 42);
+    }
+
+    UTEST_MAIN
+    {
+        loader_state_t state;
+        tk::digest_t s1, s2;
+        tk::shared_stylesheet_t *e1 = NULL, *e2 = NULL, *e3 = NULL;
+
+        state.calls     = 0;
+        tk::sha256(&s1, sheet_text, strlen(sheet_text));
+        tk::sha256(&s2, "modified", 8);
+
+        // The style sheet is loaded only once for the same source
+        printf("Acquiring shared style sheets...\n");
+        UTEST_ASSERT(tk::SharedStyleSheet::acquire(&e1, "schema.xml", &s1, load_sheet, &state) == STATUS_OK);
+        UTEST_ASSERT(tk::SharedStyleSheet::acquire(&e2, "schema.xml", &s1, load_sheet, &state) == STATUS_OK);
+        UTEST_ASSERT(state.calls == 1);
+        UTEST_ASSERT(e1 == e2);
+        UTEST_ASSERT(tk::SharedStyleSheet::sheet(e1) == tk::SharedStyleSheet::sheet(e2));
+
+        // Modified source is loaded again
+        UTEST_ASSERT(tk::SharedStyleSheet::acquire(&e3, "schema.xml", &s2, load_sheet, &state) == STATUS_OK);
+        UTEST_ASSERT(state.calls == 2);
+        UTEST_ASSERT(e3 != e1);
+        tk::SharedStyleSheet::release(e3);
+
+        // The same style sheet is applied to independent schemas
+        printf("Applying shared style sheet...\n");
+        apply_sheet(tk::SharedStyleSheet::sheet(e1));
+        apply_sheet(tk::SharedStyleSheet::sheet(e2));
+
+        // The style sheet is destroyed with the last reference
+        printf("Releasing shared style sheets...\n");
+        tk::SharedStyleSheet::release(e1);
+        UTEST_ASSERT(tk::SharedStyleSheet::acquire(&e3, "schema.xml", &s1, load_sheet, &state) == STATUS_OK);
+        UTEST_ASSERT(state.calls == 2);
+        UTEST_ASSERT(e3 == e2);
+        tk::SharedStyleSheet::release(e3);
+        tk::SharedStyleSheet::release(e2);
+
+        UTEST_ASSERT(tk::SharedStyleSheet::acquire(&e1, "schema.xml", &s1, load_sheet, &state) == STATUS_OK);
+        UTEST_ASSERT(state.calls == 3);
+        tk::SharedStyleSheet::release(e1);
+    }
+
+UTEST_END
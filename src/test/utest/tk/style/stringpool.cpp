@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+
+UTEST_BEGIN("tk.style", stringpool)
+
+    UTEST_MAIN
+    {
+        tk::StringPool pool;
+        char buf[32];
+        tk::StringPool::string_t *list[0x200];
+
+        // Empty strings are not stored
+        UTEST_ASSERT(pool.intern("") == tk::StringPool::empty());
+        UTEST_ASSERT(pool.size() == 0);
+
+        // Equal strings should share the same buffer
+        tk::StringPool::string_t *a = pool.intern("value");
+        tk::StringPool::string_t *b = pool.intern("value");
+        tk::StringPool::string_t *c = pool.intern("other");
+        UTEST_ASSERT(a != NULL);
+        UTEST_ASSERT(c != NULL);
+        UTEST_ASSERT(a == b);
+        UTEST_ASSERT(a != c);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(a), "value") == 0);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(c), "other") == 0);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(tk::StringPool::empty()), "") == 0);
+        UTEST_ASSERT(pool.size() == 2);
+
+        // String should be removed from pool after the last reference is released
+        tk::StringPool::release(b);
+        UTEST_ASSERT(pool.size() == 2);
+        tk::StringPool::release(a);
+        UTEST_ASSERT(pool.size() == 1);
+        a = pool.intern("value");
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(a), "value") == 0);
+        UTEST_ASSERT(pool.size() == 2);
+
+        // Fill the pool to force growth
+        for (size_t i=0; i<sizeof(list)/sizeof(list[0]); ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "string %d", int(i));
+            list[i] = pool.intern(buf);
+            UTEST_ASSERT(list[i] != NULL);
+        }
+        UTEST_ASSERT(pool.size() == sizeof(list)/sizeof(list[0]) + 2);
+        for (size_t i=0; i<sizeof(list)/sizeof(list[0]); ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "string %d", int(i));
+            tk::StringPool::string_t *s = pool.intern(buf);
+            UTEST_ASSERT(s == list[i]);
+            tk::StringPool::release(s);
+            tk::StringPool::release(list[i]);
+        }
+        UTEST_ASSERT(pool.size() == 2);
+
+        // Copies do not belong to the pool
+        tk::StringPool::string_t *d = tk::StringPool::copy("value");
+        UTEST_ASSERT(d != NULL);
+        UTEST_ASSERT(d != a);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(d), "value") == 0);
+        UTEST_ASSERT(pool.size() == 2);
+        UTEST_ASSERT(tk::StringPool::copy("") == tk::StringPool::empty());
+        UTEST_ASSERT(tk::StringPool::acquire(d) == d);
+        tk::StringPool::release(d);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(d), "value") == 0);
+        tk::StringPool::release(d);
+
+        // Strings should outlive the pool
+        pool.destroy();
+        UTEST_ASSERT(pool.size() == 0);
+        UTEST_ASSERT(::strcmp(tk::StringPool::c_str(tk::StringPool::acquire(c)), "other") == 0);
+        tk::StringPool::release(c);
+        tk::StringPool::release(c);
+        tk::StringPool::release(a);
+    }
+
+UTEST_END
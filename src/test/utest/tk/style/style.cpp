@@ -71,6 +71,37 @@ UTEST_BEGIN("tk.style", style)
             }
     };
 
+    class ReentrantListener: public tk::IStyleListener
+    {
+        private:
+            tk::Style      *style;
+            tk::atom_t      id;
+            ssize_t         value;
+
+        public:
+            size_t          calls;
+
+        public:
+            explicit ReentrantListener(tk::Style *style, tk::atom_t id, ssize_t value)
+            {
+                this->style     = style;
+                this->id        = id;
+                this->value     = value;
+                this->calls     = 0;
+            }
+
+        public:
+            virtual void notify(tk::atom_t property)
+            {
+                // Change the property in the nested transaction on the first notification
+                if ((++calls) != 1)
+                    return;
+                style->begin();
+                style->set_int(id, value);
+                style->end();
+            }
+    };
+
     class Circle: public tk::IStyleListener
     {
         private:
@@ -779,6 +810,151 @@ UTEST_BEGIN("tk.style", style)
         UTEST_ASSERT(l3.get(atom("s.value")) == 2);
     }
 
+    void test_reentrant_notifications()
+    {
+        tk::Schema schema(&atoms, NULL);
+        tk::Style root(&schema, NULL, NULL);
+        tk::Style child(&schema, NULL, NULL);
+        tk::atom_t id = atom("r.value");
+        ssize_t v;
+
+        printf("Testing re-entrant transaction notifications...\n");
+        UTEST_ASSERT(root.init() == STATUS_OK);
+        UTEST_ASSERT(child.init() == STATUS_OK);
+        UTEST_ASSERT(root.set_int(id, 1) == STATUS_OK);
+        UTEST_ASSERT(child.add_parent(&root) == STATUS_OK);
+
+        ReentrantListener lr(&root, id, 3);
+        ChangeListener l2(this, "c2"), lc(this, "cc");
+        lr.calls    = 1; // Do not change the property on binding
+        UTEST_ASSERT(root.bind_int(id, &lr) == STATUS_OK);
+        UTEST_ASSERT(root.bind_int(id, &l2) == STATUS_OK);
+        UTEST_ASSERT(child.bind_int(id, &lc) == STATUS_OK);
+        lr.calls    = 0;
+        l2.cl_get(id);
+        lc.cl_get(id);
+
+        // The listener changes the property while notification of children is still pending
+        UTEST_ASSERT(root.begin() == STATUS_OK);
+            UTEST_ASSERT(root.set_int(id, 2) == STATUS_OK);
+        UTEST_ASSERT(root.end() == STATUS_OK);
+
+        UTEST_ASSERT(lr.calls == 2);
+        UTEST_ASSERT(l2.cl_get(id) == 2);
+        UTEST_ASSERT(lc.cl_get(id) >= 1);
+        UTEST_ASSERT(child.get_int(id, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 3);
+
+        // Further transactions still deliver notifications
+        UTEST_ASSERT(root.begin() == STATUS_OK);
+            UTEST_ASSERT(root.set_int(id, 4) == STATUS_OK);
+        UTEST_ASSERT(root.end() == STATUS_OK);
+
+        UTEST_ASSERT(lr.calls == 3);
+        UTEST_ASSERT(l2.cl_get(id) == 1);
+        UTEST_ASSERT(lc.cl_get(id) == 1);
+        UTEST_ASSERT(child.get_int(id, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 4);
+    }
+
+    void test_shared_listeners()
+    {
+        tk::Schema schema(&atoms, NULL);
+        tk::Style root(&schema, NULL, NULL);
+        tk::Style child(&schema, NULL, NULL);
+        tk::Style late(&schema, NULL, NULL);
+        tk::atom_t iv = atom("shared.int");
+        tk::atom_t sv = atom("shared.string");
+        ChangeListener lc(this, "sc"), ll(this, "sl");
+        ssize_t v;
+        LSPString s;
+
+        printf("Testing listeners of inherited properties...\n");
+        UTEST_ASSERT(root.init() == STATUS_OK);
+        UTEST_ASSERT(child.init() == STATUS_OK);
+        UTEST_ASSERT(root.set_int(iv, 1) == STATUS_OK);
+        UTEST_ASSERT(root.set_string(sv, "root") == STATUS_OK);
+        UTEST_ASSERT(child.add_parent(&root) == STATUS_OK);
+
+        // Binding to inherited properties does not create local copies
+        UTEST_ASSERT(child.begin() == STATUS_OK);
+            UTEST_ASSERT(child.bind_int(iv, &lc) == STATUS_OK);
+            UTEST_ASSERT(child.bind_string(sv, &lc) == STATUS_OK);
+            UTEST_ASSERT(child.bind_int(iv, &lc) == STATUS_ALREADY_BOUND);
+            UTEST_ASSERT(lc.get(iv) == 0);
+        UTEST_ASSERT(child.end() == STATUS_OK);
+
+        UTEST_ASSERT(child.properties() == 0);
+        UTEST_ASSERT(child.listeners() == 2);
+        UTEST_ASSERT(lc.cl_get(iv) == 1);
+        UTEST_ASSERT(lc.cl_get(sv) == 1);
+        UTEST_ASSERT(child.get_int(iv, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 1);
+
+        // Local copies created before inheritance get released when the parent is added
+        UTEST_ASSERT(late.init() == STATUS_OK);
+        UTEST_ASSERT(late.bind_int(iv, &ll) == STATUS_OK);
+        UTEST_ASSERT(late.properties() == 1);
+        UTEST_ASSERT(late.add_parent(&root) == STATUS_OK);
+        UTEST_ASSERT(late.properties() == 0);
+        UTEST_ASSERT(ll.cl_get(iv) == 2);
+        UTEST_ASSERT(late.get_int(iv, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 1);
+
+        // Changes of parent are delivered, unchanged values are not
+        UTEST_ASSERT(root.set_int(iv, 2) == STATUS_OK);
+        UTEST_ASSERT(root.set_string(sv, "root") == STATUS_OK);
+        UTEST_ASSERT(lc.cl_get(iv) == 1);
+        UTEST_ASSERT(ll.cl_get(iv) == 1);
+        UTEST_ASSERT(lc.cl_get(sv) == 0);
+        UTEST_ASSERT(root.set_string(sv, "changed") == STATUS_OK);
+        UTEST_ASSERT(lc.cl_get(sv) == 1);
+        UTEST_ASSERT(child.get_string(sv, &s) == STATUS_OK);
+        UTEST_ASSERT(s.equals_ascii("changed"));
+        UTEST_ASSERT(child.properties() == 0);
+
+        // Changes in transaction of parent are delivered once
+        UTEST_ASSERT(root.begin() == STATUS_OK);
+            UTEST_ASSERT(root.set_int(iv, 3) == STATUS_OK);
+            UTEST_ASSERT(root.set_int(iv, 4) == STATUS_OK);
+        UTEST_ASSERT(root.end() == STATUS_OK);
+        UTEST_ASSERT(lc.cl_get(iv) == 1);
+        UTEST_ASSERT(child.get_int(iv, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 4);
+
+        // Setting the property locally creates the local copy
+        UTEST_ASSERT(child.set_int(iv, 10) == STATUS_OK);
+        UTEST_ASSERT(child.properties() == 1);
+        UTEST_ASSERT(lc.cl_get(iv) == 1);
+        UTEST_ASSERT(root.set_int(iv, 5) == STATUS_OK);
+        UTEST_ASSERT(lc.cl_get(iv) == 0);
+        UTEST_ASSERT(child.get_int(iv, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 10);
+
+        // Unbinding shared listener
+        UTEST_ASSERT(child.unbind(sv, &lc) == STATUS_OK);
+        UTEST_ASSERT(child.unbind(sv, &lc) == STATUS_NOT_BOUND);
+        UTEST_ASSERT(child.listeners() == 1);
+        UTEST_ASSERT(root.set_string(sv, "unbound") == STATUS_OK);
+        UTEST_ASSERT(lc.cl_get(sv) == 0);
+    }
+
+    void test_orphan_strings()
+    {
+        tk::Style orphan(NULL, NULL, NULL);
+        const tk::atom_t id = 0;
+        LSPString s;
+
+        printf("Testing string properties of style without schema...\n");
+        UTEST_ASSERT(orphan.init() == STATUS_OK);
+        UTEST_ASSERT(orphan.set_string(id, "orphan") == STATUS_OK);
+        UTEST_ASSERT(orphan.get_string(id, &s) == STATUS_OK);
+        UTEST_ASSERT(s.equals_ascii("orphan"));
+        UTEST_ASSERT(orphan.set_string(id, "changed") == STATUS_OK);
+        UTEST_ASSERT(orphan.get_string(id, &s) == STATUS_OK);
+        UTEST_ASSERT(s.equals_ascii("changed"));
+    }
+
     UTEST_MAIN
     {
         tk::Schema schema(&atoms, NULL);
@@ -790,6 +966,9 @@ UTEST_BEGIN("tk.style", style)
         test_multiple_parents(&schema);
 
         test_notifications();
+        test_reentrant_notifications();
+        test_shared_listeners();
+        test_orphan_strings();
     }
 
 UTEST_END
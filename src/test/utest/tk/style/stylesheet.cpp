@@ -23,6 +23,7 @@
 #include <lsp-plug.in/test-fw/helpers.h>
 #include <lsp-plug.in/tk/tk.h>
 #include <lsp-plug.in/io/Path.h>
+#include <lsp-plug.in/io/OutMemoryStream.h>
 #include <lsp-plug.in/stdlib/string.h>
 
 UTEST_BEGIN("tk.style", stylesheet)
@@ -299,10 +300,236 @@ UTEST_BEGIN("tk.style", stylesheet)
         }
     }
 
+    void compare_lists(lltl::parray<LSPString> *a, lltl::parray<LSPString> *b)
+    {
+        UTEST_ASSERT(a->size() == b->size());
+        for (size_t i=0, n=a->size(); i<n; ++i)
+        {
+            bool found = false;
+            LSPString *s = a->uget(i);
+            for (size_t j=0, m=b->size(); j<m; ++j)
+                if (s->equals(b->uget(j)))
+                {
+                    found = true;
+                    break;
+                }
+            UTEST_ASSERT_MSG(found, "Item '%s' not found", s->get_utf8());
+        }
+    }
+
+    void compare_styles(tk::StyleSheet *a, tk::StyleSheet *b, const LSPString *style)
+    {
+        lltl::parray<LSPString> va, vb;
+        LSPString sa, sb;
+
+        UTEST_ASSERT(a->enum_parents(style, &va) == STATUS_OK);
+        UTEST_ASSERT(b->enum_parents(style, &vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+
+        va.clear();
+        vb.clear();
+        UTEST_ASSERT(a->enum_properties(style, &va) == STATUS_OK);
+        UTEST_ASSERT(b->enum_properties(style, &vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+
+        for (size_t i=0, n=va.size(); i<n; ++i)
+        {
+            LSPString *name = va.uget(i);
+            UTEST_ASSERT(a->get_property(style, name, &sa) == STATUS_OK);
+            UTEST_ASSERT(b->get_property(style, name, &sb) == STATUS_OK);
+            UTEST_ASSERT(sa.equals(&sb));
+        }
+    }
+
+    void test_binary()
+    {
+        printf("Testing binary representation of style sheet...\n");
+
+        io::Path path;
+        tk::StyleSheet ss, xs, bad;
+        io::OutMemoryStream os;
+        lltl::parray<LSPString> va, vb;
+        lsp::Color ca, cb;
+        LSPString sa, sb;
+        bool fa, fb;
+        char ba[32], bb[32];
+
+        UTEST_ASSERT(path.fmt("%s/schema/parse.xml", resources()) > 0);
+        UTEST_ASSERT(ss.parse_file(&path) == STATUS_OK);
+        tk::digest_t stamp, other;
+        tk::sha256(&stamp, "source 1", 8);
+        tk::sha256(&other, "source 2", 8);
+        UTEST_ASSERT(!tk::digest_equals(&stamp, &other));
+        UTEST_ASSERT(ss.save_binary(&os, &stamp) == STATUS_OK);
+
+        // Outdated binary data should not be loaded
+        UTEST_ASSERT(bad.load_binary(os.data(), os.size(), &other) == STATUS_UNSUPPORTED_FORMAT);
+        UTEST_ASSERT(bad.load_binary(os.data(), os.size()) == STATUS_UNSUPPORTED_FORMAT);
+        UTEST_ASSERT(bad.enum_styles(&va) == STATUS_OK);
+        UTEST_ASSERT(va.is_empty());
+        UTEST_ASSERT(bad.load_binary(os.data(), os.size() - 1, &stamp) == STATUS_CORRUPTED);
+
+        // Load binary data and compare
+        UTEST_ASSERT(xs.load_binary(os.data(), os.size(), &stamp) == STATUS_OK);
+        UTEST_ASSERT(xs.title()->equals(ss.title()));
+
+        UTEST_ASSERT(ss.enum_colors(&va) == STATUS_OK);
+        UTEST_ASSERT(xs.enum_colors(&vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+        for (size_t i=0, n=va.size(); i<n; ++i)
+        {
+            LSPString *name = va.uget(i);
+            UTEST_ASSERT(ss.get_color(name, &ca) == STATUS_OK);
+            UTEST_ASSERT(xs.get_color(name, &cb) == STATUS_OK);
+            UTEST_ASSERT(ca.format_rgba(ba, sizeof(ba), 2) > 0);
+            UTEST_ASSERT(cb.format_rgba(bb, sizeof(bb), 2) > 0);
+            UTEST_ASSERT(::strcmp(ba, bb) == 0);
+        }
+
+        va.clear();
+        vb.clear();
+        UTEST_ASSERT(ss.enum_fonts(&va) == STATUS_OK);
+        UTEST_ASSERT(xs.enum_fonts(&vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+        for (size_t i=0, n=va.size(); i<n; ++i)
+        {
+            LSPString *name = va.uget(i);
+            UTEST_ASSERT(ss.get_font(name, &sa, &fa) == STATUS_OK);
+            UTEST_ASSERT(xs.get_font(name, &sb, &fb) == STATUS_OK);
+            UTEST_ASSERT(sa.equals(&sb));
+            UTEST_ASSERT(fa == fb);
+        }
+
+        va.clear();
+        vb.clear();
+        UTEST_ASSERT(ss.enum_constants(&va) == STATUS_OK);
+        UTEST_ASSERT(xs.enum_constants(&vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+        for (size_t i=0, n=va.size(); i<n; ++i)
+        {
+            LSPString *name = va.uget(i);
+            UTEST_ASSERT(ss.get_constant(name, &sa) == STATUS_OK);
+            UTEST_ASSERT(xs.get_constant(name, &sb) == STATUS_OK);
+            UTEST_ASSERT(sa.equals(&sb));
+        }
+
+        va.clear();
+        vb.clear();
+        UTEST_ASSERT(ss.enum_styles(&va) == STATUS_OK);
+        UTEST_ASSERT(xs.enum_styles(&vb) == STATUS_OK);
+        compare_lists(&va, &vb);
+        compare_styles(&ss, &xs, NULL);
+        for (size_t i=0, n=va.size(); i<n; ++i)
+            compare_styles(&ss, &xs, va.uget(i));
+
+        os.drop();
+    }
+
+    void make_large_sheet(LSPString *text, size_t styles, size_t props)
+    {
+        static const char * const values[] =
+        {
+            "true", "false", "123", "-45", "0x1f", "123.45", "-1e-3", ".5",
+            "some text", "12 34", "#1b1c22", "1.0 2.0"
+        };
+        const size_t nvalues = sizeof(values) / sizeof(values[0]);
+
+        UTEST_ASSERT(text->set_ascii("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<schema>\n"));
+        UTEST_ASSERT(text->append_ascii("\t<root>\n\t\t<i.value value=\"1\" />\n\t</root>\n"));
+        for (size_t i=0; i<styles; ++i)
+        {
+            UTEST_ASSERT(text->fmt_append_utf8("\t<style class=\"style%d\" parents=\"root\">\n", int(i)) > 0);
+            for (size_t j=0; j<props; ++j)
+            {
+                const char *v = values[(i * props + j) % nvalues];
+                UTEST_ASSERT(text->fmt_append_utf8("\t\t<p%d.value value=\"%s\" />\n", int(j), v) > 0);
+            }
+            UTEST_ASSERT(text->append_ascii("\t</style>\n"));
+        }
+        UTEST_ASSERT(text->append_ascii("</schema>\n"));
+    }
+
+    void test_large()
+    {
+        printf("Testing resolution of property values of the large sheet...\n");
+
+        LSPString text;
+        make_large_sheet(&text, 500, 24);
+
+        // Values resolved while parsing should survive the binary round trip
+        tk::StyleSheet ss, xs;
+        io::OutMemoryStream sos, xos;
+
+        UTEST_ASSERT(ss.parse_data(&text) == STATUS_OK);
+        UTEST_ASSERT(ss.save_binary(&sos) == STATUS_OK);
+        UTEST_ASSERT(xs.load_binary(sos.data(), sos.size()) == STATUS_OK);
+        UTEST_ASSERT(xs.save_binary(&xos) == STATUS_OK);
+
+        UTEST_ASSERT(sos.size() == xos.size());
+        UTEST_ASSERT(::memcmp(sos.data(), xos.data(), sos.size()) == 0);
+
+        // Errors should be reported after the document has been partially parsed
+        tk::StyleSheet bs;
+        UTEST_ASSERT(text.append_ascii("<bad />"));
+        UTEST_ASSERT(bs.parse_data(&text) != STATUS_OK);
+        UTEST_ASSERT(bs.error()->length() > 0);
+    }
+
+    void test_threads()
+    {
+        printf("Testing concurrent resolution of property values...\n");
+
+        LSPString text;
+        make_large_sheet(&text, 500, 24);
+
+        tk::StylePool pool;
+        pool.set_threads(4);
+
+        // Parse sequentially and concurrently, binary representations should be identical
+        tk::StyleSheet ss, xs;
+        io::OutMemoryStream sos, xos;
+        xs.set_pool(&pool);
+
+        UTEST_ASSERT(ss.parse_data(&text) == STATUS_OK);
+        UTEST_ASSERT(xs.parse_data(&text) == STATUS_OK);
+        UTEST_ASSERT(pool.workers() == 4);
+        UTEST_ASSERT(pool.resolved() > 0);
+        UTEST_ASSERT(ss.save_binary(&sos) == STATUS_OK);
+        UTEST_ASSERT(xs.save_binary(&xos) == STATUS_OK);
+
+        UTEST_ASSERT(sos.size() == xos.size());
+        UTEST_ASSERT(::memcmp(sos.data(), xos.data(), sos.size()) == 0);
+
+        // The pool is shared between style sheets and keeps its workers
+        tk::StyleSheet ys;
+        io::OutMemoryStream yos;
+        ys.set_pool(&pool);
+        UTEST_ASSERT(ys.parse_data(&text) == STATUS_OK);
+        UTEST_ASSERT(pool.workers() == 4);
+        UTEST_ASSERT(ys.save_binary(&yos) == STATUS_OK);
+        UTEST_ASSERT(sos.size() == yos.size());
+        UTEST_ASSERT(::memcmp(sos.data(), yos.data(), sos.size()) == 0);
+
+        // Errors should be reported in the same way
+        tk::StyleSheet bs, bx;
+        bx.set_pool(&pool);
+        UTEST_ASSERT(text.append_ascii("<bad />"));
+        UTEST_ASSERT(bs.parse_data(&text) != STATUS_OK);
+        UTEST_ASSERT(bx.parse_data(&text) != STATUS_OK);
+        UTEST_ASSERT(bs.error()->equals(bx.error()));
+
+        sos.drop();
+        xos.drop();
+        yos.drop();
+    }
+
     UTEST_MAIN
     {
         test_load();
         test_loop();
+        test_binary();
+        test_large();
+        test_threads();
     }
 
 UTEST_END
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/tk/helpers/draw.h>
+
+UTEST_BEGIN("tk.sys", bitmapcache)
+
+    static void fill(mm::Bitmap *bmp, size_t x, size_t y, uint8_t v)
+    {
+        uint8_t *p = &bmp->row(y)[x * 4];
+        p[0] = v;
+        p[1] = v;
+        p[2] = v;
+        p[3] = 0xff;
+    }
+
+    static bool equals(const mm::Bitmap *bmp, size_t x, size_t y, uint8_t v)
+    {
+        const uint8_t *p = &bmp->row(y)[x * 4];
+        for (size_t i=0; i<3; ++i)
+            if (lsp_abs(int(p[i]) - int(v)) > 1)
+                return false;
+        return p[3] == 0xff;
+    }
+
+    void test_scale_bitmap()
+    {
+        mm::Bitmap src, dst;
+
+        // Solid color is kept when scaling in any direction
+        UTEST_ASSERT(src.init(mm::PIXFMT_PBGRA8888, 4, 4) == STATUS_OK);
+        for (size_t y=0; y<4; ++y)
+            for (size_t x=0; x<4; ++x)
+                fill(&src, x, y, 0x40);
+        UTEST_ASSERT(tk::scale_bitmap(&dst, &src, 9, 2) == STATUS_OK);
+        UTEST_ASSERT((dst.width() == 9) && (dst.height() == 2));
+        for (size_t y=0; y<dst.height(); ++y)
+            for (size_t x=0; x<dst.width(); ++x)
+                UTEST_ASSERT_MSG(equals(&dst, x, y, 0x40), "Invalid pixel at %d, %d", int(x), int(y));
+
+        // Shrinking averages the covered pixels
+        UTEST_ASSERT(src.init(mm::PIXFMT_PBGRA8888, 2, 2) == STATUS_OK);
+        fill(&src, 0, 0, 0x00);
+        fill(&src, 1, 0, 0xff);
+        fill(&src, 0, 1, 0xff);
+        fill(&src, 1, 1, 0x00);
+        UTEST_ASSERT(tk::scale_bitmap(&dst, &src, 1, 1) == STATUS_OK);
+        UTEST_ASSERT(equals(&dst, 0, 0, 0x80));
+
+        // Enlarging keeps the edge pixels and interpolates between them
+        UTEST_ASSERT(src.init(mm::PIXFMT_PBGRA8888, 1, 2) == STATUS_OK);
+        fill(&src, 0, 0, 0x00);
+        fill(&src, 1, 0, 0xff);
+        UTEST_ASSERT(tk::scale_bitmap(&dst, &src, 4, 1) == STATUS_OK);
+        UTEST_ASSERT(equals(&dst, 0, 0, 0x00));
+        UTEST_ASSERT(equals(&dst, 3, 0, 0xff));
+        UTEST_ASSERT(dst.row(0)[4] < dst.row(0)[8]);
+
+        // Invalid sizes
+        UTEST_ASSERT(tk::scale_bitmap(&dst, &src, 0, 1) == STATUS_BAD_ARGUMENTS);
+    }
+
+    void test_scaled_bitmaps()
+    {
+        mm::Bitmap src;
+        UTEST_ASSERT(src.init(mm::PIXFMT_PBGRA8888, 8, 8) == STATUS_OK);
+
+        tk::ScaledBitmaps sb;
+        const mm::Bitmap *a = sb.get(&src, 1, 1);
+        UTEST_ASSERT(a != NULL);
+        UTEST_ASSERT(sb.get(&src, 2, 2) != NULL);
+        UTEST_ASSERT(sb.get(&src, 3, 3) != NULL);
+        UTEST_ASSERT(sb.get(&src, 4, 4) != NULL);
+        UTEST_ASSERT(sb.size() == tk::ScaledBitmaps::MAX_ITEMS);
+
+        // Hit moves the version to the head, the least recently used one is evicted
+        UTEST_ASSERT(sb.get(&src, 1, 1) == a);
+        UTEST_ASSERT(sb.get(&src, 5, 5) != NULL);
+        UTEST_ASSERT(sb.size() == tk::ScaledBitmaps::MAX_ITEMS);
+        UTEST_ASSERT(sb.get(&src, 1, 1) == a);
+        UTEST_ASSERT((a->width() == 1) && (a->height() == 1));
+
+        // Too large versions are not created
+        UTEST_ASSERT(sb.get(&src, 0x10000, 0x1000) == NULL);
+        UTEST_ASSERT(sb.size() == tk::ScaledBitmaps::MAX_ITEMS);
+
+        sb.clear();
+        UTEST_ASSERT(sb.size() == 0);
+    }
+
+    void test_cache()
+    {
+        LSPString path, other;
+        UTEST_ASSERT(path.fmt_utf8("%s/img/landscape-icon.xpm", resources()) > 0);
+        UTEST_ASSERT(other.fmt_utf8("%s/img/portrait-icon.xpm", resources()) > 0);
+
+        tk::BitmapCache cache;
+        tk::BitmapCache::image_t *a = NULL, *b = NULL, *c = NULL;
+
+        // The image is decoded once and shared
+        UTEST_ASSERT(cache.acquire(&a, &path) == STATUS_OK);
+        UTEST_ASSERT(cache.acquire(&b, &path) == STATUS_OK);
+        UTEST_ASSERT(a == b);
+        UTEST_ASSERT(cache.size() == 1);
+        UTEST_ASSERT(cache.acquire(&c, &other) == STATUS_OK);
+        UTEST_ASSERT(c != a);
+        UTEST_ASSERT(cache.size() == 2);
+        UTEST_ASSERT(!tk::BitmapCache::bitmap(a)->is_empty());
+
+        // Pre-scaled versions are shared too
+        const mm::Bitmap *s = tk::BitmapCache::scaled(a, 7, 5);
+        UTEST_ASSERT(s != NULL);
+        UTEST_ASSERT(tk::BitmapCache::scaled(b, 7, 5) == s);
+
+        // The image is evicted with the last reference
+        tk::BitmapCache::release(&a);
+        UTEST_ASSERT(a == NULL);
+        UTEST_ASSERT(cache.size() == 2);
+        tk::BitmapCache::release(&b);
+        UTEST_ASSERT(cache.size() == 1);
+        UTEST_ASSERT(cache.acquire(&a, &path) == STATUS_OK);
+        UTEST_ASSERT(cache.size() == 2);
+
+        // Referenced images outlive the cache
+        cache.destroy();
+        UTEST_ASSERT(cache.size() == 0);
+        UTEST_ASSERT(!tk::BitmapCache::bitmap(a)->is_empty());
+        tk::BitmapCache::release(&a);
+        tk::BitmapCache::release(&c);
+    }
+
+    void test_property()
+    {
+        LSPString path;
+        UTEST_ASSERT(path.fmt_utf8("%s/img/landscape-icon.xpm", resources()) > 0);
+
+        tk::BitmapCache cache;
+        tk::prop::Bitmap a, b;
+        a.set_cache(&cache);
+        b.set_cache(&cache);
+
+        // Images loaded by path share the decoded contents
+        UTEST_ASSERT(a.load(&path) == STATUS_OK);
+        UTEST_ASSERT(b.load(&path) == STATUS_OK);
+        UTEST_ASSERT(a.shared() && b.shared());
+        UTEST_ASSERT(a.bitmap() == b.bitmap());
+        UTEST_ASSERT(cache.size() == 1);
+
+        // Modification detaches the contents
+        UTEST_ASSERT(a.data() != NULL);
+        UTEST_ASSERT(!a.shared());
+        UTEST_ASSERT(a.width() == b.width());
+        UTEST_ASSERT(cache.size() == 1);
+
+        b.reset();
+        UTEST_ASSERT(cache.size() == 0);
+    }
+
+    UTEST_MAIN
+    {
+        printf("Testing scale_bitmap...\n");
+        test_scale_bitmap();
+        printf("Testing pre-scaled versions of bitmap...\n");
+        test_scaled_bitmaps();
+        printf("Testing cache of decoded bitmaps...\n");
+        test_cache();
+        printf("Testing bitmap property with cache...\n");
+        test_property();
+    }
+
+UTEST_END
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.sys", blockpool)
+
+    static status_t slot_handler(tk::Widget *sender, void *ptr, void *data)
+    {
+        return STATUS_OK;
+    }
+
+    void test_references()
+    {
+        tk::BlockPool *pool = tk::BlockPool::create(tk::SlotSet::item_size());
+        UTEST_ASSERT(pool != NULL);
+        UTEST_ASSERT(pool->references() == 1);
+
+        tk::SlotSet *set = new tk::SlotSet();
+        UTEST_ASSERT(set != NULL);
+        UTEST_ASSERT(set->set_pool(pool) == STATUS_OK);
+        UTEST_ASSERT(pool->references() == 2);
+        for (size_t i=0; i<tk::SLOT_TOTAL; ++i)
+            UTEST_ASSERT(set->add(tk::slot_t(i), slot_handler, NULL) >= 0);
+        UTEST_ASSERT(pool->allocated() == tk::SLOT_TOTAL);
+
+        // The slot set keeps the pool alive after the owner releases it
+        pool->release();
+        UTEST_ASSERT(pool->references() == 1);
+        UTEST_ASSERT(set->execute(tk::SLOT_DESTROY, NULL) == STATUS_OK);
+        set->destroy();
+        UTEST_ASSERT(pool->allocated() == 0);
+
+        // The pool is deleted with the slot set
+        delete set;
+    }
+
+    void test_widget_outlives_display()
+    {
+        tk::display_settings_t settings;
+        settings.headless       = true;
+        settings.pooled_slots   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        tk::BlockPool *pool = dpy.slot_pool();
+        UTEST_ASSERT(pool != NULL);
+
+        tk::Button *w = new tk::Button(&dpy);
+        UTEST_ASSERT(w != NULL);
+        UTEST_ASSERT(w->init() == STATUS_OK);
+        UTEST_ASSERT(pool->allocated() > 0);
+        UTEST_ASSERT(pool->references() == 2);
+
+        // The display releases it's reference, the widget still holds the slots
+        dpy.destroy();
+        UTEST_ASSERT(dpy.slot_pool() == NULL);
+        UTEST_ASSERT(pool->references() == 1);
+        UTEST_ASSERT(w->slots()->slot(tk::SLOT_FOCUS_IN) != NULL);
+
+        w->destroy();
+        delete w;
+    }
+
+    UTEST_MAIN
+    {
+        printf("Testing reference counting of the pool...\n");
+        test_references();
+        printf("Testing widget that outlives the display...\n");
+        test_widget_outlives_display();
+    }
+
+UTEST_END
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.sys", census)
+
+    const tk::w_census_t *find(lltl::darray<tk::w_census_t> *list, const tk::w_class_t *meta)
+    {
+        for (size_t i=0, n=list->size(); i<n; ++i)
+        {
+            tk::w_census_t *c = list->uget(i);
+            if (c->pClass == meta)
+                return c;
+        }
+        return NULL;
+    }
+
+    UTEST_MAIN
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        // Widgets registered in the display are destroyed by the display
+        tk::Box *box = new tk::Box(&dpy);
+        UTEST_ASSERT(box->init() == STATUS_OK);
+        UTEST_ASSERT(dpy.add(box) == STATUS_OK);
+
+        for (size_t i=0; i<3; ++i)
+        {
+            tk::Void *v = new tk::Void(&dpy);
+            UTEST_ASSERT(v->init() == STATUS_OK);
+            UTEST_ASSERT(dpy.add(v) == STATUS_OK);
+            UTEST_ASSERT(box->add(v) == STATUS_OK);
+        }
+
+        tk::GraphMesh *mesh = new tk::GraphMesh(&dpy);
+        UTEST_ASSERT(mesh->init() == STATUS_OK);
+        UTEST_ASSERT(dpy.add(mesh) == STATUS_OK);
+        UTEST_ASSERT(mesh->data()->set_size(1024));
+
+        lltl::darray<tk::w_census_t> list;
+        UTEST_ASSERT(dpy.census(&list) == STATUS_OK);
+
+        const tk::w_census_t *c = find(&list, &tk::Void::metadata);
+        UTEST_ASSERT(c != NULL);
+        UTEST_ASSERT(c->nInstances == 3);
+        UTEST_ASSERT(c->sMemory.nStyle > 0);
+        UTEST_ASSERT(c->sMemory.nProperties > 0);
+        UTEST_ASSERT(c->sMemory.nSurfaces == 0);
+
+        c = find(&list, &tk::Box::metadata);
+        UTEST_ASSERT(c != NULL);
+        UTEST_ASSERT(c->nInstances == 1);
+        UTEST_ASSERT(c->sMemory.nData >= 3 * sizeof(void *));
+
+        c = find(&list, &tk::GraphMesh::metadata);
+        UTEST_ASSERT(c != NULL);
+        UTEST_ASSERT(c->nInstances == 1);
+        UTEST_ASSERT(c->sMemory.nData >= 1024 * sizeof(float));
+    }
+
+UTEST_END
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.sys", glasscache)
+
+    void test_lru()
+    {
+        tk::HeadlessSurface s(64, 64);
+        tk::GlassCache cache;
+        lsp::Color gc(0.0f, 0.0f, 0.0f), bc(1.0f, 1.0f, 1.0f);
+        const size_t bytes = 16 * 16 * sizeof(uint32_t);
+
+        tk::GlassCache::glass_t *a = NULL, *b = NULL, *c = NULL, *d = NULL;
+        UTEST_ASSERT(cache.border_glass(&a, &s, gc, bc, 0, 1, 2, 16, 16, true) != NULL);
+        UTEST_ASSERT(cache.border_glass(&b, &s, gc, bc, 0, 1, 2, 16, 16, true) != NULL);
+        UTEST_ASSERT(a == b);
+        UTEST_ASSERT(cache.border_glass(&c, &s, gc, bc, 0, 1, 4, 16, 16, true) != NULL);
+        UTEST_ASSERT(cache.border_glass(&d, &s, gc, bc, 0, 1, 6, 16, 16, true) != NULL);
+        UTEST_ASSERT(cache.size() == 3);
+        UTEST_ASSERT(cache.used() == bytes * 3);
+
+        // Referenced surfaces are never evicted
+        cache.set_budget(0);
+        UTEST_ASSERT(cache.size() == 3);
+        cache.set_budget(bytes * 2);
+
+        // Released surfaces are kept while they fit the budget, the least recently used goes first
+        tk::GlassCache::release(&c);
+        UTEST_ASSERT(c == NULL);
+        tk::GlassCache::release(&d);
+        UTEST_ASSERT(cache.size() == 2);
+        UTEST_ASSERT(cache.used() == bytes * 2);
+
+        // Re-acquired surface is taken from the cache
+        UTEST_ASSERT(cache.border_glass(&d, &s, gc, bc, 0, 1, 6, 16, 16, true) != NULL);
+        UTEST_ASSERT(cache.size() == 2);
+        tk::GlassCache::release(&d);
+
+        // Item shared by two widgets stays alive after the first release
+        tk::GlassCache::release(&a);
+        UTEST_ASSERT(cache.size() == 2);
+        tk::GlassCache::release(&b);
+        UTEST_ASSERT(cache.size() == 2);
+
+        cache.gc();
+        UTEST_ASSERT(cache.size() == 0);
+        UTEST_ASSERT(cache.used() == 0);
+    }
+
+    void test_orphan()
+    {
+        tk::HeadlessSurface s(64, 64);
+        tk::GlassCache *cache = new tk::GlassCache();
+        UTEST_ASSERT(cache != NULL);
+        lsp::Color gc(0.0f, 0.0f, 0.0f), bc(1.0f, 1.0f, 1.0f);
+
+        tk::GlassCache::glass_t *a = NULL;
+        UTEST_ASSERT(cache->border_glass(&a, &s, gc, bc, 0, 1, 2, 16, 16, true) != NULL);
+
+        // The glass held by the widget outlives the cache
+        delete cache;
+        UTEST_ASSERT(a != NULL);
+        tk::GlassCache::release(&a);
+        UTEST_ASSERT(a == NULL);
+    }
+
+    UTEST_MAIN
+    {
+        test_lru();
+        test_orphan();
+    }
+
+UTEST_END
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+UTEST_BEGIN("tk.sys", headless)
+
+    void test_surface()
+    {
+        tk::HeadlessSurface s(16, 16);
+        UTEST_ASSERT(s.data() != NULL);
+        UTEST_ASSERT(s.stride() == 16 * sizeof(uint32_t));
+
+        // Clear and fill
+        lsp::Color red(1.0f, 0.0f, 0.0f), blue(0.0f, 0.0f, 1.0f);
+        s.clear(red);
+        UTEST_ASSERT(s.pixel(0, 0) == 0xffff0000);
+        UTEST_ASSERT(s.pixel(15, 15) == 0xffff0000);
+        UTEST_ASSERT(s.pixel(16, 0) == 0);
+
+        s.fill_rect(blue, 0, 0.0f, 4.0f, 4.0f, 8.0f, 8.0f);
+        UTEST_ASSERT(s.pixel(3, 3) == 0xffff0000);
+        UTEST_ASSERT(s.pixel(4, 4) == 0xff0000ff);
+        UTEST_ASSERT(s.pixel(11, 11) == 0xff0000ff);
+        UTEST_ASSERT(s.pixel(12, 12) == 0xffff0000);
+
+        // Clipping
+        s.clip_begin(0.0f, 0.0f, 2.0f, 2.0f);
+        s.clear(blue);
+        s.clip_end();
+        UTEST_ASSERT(s.pixel(1, 1) == 0xff0000ff);
+        UTEST_ASSERT(s.pixel(2, 2) == 0xffff0000);
+
+        // Semi-transparent fill
+        lsp::Color half(0.0f, 1.0f, 0.0f, 0.5f);
+        s.fill_rect(half, 0, 0.0f, 14.0f, 14.0f, 2.0f, 2.0f);
+        const uint32_t p = s.pixel(15, 15);
+        UTEST_ASSERT((p >> 24) == 0xff);
+        UTEST_ASSERT((((p >> 16) & 0xff) >= 0x7e) && (((p >> 16) & 0xff) <= 0x81));
+        UTEST_ASSERT((((p >> 8) & 0xff) >= 0x7e) && (((p >> 8) & 0xff) <= 0x81));
+
+        // Blit with scaling
+        const uint32_t img[4] = { 0xff000001, 0xff000002, 0xff000003, 0xff000004 };
+        s.draw_raw(img, 2, 2, 2 * sizeof(uint32_t), 8.0f, 8.0f, 2.0f, 2.0f, 0.0f);
+        UTEST_ASSERT(s.pixel(8, 8) == 0xff000001);
+        UTEST_ASSERT(s.pixel(9, 9) == 0xff000001);
+        UTEST_ASSERT(s.pixel(10, 8) == 0xff000002);
+        UTEST_ASSERT(s.pixel(8, 10) == 0xff000003);
+        UTEST_ASSERT(s.pixel(11, 11) == 0xff000004);
+
+        // Readback
+        uint32_t copy[16 * 16];
+        s.read_pixels(copy, 16 * sizeof(uint32_t));
+        for (size_t y=0; y<16; ++y)
+            for (size_t x=0; x<16; ++x)
+                UTEST_ASSERT(copy[y*16 + x] == s.pixel(x, y));
+    }
+
+    void test_primitives()
+    {
+        tk::HeadlessSurface s(24, 16);
+        lsp::Color white(1.0f, 1.0f, 1.0f), black(0.0f, 0.0f, 0.0f);
+
+        // Circle
+        s.fill_circle(white, 8.0f, 8.0f, 5.0f);
+        UTEST_ASSERT(s.pixel(8, 8) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 8) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(2, 8) == 0);
+        UTEST_ASSERT(s.pixel(3, 3) == 0);
+        UTEST_ASSERT(s.pixel(12, 12) == 0);
+
+        // Rectangle with rounded corners
+        s.clear_rgba(0);
+        s.fill_rect(white, SURFMASK_ALL_CORNER ^ SURFMASK_RB_CORNER, 4.0f, 2.0f, 2.0f, 16.0f, 10.0f);
+        UTEST_ASSERT(s.pixel(2, 2) == 0);
+        UTEST_ASSERT(s.pixel(17, 2) == 0);
+        UTEST_ASSERT(s.pixel(2, 11) == 0);
+        UTEST_ASSERT(s.pixel(17, 11) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(10, 2) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(2, 6) == 0xffffffff);
+
+        // Stroke of rectangle
+        s.clear_rgba(0);
+        s.wire_rect(white, SURFMASK_NONE, 0.0f, 2.0f, 2.0f, 16.0f, 10.0f, 2.0f);
+        UTEST_ASSERT(s.pixel(1, 1) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(2, 6) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 6) == 0);
+        UTEST_ASSERT(s.pixel(10, 6) == 0);
+        UTEST_ASSERT(s.pixel(18, 12) == 0xffffffff);
+
+        // Line
+        s.clear_rgba(0);
+        s.line(white, 0.0f, 8.0f, 24.0f, 8.0f, 2.0f);
+        UTEST_ASSERT(s.pixel(0, 7) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(23, 8) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(12, 6) == 0);
+        UTEST_ASSERT(s.pixel(12, 9) == 0);
+
+        // Polygon, the winding order does not matter
+        const float px[] = { 2.0f, 11.0f, 20.0f };
+        const float py[] = { 2.0f, 14.0f, 2.0f };
+        s.clear_rgba(0);
+        s.fill_poly(white, px, py, 3);
+        UTEST_ASSERT(s.pixel(11, 3) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(11, 12) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 12) == 0);
+        UTEST_ASSERT(s.pixel(19, 12) == 0);
+
+        // Frame with rounded inner corners
+        s.clear_rgba(0);
+        s.fill_frame(white, SURFMASK_ALL_CORNER, 3.0f, 0.0f, 0.0f, 24.0f, 16.0f, 3.0f, 3.0f, 18.0f, 10.0f);
+        UTEST_ASSERT(s.pixel(0, 0) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 3) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(12, 8) == 0);
+        UTEST_ASSERT(s.pixel(3, 8) == 0);
+
+        // Linear gradient
+        s.clear_rgba(0);
+        ws::IGradient *g = s.linear_gradient(0.0f, 0.0f, 24.0f, 0.0f);
+        UTEST_ASSERT(g != NULL);
+        g->set_start(black);
+        g->set_stop(white);
+        s.fill_rect(g, SURFMASK_NONE, 0.0f, 0.0f, 0.0f, 24.0f, 16.0f);
+        delete g;
+        UTEST_ASSERT((s.pixel(0, 0) >> 24) == 0xff);
+        UTEST_ASSERT((s.pixel(0, 0) & 0xff) < 0x10);
+        UTEST_ASSERT(((s.pixel(12, 8) & 0xff) > 0x70) && ((s.pixel(12, 8) & 0xff) < 0x90));
+        UTEST_ASSERT((s.pixel(23, 15) & 0xff) > 0xf0);
+
+        // Radial gradient
+        s.clear_rgba(0);
+        g = s.radial_gradient(12.0f, 8.0f, 12.0f, 8.0f, 8.0f);
+        UTEST_ASSERT(g != NULL);
+        g->set_start(white);
+        g->set_stop(black);
+        s.fill_circle(g, 12.0f, 8.0f, 8.0f);
+        delete g;
+        UTEST_ASSERT((s.pixel(12, 8) & 0xff) > (s.pixel(16, 8) & 0xff));
+        UTEST_ASSERT((s.pixel(16, 8) & 0xff) > (s.pixel(19, 8) & 0xff));
+        UTEST_ASSERT(s.pixel(0, 0) == 0);
+
+        // Text is drawn as boxes over the baseline, spaces are not drawn
+        ws::Font f;
+        f.set_size(10.0f);
+        s.clear_rgba(0);
+        s.out_text(f, white, 1.0f, 12.0f, "Ab c");
+        UTEST_ASSERT(s.pixel(3, 10) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(9, 10) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(15, 10) == 0);
+        UTEST_ASSERT(s.pixel(21, 10) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 13) == 0);
+
+        // Centered text
+        s.clear_rgba(0);
+        s.out_text_relative(f, white, 12.0f, 8.0f, 0.0f, 0.0f, "AB");
+        UTEST_ASSERT(s.pixel(9, 8) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(14, 8) == 0xffffffff);
+        UTEST_ASSERT(s.pixel(3, 8) == 0);
+        UTEST_ASSERT(s.pixel(20, 8) == 0);
+    }
+
+    void test_display()
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        UTEST_ASSERT(dpy.headless() != NULL);
+        lsp_finally { dpy.destroy(); };
+
+        tk::Window wnd(&dpy);
+        tk::Void wVoid(&dpy);
+        lsp_finally {
+            wVoid.destroy();
+            wnd.destroy();
+        };
+
+        UTEST_ASSERT(wnd.init() == STATUS_OK);
+        UTEST_ASSERT(wVoid.init() == STATUS_OK);
+        wnd.size()->set(64, 48);
+        wnd.padding()->set(0);
+        wnd.border_size()->set(0);
+        wVoid.bg_color()->set_rgb(0.0f, 1.0f, 0.0f);
+        wVoid.color()->set_rgb(0.0f, 1.0f, 0.0f);
+        wVoid.fill()->set(true);
+        wVoid.allocation()->set_fill(true);
+        UTEST_ASSERT(wnd.add(&wVoid) == STATUS_OK);
+        wnd.show();
+
+        // Run the main loop until the window gets rendered
+        tk::HeadlessWindow *hwnd = static_cast<tk::HeadlessWindow *>(wnd.native());
+        UTEST_ASSERT(hwnd != NULL);
+        for (size_t i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(dpy.main_iteration() == STATUS_OK);
+            tk::HeadlessSurface *s = hwnd->surface();
+            if ((s != NULL) && (s->pixel(32, 24) == 0xff00ff00))
+                break;
+            ipc::Thread::sleep(10);
+        }
+
+        ws::rectangle_t r;
+        UTEST_ASSERT(hwnd->get_geometry(&r) == STATUS_OK);
+        UTEST_ASSERT((r.nWidth == 64) && (r.nHeight == 48));
+
+        tk::HeadlessSurface *s = hwnd->surface();
+        UTEST_ASSERT(s != NULL);
+        UTEST_ASSERT(s->pixel(32, 24) == 0xff00ff00);
+
+        // Synthetic events are delivered by the main loop
+        ws::event_t ev;
+        ws::init_event(&ev);
+        ev.nType        = ws::UIE_RESIZE;
+        ev.nWidth       = 80;
+        ev.nHeight      = 60;
+        UTEST_ASSERT(dpy.headless()->send_event(hwnd, &ev) == STATUS_OK);
+        UTEST_ASSERT(dpy.headless()->pending() == 1);
+        UTEST_ASSERT(dpy.main_iteration() == STATUS_OK);
+        UTEST_ASSERT(dpy.headless()->pending() == 0);
+        UTEST_ASSERT(wnd.size()->width() == 80);
+    }
+
+    UTEST_MAIN
+    {
+        test_surface();
+        test_primitives();
+        test_display();
+    }
+
+UTEST_END
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+#define PRODUCERS       4
+#define MESSAGES        0x4000
+#define CAPACITY        0x20
+
+UTEST_BEGIN("tk.sys", mailbox)
+
+    typedef struct context_t
+    {
+        tk::Mailbox    *mailbox;
+        context_t      *consumer;
+        size_t          producer;
+        size_t          next[PRODUCERS];
+        size_t          errors;
+    } context_t;
+
+    typedef struct update_t
+    {
+        context_t  *consumer;
+        size_t      producer;
+        size_t      index;
+    } update_t;
+
+    static void on_update(tk::Display *dpy, void *data)
+    {
+        const update_t *u = static_cast<const update_t *>(data);
+        context_t *c = u->consumer;
+        if (u->index != c->next[u->producer])
+            ++c->errors;
+        c->next[u->producer] = u->index + 1;
+    }
+
+    static void on_release(void *data)
+    {
+        const update_t *u = static_cast<const update_t *>(data);
+        ++u->consumer->errors;
+    }
+
+    static status_t producer(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        for (size_t i=0; i<MESSAGES; ++i)
+        {
+            update_t u;
+            u.consumer  = ctx->consumer;
+            u.producer  = ctx->producer;
+            u.index     = i;
+            while (ctx->mailbox->post(on_update, &u, sizeof(u)) != STATUS_OK)
+                ipc::Thread::yield();
+        }
+        return STATUS_OK;
+    }
+
+    UTEST_MAIN
+    {
+        tk::Mailbox mailbox(CAPACITY);
+        context_t ctx[PRODUCERS + 1];
+        ipc::Thread *threads[PRODUCERS];
+
+        context_t *c = &ctx[PRODUCERS];
+        c->mailbox  = &mailbox;
+        c->errors   = 0;
+        for (size_t i=0; i<PRODUCERS; ++i)
+            c->next[i]  = 0;
+
+        // Nothing to process
+        UTEST_ASSERT(mailbox.process(NULL) == 0);
+
+        // Start producers
+        for (size_t i=0; i<PRODUCERS; ++i)
+        {
+            ctx[i].mailbox  = &mailbox;
+            ctx[i].consumer = c;
+            ctx[i].producer = i;
+            threads[i]      = new ipc::Thread(producer, &ctx[i]);
+            UTEST_ASSERT(threads[i] != NULL);
+            UTEST_ASSERT(threads[i]->start() == STATUS_OK);
+        }
+
+        // Consume messages while producers are working
+        size_t total = 0;
+        while (total < PRODUCERS * MESSAGES)
+        {
+            size_t n = mailbox.process(NULL);
+            if (n <= 0)
+                ipc::Thread::yield();
+            total  += n;
+        }
+
+        for (size_t i=0; i<PRODUCERS; ++i)
+        {
+            UTEST_ASSERT(threads[i]->join() == STATUS_OK);
+            delete threads[i];
+        }
+
+        // Check that each producer's messages were delivered in order
+        UTEST_ASSERT(mailbox.process(NULL) == 0);
+        UTEST_ASSERT(c->errors == 0);
+        for (size_t i=0; i<PRODUCERS; ++i)
+            UTEST_ASSERT(c->next[i] == MESSAGES);
+
+        // Posting fails when all slots are pending or the data does not fit the slot
+        uint8_t big[tk::Mailbox::MAX_DATA_SIZE + 1] = { 0 };
+        UTEST_ASSERT(mailbox.post(on_update, big, sizeof(big)) == STATUS_TOO_BIG);
+        update_t u = { c, 0, MESSAGES };
+        for (size_t i=0; i<CAPACITY; ++i)
+            UTEST_ASSERT(mailbox.post(on_update, &u, sizeof(u), on_release) == STATUS_OK);
+        UTEST_ASSERT(mailbox.post(on_update, &u, sizeof(u), on_release) == STATUS_OVERFLOW);
+
+        // Pending messages are dropped on destroy and their data is released
+        mailbox.destroy();
+        UTEST_ASSERT(c->errors == CAPACITY);
+        UTEST_ASSERT(mailbox.process(NULL) == 0);
+
+        // Slots of dropped messages are available again
+        c->errors   = 0;
+        for (size_t i=0; i<CAPACITY; ++i)
+            UTEST_ASSERT(mailbox.post(on_update, &u, sizeof(u), on_release) == STATUS_OK);
+        UTEST_ASSERT(mailbox.process(NULL) == CAPACITY);
+        UTEST_ASSERT(c->errors == 0);
+    }
+
+UTEST_END
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+namespace
+{
+    class TestPaletteCache: public lsp::tk::PaletteCache
+    {
+        public:
+            static size_t index_of(const lsp::Color &c, float k)
+            {
+                float src[4];
+                c.get_rgba(src[0], src[1], src[2], src[3]);
+                return entry_index(src, k);
+            }
+    };
+}
+
+UTEST_BEGIN("tk.sys", palettecache)
+
+    void check_equal(TestPaletteCache *cache, const lsp::Color &src, float k)
+    {
+        lsp::Color cached(src), plain(src);
+        cache->scale_lch_luminance(&cached, k);
+        plain.scale_lch_luminance(k);
+
+        float c[4], p[4];
+        cached.get_rgba(c[0], c[1], c[2], c[3]);
+        plain.get_rgba(p[0], p[1], p[2], p[3]);
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT_MSG(c[i] == p[i],
+                "Component %d differs: cached=%f, uncached=%f", int(i), c[i], p[i]);
+    }
+
+    void test_hits_misses()
+    {
+        TestPaletteCache cache;
+        lsp::Color c(0.2f, 0.4f, 0.8f, 0.25f);
+
+        // The first lookup computes the value, the second one takes it from the cache
+        check_equal(&cache, c, 1.5f);
+        UTEST_ASSERT((cache.hits() == 0) && (cache.misses() == 1));
+        check_equal(&cache, c, 1.5f);
+        UTEST_ASSERT((cache.hits() == 1) && (cache.misses() == 1));
+
+        // Other brightness or color is a miss
+        check_equal(&cache, c, 0.5f);
+        UTEST_ASSERT((cache.hits() == 1) && (cache.misses() == 2));
+        check_equal(&cache, lsp::Color(0.2f, 0.4f, 0.8f, 0.5f), 1.5f);
+        UTEST_ASSERT((cache.hits() == 1) && (cache.misses() == 3));
+
+        // Cleared cache has no entries
+        cache.clear();
+        UTEST_ASSERT((cache.hits() == 0) && (cache.misses() == 0));
+        check_equal(&cache, c, 1.5f);
+        UTEST_ASSERT((cache.hits() == 0) && (cache.misses() == 1));
+    }
+
+    void test_collisions()
+    {
+        TestPaletteCache cache;
+        const float k = 0.75f;
+        lsp::Color a(0.5f, 0.5f, 0.5f);
+        const size_t index = TestPaletteCache::index_of(a, k);
+
+        // Find another color that maps to the same entry
+        lsp::Color b;
+        bool found = false;
+        for (size_t i=1; (i < 0x10000) && (!found); ++i)
+        {
+            b.set_rgb((i & 0xff) / 255.0f, (i >> 8) / 255.0f, 0.25f);
+            found = (TestPaletteCache::index_of(b, k) == index);
+        }
+        UTEST_ASSERT(found);
+
+        // Colors displace each other from the shared entry
+        check_equal(&cache, a, k);
+        check_equal(&cache, a, k);
+        UTEST_ASSERT((cache.hits() == 1) && (cache.misses() == 1));
+        check_equal(&cache, b, k);
+        UTEST_ASSERT((cache.hits() == 1) && (cache.misses() == 2));
+        check_equal(&cache, b, k);
+        UTEST_ASSERT((cache.hits() == 2) && (cache.misses() == 2));
+        check_equal(&cache, a, k);
+        UTEST_ASSERT((cache.hits() == 2) && (cache.misses() == 3));
+    }
+
+    void test_equality()
+    {
+        TestPaletteCache cache;
+        static const float brightness[] = { 0.0f, 0.25f, 0.5f, 1.0f, 1.5f, 2.0f };
+
+        // Cached results should match uncached for both the first and repeated lookups
+        for (size_t pass=0; pass<2; ++pass)
+            for (size_t i=0; i<0x100; ++i)
+            {
+                lsp::Color c((i & 0x7) / 7.0f, ((i >> 3) & 0x7) / 7.0f, (i >> 6) / 3.0f, (i & 1) * 0.5f);
+                for (size_t j=0; j<sizeof(brightness)/sizeof(float); ++j)
+                    check_equal(&cache, c, brightness[j]);
+            }
+
+        UTEST_ASSERT(cache.hits() > 0);
+    }
+
+    UTEST_MAIN
+    {
+        printf("Testing cache hits and misses...\n");
+        test_hits_misses();
+        printf("Testing collisions of entries...\n");
+        test_collisions();
+        printf("Testing equality with uncached conversion...\n");
+        test_equality();
+    }
+
+UTEST_END
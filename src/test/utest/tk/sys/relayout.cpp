@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+UTEST_BEGIN("tk.sys", relayout)
+
+    bool wait_layout(tk::Display *dpy, size_t passes)
+    {
+        for (size_t i=0; i<100; ++i)
+        {
+            if (dpy->main_iteration() != STATUS_OK)
+                return false;
+            if (dpy->layout_stats()->nPasses > passes)
+                return true;
+            ipc::Thread::sleep(10);
+        }
+        return false;
+    }
+
+    UTEST_MAIN
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        tk::Window wnd(&dpy);
+        tk::Box box(&dpy);
+        tk::Void va(&dpy), vb(&dpy), vc(&dpy);
+        lsp_finally {
+            vc.destroy();
+            vb.destroy();
+            va.destroy();
+            box.destroy();
+            wnd.destroy();
+        };
+
+        UTEST_ASSERT(wnd.init() == STATUS_OK);
+        UTEST_ASSERT(box.init() == STATUS_OK);
+        UTEST_ASSERT(va.init() == STATUS_OK);
+        UTEST_ASSERT(vb.init() == STATUS_OK);
+        UTEST_ASSERT(vc.init() == STATUS_OK);
+
+        wnd.size()->set(64, 96);
+        box.orientation()->set_vertical();
+        va.constraints()->set(16, 16, 16, 16);
+        vb.constraints()->set(16, 16, 16, 16);
+        vc.constraints()->set(16, 16, 16, 16);
+        UTEST_ASSERT(box.add(&va) == STATUS_OK);
+        UTEST_ASSERT(box.add(&vb) == STATUS_OK);
+        UTEST_ASSERT(box.add(&vc) == STATUS_OK);
+        UTEST_ASSERT(wnd.add(&box) == STATUS_OK);
+        wnd.show();
+
+        // Initial layout realizes the whole tree
+        UTEST_ASSERT(wait_layout(&dpy, 0));
+        for (size_t i=0; (i<10) && (wnd.resize_pending()); ++i)
+            UTEST_ASSERT(wait_layout(&dpy, dpy.layout_stats()->nPasses));
+        UTEST_ASSERT(!wnd.resize_pending());
+
+        // Resize request that does not change size limits is confined to the widget
+        dpy.reset_layout_stats();
+        vb.query_resize();
+        UTEST_ASSERT(!box.resize_pending());
+        UTEST_ASSERT(wait_layout(&dpy, 0));
+        UTEST_ASSERT(dpy.layout_stats()->nPartial == 1);
+        UTEST_ASSERT(dpy.layout_stats()->nWidgets == 1);
+        UTEST_ASSERT(!vb.resize_pending());
+
+        // Change of size limits is forwarded to the parent
+        dpy.reset_layout_stats();
+        vb.constraints()->set(16, 32, 16, 32);
+        UTEST_ASSERT(wait_layout(&dpy, 0));
+        UTEST_ASSERT(dpy.layout_stats()->nWidgets > 1);
+        UTEST_ASSERT(!box.resize_pending());
+        UTEST_ASSERT(!vb.resize_pending());
+    }
+
+UTEST_END
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+    static constexpr size_t COLUMNS     = 4;
+    static constexpr size_t GRAPHS      = 6;        // Graphs with meshes, the last of them have text
+    static constexpr size_t TEXT_GRAPHS = 2;        // Graphs with text items
+    static constexpr size_t SAMPLES     = 2;        // Audio samples, the first one has labels
+    static constexpr size_t CONCURRENT  = GRAPHS - TEXT_GRAPHS + SAMPLES - 1;
+    static constexpr size_t POINTS      = 256;
+    static constexpr size_t WIDTH       = 512;
+    static constexpr size_t HEIGHT      = 256;
+}
+
+UTEST_BEGIN("tk.sys", renderpool)
+
+    typedef struct scene_t
+    {
+        lltl::parray<tk::Widget>    vWidgets;
+        lltl::parray<tk::Graph>     vGraphs;
+        lltl::parray<tk::AudioSample> vSamples;
+
+        ~scene_t()
+        {
+            for (size_t i=vWidgets.size(); (i--) > 0; )
+            {
+                tk::Widget *w = vWidgets.uget(i);
+                w->destroy();
+                delete w;
+            }
+        }
+    } scene_t;
+
+    template <class T>
+        void create(T **dst, tk::Display *dpy, scene_t *scene)
+        {
+            T *w = new T(dpy);
+            UTEST_ASSERT(w != NULL);
+            UTEST_ASSERT(scene->vWidgets.add(w));
+            UTEST_ASSERT(w->init() == STATUS_OK);
+            *dst = w;
+        }
+
+    void wait_render(tk::Display *dpy, tk::Window *wnd, tk::HeadlessWindow *hwnd)
+    {
+        for (size_t i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(dpy->main_iteration() == STATUS_OK);
+            if ((hwnd->surface() != NULL) && (!wnd->redraw_pending()) && (!wnd->resize_pending()))
+                return;
+            ipc::Thread::sleep(10);
+        }
+        UTEST_ASSERT(!wnd->redraw_pending());
+    }
+
+    void create_graph(tk::Display *dpy, scene_t *scene, size_t index)
+    {
+        tk::Graph *g = NULL;
+        create(&g, dpy, scene);
+        UTEST_ASSERT(scene->vGraphs.add(g));
+        g->allocation()->set_fill(true);
+
+        tk::GraphOrigin *go = NULL;
+        create(&go, dpy, scene);
+        UTEST_ASSERT(g->add(go) == STATUS_OK);
+        go->left()->set(-1.0f);
+        go->top()->set(0.0f);
+
+        tk::GraphAxis *ga = NULL;
+        create(&ga, dpy, scene);
+        UTEST_ASSERT(g->add(ga) == STATUS_OK);
+        ga->min()->set(0.0f);
+        ga->max()->set(1.0f);
+        ga->direction()->set_dangle(0.0f);
+        ga->origin()->set(0);
+
+        create(&ga, dpy, scene);
+        UTEST_ASSERT(g->add(ga) == STATUS_OK);
+        ga->min()->set(-1.0f);
+        ga->max()->set(1.0f);
+        ga->direction()->set_dangle(90.0f);
+        ga->origin()->set(0);
+
+        // Mesh is drawn concurrently
+        float x[POINTS], y[POINTS];
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            x[i]    = float(i) / (POINTS - 1);
+            y[i]    = sinf((i * (index + 1) * 2.0f * M_PI) / POINTS);
+        }
+
+        tk::GraphMesh *gm = NULL;
+        create(&gm, dpy, scene);
+        UTEST_ASSERT(g->add(gm) == STATUS_OK);
+        gm->origin()->set(0);
+        gm->haxis()->set(0);
+        gm->vaxis()->set(1);
+        gm->fill()->set(true);
+        gm->width()->set(2);
+        UTEST_ASSERT(gm->data()->set_x(x, POINTS));
+        UTEST_ASSERT(gm->data()->set_y(y, POINTS));
+
+        // Text forces the graph to be drawn by the main thread
+        if (index >= GRAPHS - TEXT_GRAPHS)
+        {
+            tk::GraphText *gt = NULL;
+            create(&gt, dpy, scene);
+            UTEST_ASSERT(g->add(gt) == STATUS_OK);
+            UTEST_ASSERT(gt->text()->set_raw("Graph text") == STATUS_OK);
+            gt->origin()->set(0);
+            gt->haxis()->set(0);
+            gt->vaxis()->set(1);
+            gt->hvalue()->set(0.5f);
+            gt->vvalue()->set(0.5f);
+        }
+    }
+
+    void create_sample(tk::Display *dpy, scene_t *scene, size_t index)
+    {
+        tk::AudioSample *as = NULL;
+        create(&as, dpy, scene);
+        UTEST_ASSERT(scene->vSamples.add(as));
+        as->allocation()->set_fill(true);
+        as->main_visibility()->set(false);
+
+        for (size_t i=0; i<2; ++i)
+        {
+            tk::AudioChannel *ac = NULL;
+            create(&ac, dpy, scene);
+            UTEST_ASSERT(as->add(ac) == STATUS_OK);
+
+            tk::FloatArray *fa = ac->samples();
+            UTEST_ASSERT(fa->resize(POINTS * 4) == STATUS_OK);
+            for (size_t j=0, n=fa->size(); j<n; ++j)
+                fa->set(j, sinf(j * (i + index + 1) * 8.0f * M_PI / n));
+        }
+
+        // Labels force the sample to be drawn by the main thread
+        for (size_t i=0; i<tk::AudioSample::LABELS; ++i)
+            as->label_visibility(i)->set(false);
+        if (index == 0)
+        {
+            UTEST_ASSERT(as->label(0)->set_raw("Label") == STATUS_OK);
+            as->label_visibility(0)->set(true);
+        }
+    }
+
+    void render_window(uint32_t *dst, size_t threads)
+    {
+        tk::display_settings_t settings;
+        settings.headless       = true;
+        settings.render_threads = threads;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+        UTEST_ASSERT((dpy.render_pool() != NULL) == (threads > 0));
+
+        tk::Window wnd(&dpy);
+        tk::Grid grid(&dpy);
+        lsp_finally {
+            grid.destroy();
+            wnd.destroy();
+        };
+
+        // Destroy widgets before the window and the display
+        scene_t *scene = new scene_t();
+        UTEST_ASSERT(scene != NULL);
+        lsp_finally { delete scene; };
+
+        UTEST_ASSERT(wnd.init() == STATUS_OK);
+        UTEST_ASSERT(grid.init() == STATUS_OK);
+        wnd.size()->set(WIDTH, HEIGHT);
+        grid.rows()->set((GRAPHS + SAMPLES) / COLUMNS);
+        grid.columns()->set(COLUMNS);
+        grid.allocation()->set_fill(true);
+
+        for (size_t i=0; i<GRAPHS; ++i)
+        {
+            create_graph(&dpy, scene, i);
+            UTEST_ASSERT(grid.add(scene->vGraphs.uget(i)) == STATUS_OK);
+        }
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            create_sample(&dpy, scene, i);
+            UTEST_ASSERT(grid.add(scene->vSamples.uget(i)) == STATUS_OK);
+        }
+        UTEST_ASSERT(wnd.add(&grid) == STATUS_OK);
+        wnd.show();
+
+        // Render the window, surfaces of widgets are created by the first render pass
+        tk::HeadlessWindow *hwnd = static_cast<tk::HeadlessWindow *>(wnd.native());
+        UTEST_ASSERT(hwnd != NULL);
+        wait_render(&dpy, &wnd, hwnd);
+
+        // Change widgets and render them again, only widgets without text are drawn concurrently
+        const size_t drawn = (threads > 0) ? dpy.render_pool()->drawn() : 0;
+        for (size_t i=0; i<GRAPHS; ++i)
+            scene->vGraphs.uget(i)->color()->set_rgb(float(i) / GRAPHS, 0.5f, 1.0f - float(i) / GRAPHS);
+        for (size_t i=0; i<SAMPLES; ++i)
+            scene->vSamples.uget(i)->color()->set_rgb(0.25f, float(i) / SAMPLES, 0.25f);
+        wait_render(&dpy, &wnd, hwnd);
+
+        if (threads > 0)
+        {
+            tk::RenderPool *pool = dpy.render_pool();
+            UTEST_ASSERT(pool->drawn() - drawn == CONCURRENT);
+            UTEST_ASSERT(pool->workers() == threads);
+        }
+
+        tk::HeadlessSurface *s = hwnd->surface();
+        UTEST_ASSERT(s != NULL);
+        UTEST_ASSERT((s->width() == WIDTH) && (s->height() == HEIGHT));
+        s->read_pixels(dst, WIDTH * sizeof(uint32_t));
+
+        // Ensure that something has been drawn
+        size_t colors = 0;
+        for (size_t i=1; i<WIDTH * HEIGHT; ++i)
+            if (dst[i] != dst[i-1])
+                ++colors;
+        UTEST_ASSERT(colors > WIDTH);
+    }
+
+    UTEST_MAIN
+    {
+        uint32_t *serial    = static_cast<uint32_t *>(malloc(WIDTH * HEIGHT * sizeof(uint32_t)));
+        uint32_t *parallel  = static_cast<uint32_t *>(malloc(WIDTH * HEIGHT * sizeof(uint32_t)));
+        UTEST_ASSERT(serial != NULL);
+        UTEST_ASSERT(parallel != NULL);
+        lsp_finally {
+            free(serial);
+            free(parallel);
+        };
+
+        // The test is expected to be run also with the thread sanitizer (tsan build feature)
+        render_window(serial, 0);
+        for (size_t i=0; i<4; ++i)
+        {
+            render_window(parallel, 4);
+            UTEST_ASSERT(memcmp(serial, parallel, WIDTH * HEIGHT * sizeof(uint32_t)) == 0);
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+UTEST_BEGIN("tk.sys", slot)
+
+    static status_t handler(tk::Widget *sender, void *ptr, void *data)
+    {
+        lltl::darray<ssize_t> *log = static_cast<lltl::darray<ssize_t> *>(data);
+        ssize_t value = reinterpret_cast<ssize_t>(ptr);
+        return (log->add(&value)) ? STATUS_OK : STATUS_NO_MEM;
+    }
+
+    void check_log(tk::Slot *s, const ssize_t *expected, size_t count)
+    {
+        lltl::darray<ssize_t> log;
+        UTEST_ASSERT(s->execute(NULL, &log) == STATUS_OK);
+        UTEST_ASSERT(log.size() == count);
+        for (size_t i=0; i<count; ++i)
+            UTEST_ASSERT(*log.uget(i) == expected[i]);
+    }
+
+    UTEST_MAIN
+    {
+        tk::Slot s;
+        tk::handler_id_t ids[0x40];
+
+        // Bind handlers and interceptor
+        for (size_t i=0; i<4; ++i)
+        {
+            ids[i] = s.bind(handler, reinterpret_cast<void *>(i));
+            UTEST_ASSERT(ids[i] >= 0);
+        }
+        tk::handler_id_t icp = s.intercept(handler, reinterpret_cast<void *>(10));
+        UTEST_ASSERT(icp >= 0);
+        {
+            const ssize_t log[] = { 10, 0, 1, 2, 3 };
+            check_log(&s, log, 5);
+        }
+
+        // Unbind, disable and enable handlers
+        UTEST_ASSERT(s.unbind(ids[1]) == STATUS_OK);
+        UTEST_ASSERT(s.unbind(ids[1]) != STATUS_OK);
+        UTEST_ASSERT(s.disable(ids[2]) == STATUS_OK);
+        {
+            const ssize_t log[] = { 10, 0, 3 };
+            check_log(&s, log, 3);
+        }
+        UTEST_ASSERT(s.enable(ids[2]) == STATUS_OK);
+        UTEST_ASSERT(s.unbind(icp) == STATUS_OK);
+        {
+            const ssize_t log[] = { 0, 2, 3 };
+            check_log(&s, log, 3);
+        }
+
+        // Identifier of the removed handler should not match the new one
+        tk::handler_id_t id = s.bind(handler, reinterpret_cast<void *>(4));
+        UTEST_ASSERT(id >= 0);
+        UTEST_ASSERT(id != ids[1]);
+        UTEST_ASSERT(id != icp);
+        UTEST_ASSERT(s.disable(ids[1]) != STATUS_OK);
+        UTEST_ASSERT(s.unbind(handler, reinterpret_cast<void *>(2)) == ids[2]);
+        {
+            const ssize_t log[] = { 0, 3, 4 };
+            check_log(&s, log, 3);
+        }
+
+        // Bind and unbind many handlers to force compaction of the list
+        for (size_t i=0; i<0x40; ++i)
+        {
+            ids[i] = s.bind(handler, reinterpret_cast<void *>(i + 100));
+            UTEST_ASSERT(ids[i] >= 0);
+        }
+        for (size_t i=0; i<0x40; ++i)
+        {
+            if (i != 0x20)
+                UTEST_ASSERT(s.unbind(ids[i]) == STATUS_OK);
+        }
+        {
+            const ssize_t log[] = { 0, 3, 4, 0x20 + 100 };
+            check_log(&s, log, 4);
+        }
+        UTEST_ASSERT(s.disable(ids[0x20]) == STATUS_OK);
+        UTEST_ASSERT(s.unbind_all() == 4);
+        UTEST_ASSERT(s.unbind(ids[0x20]) != STATUS_OK);
+        check_log(&s, NULL, 0);
+    }
+
+UTEST_END
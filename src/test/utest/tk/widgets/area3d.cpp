@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/r3d/base/backend.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+namespace
+{
+    using namespace lsp;
+
+    /**
+     * Software 3D backend: fills the viewport with the background color
+     * and counts the primitives passed for drawing
+     */
+    struct soft_backend_t: public r3d::base_backend_t
+    {
+        size_t      nPrimitives;
+
+        void construct()
+        {
+            r3d::base_backend_t::construct();
+            nPrimitives     = 0;
+
+            #define SOFT_BACKEND_EXP(func)   r3d::backend_t::func = reinterpret_cast<decltype(r3d::backend_t::func)>(soft_backend_t::func)
+            SOFT_BACKEND_EXP(init_offscreen);
+            SOFT_BACKEND_EXP(destroy);
+            SOFT_BACKEND_EXP(start);
+            SOFT_BACKEND_EXP(finish);
+            SOFT_BACKEND_EXP(sync);
+            SOFT_BACKEND_EXP(read_pixels);
+            SOFT_BACKEND_EXP(set_lights);
+            SOFT_BACKEND_EXP(draw_primitives);
+            #undef SOFT_BACKEND_EXP
+        }
+
+        static status_t init_offscreen(soft_backend_t *_this)
+        {
+            return STATUS_OK;
+        }
+
+        static void destroy(soft_backend_t *_this)
+        {
+            delete _this;
+        }
+
+        static status_t start(soft_backend_t *_this)
+        {
+            return STATUS_OK;
+        }
+
+        static status_t finish(soft_backend_t *_this)
+        {
+            return STATUS_OK;
+        }
+
+        static status_t sync(soft_backend_t *_this)
+        {
+            return STATUS_OK;
+        }
+
+        static status_t set_lights(soft_backend_t *_this, const r3d::light_t *lights, size_t count)
+        {
+            return STATUS_OK;
+        }
+
+        static status_t draw_primitives(soft_backend_t *_this, const r3d::buffer_t *buffer)
+        {
+            ++_this->nPrimitives;
+            return STATUS_OK;
+        }
+
+        static status_t read_pixels(soft_backend_t *_this, void *buf, size_t stride, r3d::pixel_format_t format)
+        {
+            const r3d::color_t *c   = &_this->colBackground;
+            const uint32_t b        = uint32_t(c->b * 255.0f) & 0xff;
+            const uint32_t g        = uint32_t(c->g * 255.0f) & 0xff;
+            const uint32_t r        = uint32_t(c->r * 255.0f) & 0xff;
+            const uint32_t pixel    = (format == r3d::PIXEL_BGRA) ?
+                (b | (g << 8) | (r << 16)) :
+                (r | (g << 8) | (b << 16));
+
+            for (ssize_t y=0; y<_this->viewHeight; ++y)
+            {
+                uint32_t *row           = reinterpret_cast<uint32_t *>(static_cast<uint8_t *>(buf) + y * stride);
+                for (ssize_t x=0; x<_this->viewWidth; ++x)
+                    row[x]                  = pixel;
+            }
+
+            return STATUS_OK;
+        }
+    };
+
+    class SoftArea3D: public tk::Area3D
+    {
+        public:
+            size_t      nBackends;
+
+        protected:
+            virtual ws::IR3DBackend *create_backend() override
+            {
+                soft_backend_t *backend = new soft_backend_t();
+                if (backend == NULL)
+                    return NULL;
+                backend->construct();
+                if (backend->init_offscreen(backend) != STATUS_OK)
+                {
+                    backend->destroy(backend);
+                    return NULL;
+                }
+
+                ws::IR3DBackend *r3d    = new ws::IR3DBackend(pDisplay->display(), backend, NULL, NULL);
+                if (r3d == NULL)
+                {
+                    backend->destroy(backend);
+                    return NULL;
+                }
+
+                ++nBackends;
+                return r3d;
+            }
+
+        public:
+            explicit SoftArea3D(tk::Display *dpy): tk::Area3D(dpy)
+            {
+                nBackends   = 0;
+            }
+    };
+}
+
+UTEST_BEGIN("tk.widgets", area3d)
+
+    bool wait_frames(tk::Display *dpy, SoftArea3D *a, size_t frames)
+    {
+        for (size_t i=0; i<100; ++i)
+        {
+            if (dpy->main_iteration() != STATUS_OK)
+                return false;
+            if (a->frames_rendered() >= frames)
+                return true;
+            ipc::Thread::sleep(10);
+        }
+        return false;
+    }
+
+    void idle(tk::Display *dpy, size_t iterations)
+    {
+        for (size_t i=0; i<iterations; ++i)
+        {
+            UTEST_ASSERT(dpy->main_iteration() == STATUS_OK);
+            ipc::Thread::sleep(10);
+        }
+    }
+
+    void test_rendering(bool retained, bool deferred)
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        tk::Window wnd(&dpy);
+        SoftArea3D area(&dpy);
+        lsp_finally {
+            area.destroy();
+            wnd.destroy();
+        };
+
+        UTEST_ASSERT(wnd.init() == STATUS_OK);
+        UTEST_ASSERT(area.init() == STATUS_OK);
+        wnd.size()->set(64, 64);
+        wnd.padding()->set(0);
+        wnd.border_size()->set(0);
+        area.allocation()->set_fill(true);
+        area.border_size()->set(0);
+        area.border_radius()->set(0);
+        area.glass()->set(false);
+        area.color()->set_rgb(1.0f, 0.0f, 0.0f);
+        area.set_retained(retained);
+        area.set_deferred_rendering(deferred);
+        UTEST_ASSERT(wnd.add(&area) == STATUS_OK);
+        wnd.show();
+
+        // Initial frame is rendered by the software backend
+        UTEST_ASSERT(wait_frames(&dpy, &area, 1));
+        idle(&dpy, 5);
+        tk::HeadlessWindow *hwnd = static_cast<tk::HeadlessWindow *>(wnd.native());
+        UTEST_ASSERT(hwnd != NULL);
+        UTEST_ASSERT(hwnd->surface() != NULL);
+        UTEST_ASSERT(hwnd->surface()->pixel(32, 32) == 0xffff0000);
+        UTEST_ASSERT(area.nBackends == 1);
+        size_t frames = area.frames_rendered();
+
+        // Redraw of the surface renders new frame unless the scene is retained
+        for (size_t i=0; i<5; ++i)
+        {
+            area.query_draw();
+            idle(&dpy, 2);
+        }
+        if (retained)
+        {
+            UTEST_ASSERT(area.frames_rendered() == frames);
+        }
+        else
+        {
+            UTEST_ASSERT(area.frames_rendered() > frames);
+        }
+        UTEST_ASSERT(hwnd->surface()->pixel(32, 32) == 0xffff0000);
+
+        // Redraw of the border does not change the scene in both modes
+        frames = area.frames_rendered();
+        area.border_color()->set_rgb(0.0f, 1.0f, 0.0f);
+        idle(&dpy, 5);
+        UTEST_ASSERT(area.frames_rendered() == frames);
+
+        // Change of the scene renders new frame
+        area.query_draw3d();
+        UTEST_ASSERT(wait_frames(&dpy, &area, frames + 1));
+        idle(&dpy, 2);
+        UTEST_ASSERT(area.frames_rendered() == frames + 1);
+
+        // Change of the background color renders new frame
+        area.color()->set_rgb(0.0f, 0.0f, 1.0f);
+        UTEST_ASSERT(wait_frames(&dpy, &area, frames + 2));
+        idle(&dpy, 5);
+        UTEST_ASSERT(area.frames_rendered() == frames + 2);
+        UTEST_ASSERT(hwnd->surface()->pixel(32, 32) == 0xff0000ff);
+    }
+
+    UTEST_MAIN
+    {
+        test_rendering(false, false);
+        test_rendering(false, true);
+        test_rendering(true, false);
+        test_rendering(true, true);
+    }
+
+UTEST_END
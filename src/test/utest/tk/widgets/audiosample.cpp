@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t SAMPLES     = 100000;   // Enough to decimate the peak summary several times
+    static constexpr size_t POINTS      = 777;
+    static constexpr size_t WIDTH       = 1024;     // Wider than the decimation alignment of the drawing buffer
+    static constexpr size_t HEIGHT      = 256;
+
+    class TestChannel: public tk::AudioChannel
+    {
+        public:
+            explicit TestChannel(tk::Display *dpy): tk::AudioChannel(dpy) {}
+
+        public:
+            using tk::AudioChannel::peaks;
+
+            size_t peak_block() const   { return nPeakBlock; }
+    };
+}
+
+UTEST_BEGIN("tk.widgets", audiosample)
+
+    void make_samples(float *v, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            v[i]    = sinf(i * 0.001f) * cosf(i * 0.037f) + ((i % 1000) == 0 ? 0.5f : 0.0f);
+    }
+
+    void check_peaks(TestChannel *c, const float *v, size_t samples, size_t count)
+    {
+        float vmin[POINTS], vmax[POINTS];
+        c->peaks(vmin, vmax, samples, count);
+
+        // Output points cover whole peak blocks, compute the same ranges from raw samples
+        const size_t block  = c->peak_block();
+        const size_t blocks = (samples + block - 1) / block;
+        const float kx      = float(samples) / float(count);
+        for (size_t i=0; i<count; ++i)
+        {
+            size_t first        = size_t(i * kx) / block;
+            size_t last         = lsp_max(size_t((i + 1) * kx), size_t(i * kx) + 1);
+            last                = lsp_min((last + block - 1) / block, blocks);
+
+            float min           = 0.0f;
+            float max           = 0.0f;
+            for (size_t j=first * block, n=lsp_min(last * block, samples); j<n; ++j)
+            {
+                min                 = lsp_min(min, v[j]);
+                max                 = lsp_max(max, v[j]);
+            }
+
+            UTEST_ASSERT_MSG((vmin[i] == min) && (vmax[i] == max),
+                "Peak %d mismatch: min=%f expected=%f, max=%f expected=%f",
+                int(i), vmin[i], min, vmax[i], max);
+        }
+    }
+
+    void test_peaks()
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        TestChannel appended(&dpy), assigned(&dpy);
+        lsp_finally {
+            appended.destroy();
+            assigned.destroy();
+        };
+        UTEST_ASSERT(appended.init() == STATUS_OK);
+        UTEST_ASSERT(assigned.init() == STATUS_OK);
+
+        float *v = new float[SAMPLES];
+        UTEST_ASSERT(v != NULL);
+        lsp_finally { delete [] v; };
+        make_samples(v, SAMPLES);
+
+        // Append samples by blocks of different size and check the summary after each block
+        for (size_t off=0, step=1; off < SAMPLES; off += step, step = step * 3 + 1)
+        {
+            step    = lsp_min(step, SAMPLES - off);
+            UTEST_ASSERT(appended.append(&v[off], step) == STATUS_OK);
+            const size_t n = off + step;
+            check_peaks(&appended, v, n, lsp_min(n, POINTS));
+            check_peaks(&appended, v, n, lsp_min(n, size_t(16)));
+        }
+        UTEST_ASSERT(appended.samples()->size() == SAMPLES);
+        UTEST_ASSERT(appended.peak_block() > 1);
+
+        // Summary of the whole array should match the appended one
+        UTEST_ASSERT(assigned.samples()->append(v, SAMPLES) == STATUS_OK);
+        check_peaks(&assigned, v, SAMPLES, POINTS);
+        UTEST_ASSERT(assigned.peak_block() == appended.peak_block());
+
+        // Modification of samples resets the summary
+        UTEST_ASSERT(appended.samples()->set(0, 2.0f) == STATUS_OK);
+        v[0]    = 2.0f;
+        check_peaks(&appended, v, SAMPLES, POINTS);
+        UTEST_ASSERT(appended.samples()->resize(POINTS) == STATUS_OK);
+        check_peaks(&appended, v, POINTS, POINTS);
+        UTEST_ASSERT(appended.peak_block() == 1);
+    }
+
+    void wait_render(tk::Display *dpy, tk::Window *wnd, tk::HeadlessWindow *hwnd)
+    {
+        for (size_t i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(dpy->main_iteration() == STATUS_OK);
+            if ((hwnd->surface() != NULL) && (!wnd->redraw_pending()) && (!wnd->resize_pending()))
+                return;
+            ipc::Thread::sleep(10);
+        }
+        UTEST_ASSERT(!wnd->redraw_pending());
+    }
+
+    void test_stereo_draw()
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        tk::Window wnd(&dpy);
+        tk::AudioSample as(&dpy);
+        tk::AudioChannel left(&dpy), right(&dpy);
+        lsp_finally {
+            left.destroy();
+            right.destroy();
+            as.destroy();
+            wnd.destroy();
+        };
+
+        UTEST_ASSERT(wnd.init() == STATUS_OK);
+        UTEST_ASSERT(as.init() == STATUS_OK);
+        UTEST_ASSERT(left.init() == STATUS_OK);
+        UTEST_ASSERT(right.init() == STATUS_OK);
+        wnd.size()->set(WIDTH, HEIGHT);
+        wnd.padding()->set(0);
+        wnd.border_size()->set(0);
+
+        // Stereo groups draw each channel as a single poly of the wave envelope
+        as.allocation()->set_fill(true);
+        as.stereo_groups()->set(true);
+        as.main_visibility()->set(false);
+        as.glass()->set(false);
+        for (size_t i=0; i<tk::AudioSample::LABELS; ++i)
+            as.label_visibility(i)->set(false);
+        UTEST_ASSERT(as.add(&left) == STATUS_OK);
+        UTEST_ASSERT(as.add(&right) == STATUS_OK);
+        UTEST_ASSERT(wnd.add(&as) == STATUS_OK);
+
+        float *v = new float[SAMPLES];
+        UTEST_ASSERT(v != NULL);
+        lsp_finally { delete [] v; };
+        make_samples(v, SAMPLES);
+        UTEST_ASSERT(left.append(v, SAMPLES) == STATUS_OK);
+        UTEST_ASSERT(right.append(v, SAMPLES) == STATUS_OK);
+        left.color()->set_rgb(1.0f, 0.0f, 0.0f);
+        right.color()->set_rgb(0.0f, 0.0f, 1.0f);
+
+        wnd.show();
+        tk::HeadlessWindow *hwnd = static_cast<tk::HeadlessWindow *>(wnd.native());
+        UTEST_ASSERT(hwnd != NULL);
+        wait_render(&dpy, &wnd, hwnd);
+
+        // Appending more samples redraws the channels with the same width
+        UTEST_ASSERT(left.append(v, SAMPLES / 2) == STATUS_OK);
+        UTEST_ASSERT(right.append(v, SAMPLES / 2) == STATUS_OK);
+        wait_render(&dpy, &wnd, hwnd);
+
+        tk::HeadlessSurface *s = hwnd->surface();
+        UTEST_ASSERT(s != NULL);
+        UTEST_ASSERT((s->width() == WIDTH) && (s->height() == HEIGHT));
+
+        // Both channels should be present in the middle column
+        size_t colors = 0;
+        for (size_t y=1; y<HEIGHT; ++y)
+            if (s->pixel(WIDTH / 2, y) != s->pixel(WIDTH / 2, y - 1))
+                ++colors;
+        UTEST_ASSERT(colors >= 2);
+    }
+
+    UTEST_MAIN
+    {
+        test_peaks();
+        test_stereo_draw();
+    }
+
+UTEST_END
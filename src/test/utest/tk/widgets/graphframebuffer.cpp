@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t VALUES      = 0x400;
+
+    class TestFrameBuffer: public tk::GraphFrameBuffer
+    {
+        public:
+            explicit TestFrameBuffer(tk::Display *dpy): tk::GraphFrameBuffer(dpy) {}
+
+        public:
+            using tk::GraphFrameBuffer::build_palette;
+            using tk::GraphFrameBuffer::apply_palette;
+
+            static constexpr size_t palette_size()   { return PALETTE_SIZE; }
+
+            const uint32_t *palette_data() const    { return vPalette;      }
+
+            // Per-pixel computation of colors without palette
+            void calc_colors(uint32_t *dst, const float *v, size_t n)
+            {
+                float rgba[VALUES * 4];
+                (this->*pCalcColor)(rgba, v, n);
+                dsp::rgba_to_bgra32(dst, rgba, n);
+            }
+    };
+}
+
+UTEST_BEGIN("tk.widgets", graphframebuffer)
+
+    static size_t color_distance(uint32_t a, uint32_t b)
+    {
+        size_t dist = 0;
+        for (size_t i=0; i<4; ++i, a >>= 8, b >>= 8)
+        {
+            ssize_t d   = ssize_t(a & 0xff) - ssize_t(b & 0xff);
+            dist        = lsp_max(dist, size_t((d < 0) ? -d : d));
+        }
+        return dist;
+    }
+
+    void check_palette(TestFrameBuffer *fb, float min, float max)
+    {
+        uint32_t ref[VALUES], pal[VALUES];
+        float v[VALUES], node[VALUES];
+        const size_t nodes  = TestFrameBuffer::palette_size() - 1;
+        const float k       = (max - min) / nodes;
+
+        fb->data()->set_range(min, max);
+        UTEST_ASSERT(fb->build_palette());
+        UTEST_ASSERT(fb->palette_data() != NULL);
+
+        // Values between nodes of the palette should map to the nearest node
+        for (size_t i=0; i<VALUES; ++i)
+        {
+            const size_t idx    = (i * 7919) % (nodes + 1);
+            const float off     = (float((i * 31) % 97) / 97.0f - 0.5f) * 0.98f;
+            v[i]                = min + (idx + ((idx > 0) && (idx < nodes) ? off : 0.0f)) * k;
+            node[i]             = min + idx * k;
+        }
+
+        fb->calc_colors(ref, node, VALUES);
+        fb->apply_palette(reinterpret_cast<uint8_t *>(pal), v, VALUES);
+        for (size_t i=0; i<VALUES; ++i)
+            UTEST_ASSERT_MSG(color_distance(ref[i], pal[i]) <= 1,
+                "Color mismatch for value %f (range %f..%f): palette=0x%08x, expected=0x%08x",
+                v[i], min, max, int(pal[i]), int(ref[i]));
+
+        // Values at the bounds of the range should match the per-pixel computation
+        v[0]        = min;
+        v[1]        = max;
+        fb->calc_colors(ref, v, 2);
+        fb->apply_palette(reinterpret_cast<uint8_t *>(pal), v, 2);
+        UTEST_ASSERT(color_distance(ref[0], pal[0]) <= 1);
+        UTEST_ASSERT(color_distance(ref[1], pal[1]) <= 1);
+    }
+
+    UTEST_MAIN
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        TestFrameBuffer fb(&dpy);
+        lsp_finally { fb.destroy(); };
+        UTEST_ASSERT(fb.init() == STATUS_OK);
+        fb.palette()->set(true);
+        fb.color()->set_rgb(0.25f, 0.75f, 0.5f);
+
+        static const tk::graph_frame_function_t functions[] =
+        {
+            tk::GFF_RAINBOW,
+            tk::GFF_FOG,
+            tk::GFF_COLOR,
+            tk::GFF_LIGHTNESS,
+            tk::GFF_LIGHTNESS2
+        };
+
+        for (size_t i=0; i<sizeof(functions)/sizeof(functions[0]); ++i)
+        {
+            printf("Testing palette for function %d\n", int(functions[i]));
+            fb.function()->set(functions[i]);
+
+            // The palette is rebuilt on each change of the data range
+            check_palette(&fb, 0.0f, 1.0f);
+            check_palette(&fb, -1.0f, 1.0f);
+            check_palette(&fb, 0.25f, 0.5f);
+            check_palette(&fb, -24.0f, 12.0f);
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+namespace
+{
+    using namespace lsp;
+
+    static constexpr size_t ROWS        = 3;
+    static constexpr size_t COLS        = 3;
+    static constexpr size_t CELLS       = 8;
+    static constexpr size_t CHANGED     = 4;        // The cell at row 1, column 1
+
+    // Position of cells: left, top, rows, cols
+    static const size_t cells[CELLS][4] =
+    {
+        { 0, 0, 1, 1 }, { 1, 0, 1, 1 }, { 2, 0, 1, 1 },
+        { 0, 1, 1, 1 }, { 1, 1, 1, 1 }, { 2, 1, 1, 1 },
+        { 0, 2, 1, 2 },                 { 2, 2, 1, 1 }
+    };
+
+    /**
+     * Grid that records rows and columns which minimum size is re-estimated
+     */
+    class TestGrid: public tk::Grid
+    {
+        public:
+            size_t      nDirtyRows;
+            size_t      nDirtyCols;
+            size_t      nRebuilds;
+
+        protected:
+            void        record_dirty()
+            {
+                if (!sAlloc.bValid)
+                {
+                    ++nRebuilds;
+                    return;
+                }
+
+                mark_dirty_headers(&sAlloc);
+                for (size_t i=0, n=sAlloc.vRows.size(); i<n; ++i)
+                    if (sAlloc.vRows.uget(i)->nFlags & F_DIRTY)
+                        nDirtyRows     |= size_t(1) << i;
+                for (size_t i=0, n=sAlloc.vCols.size(); i<n; ++i)
+                    if (sAlloc.vCols.uget(i)->nFlags & F_DIRTY)
+                        nDirtyCols     |= size_t(1) << i;
+            }
+
+            virtual void size_request(ws::size_limit_t *r) override
+            {
+                record_dirty();
+                tk::Grid::size_request(r);
+            }
+
+            virtual bool realize(const ws::rectangle_t *r) override
+            {
+                record_dirty();
+                return tk::Grid::realize(r);
+            }
+
+        public:
+            explicit TestGrid(tk::Display *dpy): tk::Grid(dpy)
+            {
+                reset();
+            }
+
+            void reset()
+            {
+                nDirtyRows  = 0;
+                nDirtyCols  = 0;
+                nRebuilds   = 0;
+            }
+    };
+
+    typedef struct layout_t
+    {
+        tk::Window  wnd;
+        TestGrid    grid;
+        tk::Void   *vCells[CELLS];
+
+        explicit layout_t(tk::Display *dpy): wnd(dpy), grid(dpy)
+        {
+            for (size_t i=0; i<CELLS; ++i)
+                vCells[i]   = new tk::Void(dpy);
+        }
+
+        ~layout_t()
+        {
+            for (size_t i=0; i<CELLS; ++i)
+            {
+                vCells[i]->destroy();
+                delete vCells[i];
+            }
+            grid.destroy();
+            wnd.destroy();
+        }
+    } layout_t;
+}
+
+UTEST_BEGIN("tk.widgets", grid)
+
+    void create_layout(layout_t *l, bool changed)
+    {
+        UTEST_ASSERT(l->wnd.init() == STATUS_OK);
+        UTEST_ASSERT(l->grid.init() == STATUS_OK);
+        l->wnd.size()->set(256, 128);
+        l->wnd.padding()->set(0);
+        l->wnd.border_size()->set(0);
+        l->grid.rows()->set(ROWS);
+        l->grid.columns()->set(COLS);
+        l->grid.hspacing()->set(2);
+        l->grid.vspacing()->set(2);
+        l->grid.allocation()->set_fill(true);
+
+        for (size_t i=0; i<CELLS; ++i)
+        {
+            tk::Void *v     = l->vCells[i];
+            UTEST_ASSERT(v->init() == STATUS_OK);
+            v->allocation()->set_fill(true);
+            v->constraints()->set_min(16, 16);
+            UTEST_ASSERT(l->grid.attach(cells[i][0], cells[i][1], v, cells[i][2], cells[i][3]) == STATUS_OK);
+        }
+        if (changed)
+            l->vCells[CHANGED]->constraints()->set_min(120, 48);
+
+        UTEST_ASSERT(l->wnd.add(&l->grid) == STATUS_OK);
+        l->wnd.show();
+    }
+
+    void wait_layout(tk::Display *dpy, tk::Window *wnd)
+    {
+        for (size_t i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(dpy->main_iteration() == STATUS_OK);
+            if (!wnd->resize_pending())
+                return;
+            ipc::Thread::sleep(10);
+        }
+        UTEST_ASSERT(!wnd->resize_pending());
+    }
+
+    UTEST_MAIN
+    {
+        tk::display_settings_t settings;
+        settings.headless   = true;
+
+        tk::Display dpy(&settings);
+        UTEST_ASSERT(dpy.init(0, NULL) == STATUS_OK);
+        lsp_finally { dpy.destroy(); };
+
+        layout_t *inc = new layout_t(&dpy);
+        layout_t *full = new layout_t(&dpy);
+        lsp_finally {
+            delete inc;
+            delete full;
+        };
+
+        // Realize the grid, the first pass builds the whole structure of cells
+        create_layout(inc, false);
+        wait_layout(&dpy, &inc->wnd);
+        UTEST_ASSERT(inc->grid.nRebuilds > 0);
+
+        // Change of size limits of one child re-estimates only its row and column
+        inc->grid.reset();
+        inc->vCells[CHANGED]->constraints()->set_min(120, 48);
+        wait_layout(&dpy, &inc->wnd);
+        UTEST_ASSERT(inc->grid.nRebuilds == 0);
+        UTEST_ASSERT_MSG(inc->grid.nDirtyRows == (1 << cells[CHANGED][1]),
+            "Unexpected dirty rows: 0x%x", int(inc->grid.nDirtyRows));
+        UTEST_ASSERT_MSG(inc->grid.nDirtyCols == (1 << cells[CHANGED][0]),
+            "Unexpected dirty columns: 0x%x", int(inc->grid.nDirtyCols));
+
+        // The allocation should match the grid computed from scratch
+        create_layout(full, true);
+        wait_layout(&dpy, &full->wnd);
+
+        ws::rectangle_t a, b;
+        for (size_t i=0; i<CELLS; ++i)
+        {
+            inc->vCells[i]->get_rectangle(&a);
+            full->vCells[i]->get_rectangle(&b);
+            UTEST_ASSERT_MSG(
+                (a.nLeft == b.nLeft) && (a.nTop == b.nTop) &&
+                (a.nWidth == b.nWidth) && (a.nHeight == b.nHeight),
+                "Cell %d mismatch: {%d, %d, %d, %d} vs {%d, %d, %d, %d}", int(i),
+                int(a.nLeft), int(a.nTop), int(a.nWidth), int(a.nHeight),
+                int(b.nLeft), int(b.nTop), int(b.nWidth), int(b.nHeight));
+        }
+
+        // The changed cell gets at least the requested size
+        inc->vCells[CHANGED]->get_rectangle(&a);
+        UTEST_ASSERT((a.nWidth >= 120) && (a.nHeight >= 48));
+    }
+
+UTEST_END